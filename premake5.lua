@@ -13,6 +13,24 @@ newoption {
     description = "Build static libraries instead of shared libraries"
 }
 
+newoption {
+    trigger     = "enable-stats",
+    description = "Count runtime statistics in the core, readable with gbGetStats"
+}
+
+newoption {
+    trigger     = "log-level",
+    value       = "LEVEL",
+    description = "Compile out core log messages below the given level",
+    default     = "info",
+    allowed     = {
+        { "info",   "Info, warnings and errors" },
+        { "warn",   "Warnings and errors" },
+        { "error",  "Errors only" },
+        { "none",   "No log messages" }
+    }
+}
+
 newoption {
     trigger     = "unused-is-error",
     description = "Treat unused variable/function/parameter warnings as errors"
@@ -40,6 +58,13 @@ workspace "2026-GABLE"
         filter {}
     end
 
+    -- Runtime Statistics; Defined Workspace-Wide, So Frontends Can Show Them
+    if _OPTIONS["enable-stats"] then
+        defines { "GB_ENABLE_STATS" }
+    end
+
+    defines { "GB_LOG_LEVEL=GB_LOG_LEVEL_" .. _OPTIONS["log-level"]:upper() }
+
     -- Build Configurations
     configurations { "debug", "release", "distribute" }
     startproject "gablemu"
@@ -81,6 +106,16 @@ project "gb"
     files { "./projects/GB/**.h", "./projects/GB/**.c" }
     includedirs { "./projects" }
 
+    -- Export Only the `GB_API` Functions; Everything Else Stays Internal
+    visibility "Hidden"
+
+    -- Link Threads, for the Battery RAM Autosave Worker; Expose POSIX APIs,
+    -- for Mapped Battery RAM, Under Strict C23
+    filter { "system:linux" }
+        links { "pthread" }
+        defines { "_GNU_SOURCE" }
+    filter {}
+
 -- Project: `gbt` - Game Boy Emulator Core Library Test Suite ------------------
 
 project "gbt"
@@ -93,6 +128,12 @@ project "gbt"
     includedirs { "./projects" }
     links { "gb" }
 
+    -- Link Threads; Expose POSIX and Linux APIs Under Strict C23
+    filter { "system:linux" }
+        links { "pthread" }
+        defines { "_GNU_SOURCE" }
+    filter {}
+
 -- Project: `gbmu` - Game Boy Emulator Frontend --------------------------------
 
 project "gbmu"
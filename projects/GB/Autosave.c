@@ -0,0 +1,387 @@
+/**
+ * @file    GB/Autosave.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's battery RAM
+ *          autosaver.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <stdatomic.h>
+#include <threads.h>
+#include <GB/Autosave.h>
+
+#if defined(GB_WINDOWS)
+    #include <io.h>
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+/* Private Unions and Structures **********************************************/
+
+struct gbAutosave
+{
+    // Save File
+    char*           filepath;
+    char*           tempPath;       // `filepath` + `.tmp`, renamed over it.
+    size_t          ramSize;
+
+    // Images
+    uint8_t*        pending;        // Updated by the emulation thread, under `lock`.
+    uint8_t*        writing;        // Owned by the worker thread.
+
+    // Worker Thread
+    thrd_t          worker;
+    mtx_t           lock;
+    cnd_t           wake;           // Signalled when a snapshot is pending, or on stop.
+    cnd_t           done;           // Signalled when a write completes.
+    bool            pendingValid;   // Under `lock`.
+    bool            stopping;       // Under `lock`.
+    uint64_t        requested;      // Snapshots taken; under `lock`.
+    uint64_t        completed;      // Snapshots written, or failed; under `lock`.
+    bool            failed;         // Whether any write has failed; under `lock`.
+    bool            unsaved;        // Whether `pending` failed its last write; under `lock`.
+    atomic_uint_fast64_t writeCount;
+
+    // Interval
+    uint32_t        intervalMilliseconds;
+    uint64_t        lastSnapshotMilliseconds;
+};
+
+/* Private Function Declarations **********************************************/
+
+static uint64_t gbGetAutosaveMilliseconds ();
+static bool gbWriteAutosaveFile (gbAutosave* autosave);
+static int gbAutosaveWorker (void* argument);
+static bool gbSnapshotAutosave (gbAutosave* autosave, gbCartridge* cartridge);
+
+/* Private Function Definitions ***********************************************/
+
+uint64_t gbGetAutosaveMilliseconds ()
+{
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (uint64_t) now.tv_sec * 1000ull + (uint64_t) now.tv_nsec / 1000000ull;
+}
+
+bool gbWriteAutosaveFile (gbAutosave* autosave)
+{
+    gbAssert(autosave != nullptr);
+
+    // - Write the whole image to the temporary file first.
+    FILE* fp = fopen(autosave->tempPath, "wb");
+    gbCheckpv(fp != nullptr, false, "Failed to open RAM file '%s' for writing",
+        autosave->tempPath);
+
+    // - Flush it all the way to the disk before it replaces the save file;
+    //   otherwise, a crash after the rename may leave an empty file behind.
+    size_t bytesWritten = fwrite(autosave->writing, 1, autosave->ramSize, fp);
+    if (
+        bytesWritten != autosave->ramSize || fflush(fp) != 0 ||
+#if defined(GB_WINDOWS)
+        _commit(_fileno(fp)) != 0
+#else
+        fsync(fileno(fp)) != 0
+#endif
+    )
+    {
+        gbLogErrno("Error writing RAM data to file '%s'", autosave->tempPath);
+        fclose(fp);
+        remove(autosave->tempPath);
+        return false;
+    }
+
+    fclose(fp);
+
+    // - Then replace the save file with it in one step.
+#if defined(GB_WINDOWS)
+    if (MoveFileExA(autosave->tempPath, autosave->filepath,
+        MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == 0)
+    {
+        gbLogError("Failed to replace RAM file '%s' (error %lu).",
+            autosave->filepath, (unsigned long) GetLastError());
+        return false;
+    }
+#else
+    if (rename(autosave->tempPath, autosave->filepath) != 0)
+    {
+        gbLogErrno("Failed to replace RAM file '%s'", autosave->filepath);
+        return false;
+    }
+
+    // - The rename itself is only durable once the directory holding the
+    //   save file has been flushed, too.
+    const char* slash = strrchr(autosave->filepath, '/');
+    size_t directoryLength = (slash == nullptr) ? 0 :
+        (slash == autosave->filepath) ? 1 : (size_t) (slash - autosave->filepath);
+    char* directory = gbCreate(directoryLength + 2, char);
+    gbCheckpv(directory != nullptr, false,
+        "Error allocating memory for the directory of RAM file '%s'",
+        autosave->filepath);
+    snprintf(directory, directoryLength + 2, "%.*s",
+        (int) ((directoryLength > 0) ? directoryLength : 1),
+        (directoryLength > 0) ? autosave->filepath : ".");
+
+    int directoryFD = open(directory, O_RDONLY | O_DIRECTORY);
+    gbDestroy(directory);
+    if (directoryFD < 0 || fsync(directoryFD) != 0)
+    {
+        gbLogErrno("Failed to flush the directory of RAM file '%s'",
+            autosave->filepath);
+        if (directoryFD >= 0) { close(directoryFD); }
+        return false;
+    }
+
+    close(directoryFD);
+#endif
+
+    return true;
+}
+
+int gbAutosaveWorker (void* argument)
+{
+    gbAutosave* autosave = argument;
+
+    mtx_lock(&autosave->lock);
+    while (true)
+    {
+        // - Sleep until there is a snapshot to write. A pending snapshot is
+        //   still written when stopping.
+        while (autosave->pendingValid == false && autosave->stopping == false)
+        {
+            cnd_wait(&autosave->wake, &autosave->lock);
+        }
+
+        if (autosave->pendingValid == false)
+        {
+            break;
+        }
+
+        // - Take the snapshot, and write it without holding the lock, so the
+        //   emulation thread never waits on the disk.
+        memcpy(autosave->writing, autosave->pending, autosave->ramSize);
+        autosave->pendingValid = false;
+        uint64_t snapshot = autosave->requested;
+        mtx_unlock(&autosave->lock);
+
+        bool written = gbWriteAutosaveFile(autosave);
+        if (written == true)
+        {
+            atomic_fetch_add(&autosave->writeCount, 1);
+        }
+
+        mtx_lock(&autosave->lock);
+        autosave->failed |= !written;
+        autosave->unsaved = !written;
+        autosave->completed = snapshot;
+        cnd_broadcast(&autosave->done);
+    }
+
+    mtx_unlock(&autosave->lock);
+    return 0;
+}
+
+bool gbSnapshotAutosave (gbAutosave* autosave, gbCartridge* cartridge)
+{
+    gbAssert(autosave != nullptr);
+    gbAssert(cartridge != nullptr);
+
+    autosave->lastSnapshotMilliseconds = gbGetAutosaveMilliseconds();
+    bool dirty = gbIsCartridgeRAMDirty(cartridge);
+
+    // - An image whose last write failed is still pending, even if nothing
+    //   has changed since; snapshot it again, so the worker retries it.
+    mtx_lock(&autosave->lock);
+    if (dirty == false && autosave->unsaved == false)
+    {
+        mtx_unlock(&autosave->lock);
+        return true;
+    }
+
+    bool result = (dirty == false) || gbCollectDirtyCartridgeRAM(cartridge,
+        autosave->pending, autosave->ramSize, nullptr);
+    if (result == true)
+    {
+        autosave->pendingValid = true;
+        autosave->requested++;
+        cnd_signal(&autosave->wake);
+    }
+
+    mtx_unlock(&autosave->lock);
+    return result;
+}
+
+/* Public Function Definitions ************************************************/
+
+gbAutosave* gbCreateAutosave (gbCartridge* cartridge, const char* filepath,
+    uint32_t intervalMilliseconds)
+{
+    gbCheckv(cartridge != nullptr, nullptr, "No valid 'gbCartridge' provided.");
+    gbCheckv(filepath != nullptr, nullptr, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', nullptr, "File path string is blank.");
+    gbCheckv(gbHasCartridgeBatteryRAM(cartridge) == true, nullptr,
+        "The provided 'gbCartridge' has no battery RAM to save.");
+    gbCheckv(gbIsCartridgeRAMMapped(cartridge) == false, nullptr,
+        "The provided 'gbCartridge' has its RAM mapped to a file already.");
+
+    gbAutosave* autosave = gbCreateZero(1, gbAutosave);
+    gbCheckpv(autosave != nullptr, nullptr,
+        "Error allocating memory for 'gbAutosave'");
+
+    autosave->ramSize = gbGetCartridgeRAMSize(gbGetCartridgeHeader(cartridge));
+    autosave->intervalMilliseconds = intervalMilliseconds;
+    autosave->lastSnapshotMilliseconds = gbGetAutosaveMilliseconds();
+    atomic_init(&autosave->writeCount, 0);
+
+    size_t length = strlen(filepath);
+    autosave->filepath = gbCreate(length + 1, char);
+    autosave->tempPath = gbCreate(length + 5, char);
+    autosave->pending = gbCreate(autosave->ramSize, uint8_t);
+    autosave->writing = gbCreate(autosave->ramSize, uint8_t);
+    if (
+        autosave->filepath == nullptr || autosave->tempPath == nullptr ||
+        autosave->pending == nullptr || autosave->writing == nullptr
+    )
+    {
+        gbLogErrno("Error allocating memory for 'gbAutosave' buffers");
+        gbDestroy(autosave->filepath);
+        gbDestroy(autosave->tempPath);
+        gbDestroy(autosave->pending);
+        gbDestroy(autosave->writing);
+        gbDestroy(autosave);
+        return nullptr;
+    }
+
+    memcpy(autosave->filepath, filepath, length + 1);
+    snprintf(autosave->tempPath, length + 5, "%s.tmp", filepath);
+
+    // - Start from the cartridge's whole RAM, as loaded, and forget anything
+    //   it has already marked dirty.
+    gbCollectDirtyCartridgeRAM(cartridge, autosave->pending, autosave->ramSize,
+        nullptr);
+    gbCopyCartridgeRAM(cartridge, autosave->pending, autosave->ramSize);
+
+    bool threadsReady = false;
+    if (mtx_init(&autosave->lock, mtx_plain) == thrd_success)
+    {
+        if (cnd_init(&autosave->wake) == thrd_success)
+        {
+            if (cnd_init(&autosave->done) == thrd_success)
+            {
+                if (thrd_create(&autosave->worker, gbAutosaveWorker, autosave) == thrd_success)
+                {
+                    threadsReady = true;
+                }
+                else
+                {
+                    cnd_destroy(&autosave->done);
+                }
+            }
+
+            if (threadsReady == false) { cnd_destroy(&autosave->wake); }
+        }
+
+        if (threadsReady == false) { mtx_destroy(&autosave->lock); }
+    }
+
+    if (threadsReady == false)
+    {
+        gbLogError("Failed to start the autosave worker thread for '%s'.", filepath);
+        gbDestroy(autosave->filepath);
+        gbDestroy(autosave->tempPath);
+        gbDestroy(autosave->pending);
+        gbDestroy(autosave->writing);
+        gbDestroy(autosave);
+        return nullptr;
+    }
+
+    return autosave;
+}
+
+bool gbDestroyAutosave (gbAutosave* autosave, gbCartridge* cartridge)
+{
+    gbCheckqv(autosave, false);
+
+    if (cartridge != nullptr)
+    {
+        gbSnapshotAutosave(autosave, cartridge);
+    }
+
+    // - The worker writes anything still pending before it stops, including
+    //   an image whose last write failed.
+    mtx_lock(&autosave->lock);
+    if (autosave->unsaved == true && autosave->pendingValid == false)
+    {
+        autosave->pendingValid = true;
+        autosave->requested++;
+    }
+
+    autosave->stopping = true;
+    cnd_signal(&autosave->wake);
+    mtx_unlock(&autosave->lock);
+    thrd_join(autosave->worker, nullptr);
+
+    bool result = (autosave->failed == false);
+    cnd_destroy(&autosave->done);
+    cnd_destroy(&autosave->wake);
+    mtx_destroy(&autosave->lock);
+    gbDestroy(autosave->filepath);
+    gbDestroy(autosave->tempPath);
+    gbDestroy(autosave->pending);
+    gbDestroy(autosave->writing);
+    gbDestroy(autosave);
+    return result;
+}
+
+bool gbSetAutosaveInterval (gbAutosave* autosave, uint32_t intervalMilliseconds)
+{
+    gbCheckv(autosave != nullptr, false, "No valid 'gbAutosave' provided.");
+
+    autosave->intervalMilliseconds = intervalMilliseconds;
+    return true;
+}
+
+bool gbUpdateAutosave (gbAutosave* autosave, gbCartridge* cartridge)
+{
+    gbCheckv(autosave != nullptr, false, "No valid 'gbAutosave' provided.");
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+
+    uint64_t now = gbGetAutosaveMilliseconds();
+    if (now - autosave->lastSnapshotMilliseconds < autosave->intervalMilliseconds)
+    {
+        return true;
+    }
+
+    return gbSnapshotAutosave(autosave, cartridge);
+}
+
+bool gbFlushAutosave (gbAutosave* autosave, gbCartridge* cartridge)
+{
+    gbCheckv(autosave != nullptr, false, "No valid 'gbAutosave' provided.");
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+
+    if (gbSnapshotAutosave(autosave, cartridge) == false)
+    {
+        return false;
+    }
+
+    mtx_lock(&autosave->lock);
+    while (autosave->completed < autosave->requested)
+    {
+        cnd_wait(&autosave->done, &autosave->lock);
+    }
+
+    bool result = (autosave->unsaved == false);
+    mtx_unlock(&autosave->lock);
+    return result;
+}
+
+uint64_t gbGetAutosaveWriteCount (const gbAutosave* autosave)
+{
+    gbCheckqv(autosave, 0);
+    return atomic_load(&autosave->writeCount);
+}
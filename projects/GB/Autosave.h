@@ -0,0 +1,117 @@
+/**
+ * @file    GB/Autosave.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's battery RAM
+ *          autosaver, which periodically writes a cartridge's dirty RAM to its
+ *          save file on a worker thread.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Cartridge.h>
+
+/* Public Types and Forward Declarations **************************************/
+
+/**
+ * @brief   Defines an opaque structure representing a battery RAM autosaver
+ *          for one cartridge.
+ *
+ * The emulation thread calls @a `gbUpdateAutosave` as often as it likes;
+ * once the autosave interval has passed and the cartridge's RAM is dirty, the
+ * dirty regions are copied into a pending image, and a worker thread writes
+ * that image to a temporary file, then renames it over the save file. A crash
+ * at any point leaves either the old save or the new one, never half of each.
+ * An image whose write fails stays pending, and is written again with the
+ * next snapshot, flush or destroy.
+ */
+typedef struct gbAutosave gbAutosave;
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Allocates and creates a new autosaver for the given cartridge, and
+ *          starts its worker thread.
+ *
+ * @param   cartridge               A pointer to the @a `gbCartridge` whose RAM
+ *                                  is to be saved. It must have battery RAM;
+ *                                  see @a `gbHasCartridgeBatteryRAM`. Its RAM
+ *                                  is copied as the starting image, so load
+ *                                  any existing save first.
+ * @param   filepath                The path of the save file.
+ * @param   intervalMilliseconds    The least time between two snapshots of
+ *                                  the cartridge's RAM. `0` snapshots on every
+ *                                  call to @a `gbUpdateAutosave`.
+ *
+ * @return  If successful, returns a pointer to the new @a `gbAutosave`.
+ *          If the cartridge has no battery RAM, or if allocation or thread
+ *          creation fails, returns `nullptr`.
+ */
+GB_API gbAutosave* gbCreateAutosave (gbCartridge* cartridge,
+    const char* filepath, uint32_t intervalMilliseconds);
+
+/**
+ * @brief   Writes any last changes to the save file, stops the given
+ *          autosaver's worker thread, and deallocates the autosaver.
+ *
+ * @param   autosave    A pointer to the @a `gbAutosave` to be destroyed.
+ * @param   cartridge   A pointer to the @a `gbCartridge` it was created for,
+ *                      whose dirty RAM is collected one last time. Pass
+ *                      `nullptr` to skip that, and write only what is already
+ *                      pending.
+ *
+ * @return  If successful, and every write succeeded, returns `true`.
+ *          If the autosave pointer is `nullptr`, or any write failed, returns
+ *          `false`.
+ */
+GB_API bool gbDestroyAutosave (gbAutosave* autosave, gbCartridge* cartridge);
+
+/**
+ * @brief   Changes the autosave interval of the given autosaver.
+ *
+ * @param   autosave                A pointer to the @a `gbAutosave` to be
+ *                                  changed.
+ * @param   intervalMilliseconds    The least time between two snapshots.
+ *
+ * @return  If successful, returns `true`.
+ *          If the autosave pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbSetAutosaveInterval (gbAutosave* autosave,
+    uint32_t intervalMilliseconds);
+
+/**
+ * @brief   Snapshots the cartridge's dirty RAM for the worker thread to save,
+ *          if the autosave interval has passed since the last snapshot. Call
+ *          this from the emulation thread, e.g. once a frame.
+ *
+ * This only copies the regions written since the last snapshot, and never
+ * waits on the disk.
+ *
+ * @param   autosave    A pointer to the @a `gbAutosave` to be updated.
+ * @param   cartridge   A pointer to the @a `gbCartridge` it was created for.
+ *
+ * @return  If successful, returns `true`.
+ *          If invalid parameters are provided, returns `false`.
+ */
+GB_API bool gbUpdateAutosave (gbAutosave* autosave, gbCartridge* cartridge);
+
+/**
+ * @brief   Snapshots the cartridge's dirty RAM now, whatever the interval, and
+ *          waits for the worker thread to finish writing it.
+ *
+ * @param   autosave    A pointer to the @a `gbAutosave` to be flushed.
+ * @param   cartridge   A pointer to the @a `gbCartridge` it was created for.
+ *
+ * @return  If successful, and the pending image is now on disk, returns
+ *          `true`. Otherwise, returns `false`.
+ */
+GB_API bool gbFlushAutosave (gbAutosave* autosave, gbCartridge* cartridge);
+
+/**
+ * @brief   Retrieves the number of times the given autosaver has written its
+ *          save file successfully.
+ */
+GB_API uint64_t gbGetAutosaveWriteCount (const gbAutosave* autosave);
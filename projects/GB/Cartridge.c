@@ -9,7 +9,19 @@
 
 /* Private Includes ***********************************************************/
 
+#include <threads.h>
 #include <GB/Cartridge.h>
+#include <GB/Hash.h>
+#include <GB/Patch.h>
+
+#if defined(GB_WINDOWS)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 /* Private Constants and Enumerations *****************************************/
 
@@ -97,14 +109,41 @@ static const size_t GB_CARTRIDGE_MINIMUM_SIZE = 1024 * 16 * 2; // 32KB
 
 /* Private Unions and Structures **********************************************/
 
+/**
+ * @brief   Defines a patched ROM image shared by every cartridge created from
+ *          the same base ROM and patches.
+ */
+typedef struct gbPatchedImageKey
+{
+    uint8_t*                    base;           // The unpatched ROM, kept to confirm a hit byte for byte.
+    size_t                      baseSize;
+    uint64_t                    baseHash;
+    uint8_t**                   patches;        // Likewise, each patch, in the order applied.
+    size_t*                     patchSizes;
+    uint64_t*                   patchHashes;
+    size_t                      patchCount;
+} gbPatchedImageKey;
+
+typedef struct gbPatchedImage
+{
+    gbPatchedImageKey           key;
+    uint8_t*                    data;
+    size_t                      size;
+    size_t                      references;
+    struct gbPatchedImage*      next;
+} gbPatchedImage;
+
 struct gbCartridge
 {
     // Common Attributes
     const gbCartridgeHeader*    header;
     uint8_t*                    romData;
+    bool                        romShared;              // `romData` is a shared patched image.
     uint8_t*                    ramData;
     size_t                      romSize;
     size_t                      ramSize;
+    uint64_t*                   ramDirty;               // One bit per `GB_CARTRIDGE_RAM_REGION_SIZE` bytes.
+    bool                        ramMapped;              // `ramData` is a shared mapping of the save file.
     
     // Type-Specific Attributes
     bool                        hasBattery;
@@ -122,11 +161,33 @@ struct gbCartridge
     bool                        rtcHalted;              // MBC3 with Timer only
     uint16_t                    rtcDayCounter;          // MBC3 with Timer only
     bool                        rtcCarryBit;            // MBC3 with Timer only
+    gbRTCClock                  rtcClock;               // MBC3 with Timer only
+    uint64_t                    rtcCycleMark;           // Last reported T-cycle; `UINT64_MAX` if none.
+    uint64_t                    rtcPendingCycles;       // Emulated T-cycles not yet counted as seconds.
 };
 
 /* Private Function Declarations - Helper Functions ***************************/
 
+static gbCartridge* gbCreateCartridgeFromImage (uint8_t* romData,
+    size_t romSize, const char* source, bool shared);
+static uint8_t* gbReadCartridgeFile (const char* filepath, const char* what,
+    size_t* outSize);
+static void gbInitializePatchedImages ();
+static bool gbMatchPatchedImageKey (const gbPatchedImageKey* key,
+    const gbPatchedImageKey* other);
+static void gbDestroyPatchedImageKey (gbPatchedImageKey* key);
+static uint8_t* gbAcquirePatchedImage (const gbPatchedImageKey* key,
+    size_t* outSize);
+static uint8_t* gbPublishPatchedImage (gbPatchedImageKey* key,
+    uint8_t* data, size_t size);
+static void gbReleasePatchedImage (uint8_t* data);
+static uint64_t gbAdvanceRTCField (uint8_t* field, uint8_t modulus,
+    uint64_t count);
 static void gbUpdateMBC3RTC (gbCartridge* cartridge);
+static void gbMarkCartridgeRAMDirty (gbCartridge* cartridge, size_t offset);
+static uint8_t* gbMapSaveFile (const char* filepath, size_t size, bool* outCreated);
+static void gbUnmapSaveFile (uint8_t* data, size_t size);
+static bool gbFlushSaveFile (uint8_t* data, size_t size, bool wait);
 
 /* Private Function Declarations - Read ROM ***********************************/
 
@@ -195,8 +256,437 @@ static bool gbValidateMBC5 (gbCartridge* cartridge,
 static bool gbValidateCartridgeHeader (gbCartridge* cartridge, 
     const gbCartridgeHeader* header);
 
+/* Private Static Variables ***************************************************/
+
+/**
+ * @brief   The patched ROM images in use, and the lock which guards them. An
+ *          image is freed when the last cartridge using it is destroyed.
+ */
+static gbPatchedImage* s_patchedImages = nullptr;
+static mtx_t s_patchedImageLock;
+static once_flag s_patchedImageOnce = ONCE_FLAG_INIT;
+
 /* Private Function Definitions - Helper Functions ****************************/
 
+gbCartridge* gbCreateCartridgeFromImage (uint8_t* romData, size_t romSize,
+    const char* source, bool shared)
+{
+    gbAssert(romData != nullptr);
+    gbAssert(source != nullptr);
+
+    // - Create the cartridge structure, which takes ownership of the ROM data,
+    //   or of one reference to it if it is shared.
+    gbCartridge* cartridge = gbCreateZero(1, gbCartridge);
+    if (cartridge == nullptr)
+    {
+        gbLogErrno("Error allocating memory for 'gbCartridge'");
+        if (shared == true) { gbReleasePatchedImage(romData); }
+        else                { gbDestroy(romData); }
+        return nullptr;
+    }
+
+    cartridge->romData = romData;
+    cartridge->romSize = romSize;
+    cartridge->romShared = shared;
+
+    // - Make sure the image meets the minimum size requirement.
+    if (cartridge->romSize < GB_CARTRIDGE_MINIMUM_SIZE)
+    {
+        gbLogError("ROM image '%s' is too small to be a valid Game Boy cartridge",
+            source);
+        gbDestroyCartridge(cartridge);
+        return nullptr;
+    }
+
+    // - Point to the header within the ROM data and validate it.
+    cartridge->header =
+        (const gbCartridgeHeader*) (cartridge->romData + 0x0100);
+    if (!gbValidateCartridgeHeader(cartridge, cartridge->header))
+    {
+        gbLogError("Invalid or corrupted cartridge header in ROM image '%s'",
+            source);
+        gbDestroyCartridge(cartridge);
+        return nullptr;
+    }
+
+    // - Validate the ROM size.
+    const size_t expectedRomSize = gbGetCartridgeROMSize(cartridge->header);
+    if (cartridge->romSize != expectedRomSize)
+    {
+        gbLogError("ROM size mismatch in ROM image '%s': expected %zu bytes, got %zu bytes",
+            source, expectedRomSize, cartridge->romSize);
+        gbDestroyCartridge(cartridge);
+        return nullptr;
+    }
+
+    // - Allocate the RAM data buffer, if applicable.
+    if (cartridge->header->ramSizeByte != 0x00)
+    {
+        cartridge->ramSize = gbGetCartridgeRAMSize(cartridge->header);
+        cartridge->ramData = gbCreateZero(cartridge->ramSize, uint8_t);
+        if (cartridge->ramData == nullptr)
+        {
+            gbLogErrno("Error allocating memory for cartridge RAM data");
+            gbDestroyCartridge(cartridge);
+            return nullptr;
+        }
+
+        size_t regionCount = (cartridge->ramSize + GB_CARTRIDGE_RAM_REGION_SIZE - 1) /
+            GB_CARTRIDGE_RAM_REGION_SIZE;
+        cartridge->ramDirty = gbCreateZero((regionCount + 63) / 64, uint64_t);
+        if (cartridge->ramDirty == nullptr)
+        {
+            gbLogErrno("Error allocating memory for cartridge RAM dirty map");
+            gbDestroyCartridge(cartridge);
+            return nullptr;
+        }
+    }
+
+    return cartridge;
+}
+
+void gbMarkCartridgeRAMDirty (gbCartridge* cartridge, size_t offset)
+{
+    gbAssert(cartridge != nullptr);
+
+    if (offset < cartridge->ramSize)
+    {
+        size_t region = offset / GB_CARTRIDGE_RAM_REGION_SIZE;
+        cartridge->ramDirty[region >> 6] |= 1ull << (region & 63);
+    }
+}
+
+uint8_t* gbMapSaveFile (const char* filepath, size_t size, bool* outCreated)
+{
+    gbAssert(filepath != nullptr);
+    gbAssert(outCreated != nullptr);
+
+#if defined(GB_WINDOWS)
+    HANDLE file = CreateFileA(filepath, GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        gbLogError("Failed to open RAM file '%s' for mapping (error %lu).",
+            filepath, (unsigned long) GetLastError());
+        return nullptr;
+    }
+
+    // - A new file is sized to the RAM by the mapping itself.
+    LARGE_INTEGER fileSize = { 0 };
+    GetFileSizeEx(file, &fileSize);
+    *outCreated = (fileSize.QuadPart == 0);
+    if (*outCreated == false && (size_t) fileSize.QuadPart != size)
+    {
+        gbLogError("RAM size mismatch in file '%s': expected %zu bytes, got %lld bytes",
+            filepath, size, (long long) fileSize.QuadPart);
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // - The view keeps the mapping and the file open once their handles close.
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+        (DWORD) ((uint64_t) size >> 32), (DWORD) size, nullptr);
+    void* data = (mapping != nullptr) ?
+        MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size) : nullptr;
+    if (data == nullptr)
+    {
+        gbLogError("Failed to map RAM file '%s' (error %lu).", filepath,
+            (unsigned long) GetLastError());
+    }
+
+    if (mapping != nullptr) { CloseHandle(mapping); }
+    CloseHandle(file);
+    return data;
+#else
+    int file = open(filepath, O_RDWR | O_CREAT, 0644);
+    gbCheckpv(file >= 0, nullptr, "Failed to open RAM file '%s' for mapping",
+        filepath);
+
+    // - A new file is zero-filled to the size of the RAM.
+    struct stat info;
+    if (fstat(file, &info) != 0)
+    {
+        gbLogErrno("Failed to determine size of RAM file '%s'", filepath);
+        close(file);
+        return nullptr;
+    }
+
+    *outCreated = (info.st_size == 0);
+    if (*outCreated == true && ftruncate(file, (off_t) size) != 0)
+    {
+        gbLogErrno("Failed to size RAM file '%s'", filepath);
+        close(file);
+        return nullptr;
+    }
+    else if (*outCreated == false && (size_t) info.st_size != size)
+    {
+        gbLogError("RAM size mismatch in file '%s': expected %zu bytes, got %lld bytes",
+            filepath, size, (long long) info.st_size);
+        close(file);
+        return nullptr;
+    }
+
+    // - The mapping keeps the file open once its descriptor closes.
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    close(file);
+    gbCheckpv(data != MAP_FAILED, nullptr, "Failed to map RAM file '%s'", filepath);
+    return data;
+#endif
+}
+
+void gbUnmapSaveFile (uint8_t* data, size_t size)
+{
+    gbAssert(data != nullptr);
+
+    gbFlushSaveFile(data, size, true);
+#if defined(GB_WINDOWS)
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+bool gbFlushSaveFile (uint8_t* data, size_t size, bool wait)
+{
+    gbAssert(data != nullptr);
+
+#if defined(GB_WINDOWS)
+    // - Windows starts the write-back either way; it cannot wait on it without
+    //   the file handle, which the view no longer needs.
+    (void) wait;
+    gbCheckv(FlushViewOfFile(data, size) != 0, false,
+        "Failed to flush mapped RAM file (error %lu).", (unsigned long) GetLastError());
+#else
+    gbCheckpv(msync(data, size, wait ? MS_SYNC : MS_ASYNC) == 0, false,
+        "Failed to flush mapped RAM file");
+#endif
+
+    return true;
+}
+
+uint8_t* gbReadCartridgeFile (const char* filepath, const char* what,
+    size_t* outSize)
+{
+    gbAssert(filepath != nullptr);
+    gbAssert(outSize != nullptr);
+
+    // - Attempt to open the specified file.
+    FILE* fp = fopen(filepath, "rb");
+    gbCheckpv(fp != nullptr, nullptr, "Failed to open %s file '%s' for reading",
+        what, filepath);
+
+    // - Determine the size of the file.
+    fseek(fp, 0, SEEK_END);
+    long result = ftell(fp);
+    if (result < 0)
+    {
+        gbLogErrno("Failed to determine size of %s file '%s'", what, filepath);
+        fclose(fp);
+        return nullptr;
+    }
+
+    // - Allocate the data buffer.
+    size_t size = (size_t) result;
+    uint8_t* data = gbCreateZero((size > 0) ? size : 1, uint8_t);
+    if (data == nullptr)
+    {
+        gbLogErrno("Error allocating memory for %s data", what);
+        fclose(fp);
+        return nullptr;
+    }
+
+    // - Read the data from the file, then close it.
+    fseek(fp, 0, SEEK_SET);
+    size_t bytesRead = fread(data, 1, size, fp);
+    fclose(fp);
+    if (bytesRead != size)
+    {
+        gbLogErrno("Error reading %s data from file '%s'", what, filepath);
+        gbDestroy(data);
+        return nullptr;
+    }
+
+    *outSize = size;
+    return data;
+}
+
+void gbInitializePatchedImages ()
+{
+    mtx_init(&s_patchedImageLock, mtx_plain);
+}
+
+bool gbMatchPatchedImageKey (const gbPatchedImageKey* key,
+    const gbPatchedImageKey* other)
+{
+    gbAssert(key != nullptr && other != nullptr);
+
+    // - Rule out most mismatches by size and hash, then confirm a match by
+    //   comparing every input, so that a hash collision cannot hand out the
+    //   wrong image.
+    if (
+        key->baseSize != other->baseSize || key->baseHash != other->baseHash ||
+        key->patchCount != other->patchCount
+    )
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < key->patchCount; ++i)
+    {
+        if (
+            key->patchSizes[i] != other->patchSizes[i] ||
+            key->patchHashes[i] != other->patchHashes[i]
+        )
+        {
+            return false;
+        }
+    }
+
+    if (memcmp(key->base, other->base, key->baseSize) != 0)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < key->patchCount; ++i)
+    {
+        if (memcmp(key->patches[i], other->patches[i], key->patchSizes[i]) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void gbDestroyPatchedImageKey (gbPatchedImageKey* key)
+{
+    gbAssert(key != nullptr);
+
+    for (size_t i = 0; key->patches != nullptr && i < key->patchCount; ++i)
+    {
+        gbDestroy(key->patches[i]);
+    }
+
+    gbDestroy(key->base);
+    gbDestroy(key->patches);
+    gbDestroy(key->patchSizes);
+    gbDestroy(key->patchHashes);
+    *key = (gbPatchedImageKey) { 0 };
+}
+
+uint8_t* gbAcquirePatchedImage (const gbPatchedImageKey* key, size_t* outSize)
+{
+    gbAssert(key != nullptr);
+    gbAssert(outSize != nullptr);
+
+    call_once(&s_patchedImageOnce, gbInitializePatchedImages);
+    mtx_lock(&s_patchedImageLock);
+
+    uint8_t* data = nullptr;
+    for (gbPatchedImage* image = s_patchedImages; image != nullptr; image = image->next)
+    {
+        if (gbMatchPatchedImageKey(&image->key, key) == true)
+        {
+            image->references++;
+            data = image->data;
+            *outSize = image->size;
+            break;
+        }
+    }
+
+    mtx_unlock(&s_patchedImageLock);
+    return data;
+}
+
+uint8_t* gbPublishPatchedImage (gbPatchedImageKey* key, uint8_t* data,
+    size_t size)
+{
+    gbAssert(key != nullptr);
+    gbAssert(data != nullptr);
+
+    call_once(&s_patchedImageOnce, gbInitializePatchedImages);
+    mtx_lock(&s_patchedImageLock);
+
+    // - Another thread may have published the same image while this one was
+    //   patching; if so, use theirs.
+    for (gbPatchedImage* image = s_patchedImages; image != nullptr; image = image->next)
+    {
+        if (gbMatchPatchedImageKey(&image->key, key) == true)
+        {
+            image->references++;
+            mtx_unlock(&s_patchedImageLock);
+            gbDestroy(data);
+            return image->data;
+        }
+    }
+
+    gbPatchedImage* image = gbCreateZero(1, gbPatchedImage);
+    if (image == nullptr)
+    {
+        mtx_unlock(&s_patchedImageLock);
+        gbLogErrno("Error allocating memory for 'gbPatchedImage'");
+        gbDestroy(data);
+        return nullptr;
+    }
+
+    // - The image takes over the key's buffers, leaving the caller's empty.
+    image->key = *key;
+    *key = (gbPatchedImageKey) { 0 };
+    image->data = data;
+    image->size = size;
+    image->references = 1;
+    image->next = s_patchedImages;
+    s_patchedImages = image;
+
+    mtx_unlock(&s_patchedImageLock);
+    return data;
+}
+
+void gbReleasePatchedImage (uint8_t* data)
+{
+    call_once(&s_patchedImageOnce, gbInitializePatchedImages);
+    mtx_lock(&s_patchedImageLock);
+
+    for (gbPatchedImage** link = &s_patchedImages; *link != nullptr; link = &(*link)->next)
+    {
+        gbPatchedImage* image = *link;
+        if (image->data != data)
+        {
+            continue;
+        }
+
+        if (--image->references == 0)
+        {
+            *link = image->next;
+            gbDestroyPatchedImageKey(&image->key);
+            gbDestroy(image->data);
+            gbDestroy(image);
+        }
+
+        break;
+    }
+
+    mtx_unlock(&s_patchedImageLock);
+}
+
+uint64_t gbAdvanceRTCField (uint8_t* field, uint8_t modulus, uint64_t count)
+{
+    gbAssert(field != nullptr);
+
+    // - A field at or past its last valid value rolls over on its next tick,
+    //   just as one at the last valid value does.
+    uint64_t value = (*field < modulus) ? *field : (uint64_t) (modulus - 1);
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t total = value + count;
+    *field = (uint8_t) (total % modulus);
+    return total / modulus;
+}
+
 void gbUpdateMBC3RTC (gbCartridge* cartridge)
 {
     gbAssert(cartridge != nullptr);
@@ -207,63 +697,63 @@ void gbUpdateMBC3RTC (gbCartridge* cartridge)
         return;
     }
 
-    // - Check if the RTC is halted (bit 6 of DH register).
-    if (cartridge->rtcHalted)
+    // - Take the seconds elapsed on the selected clock since the last update.
+    //   Time spent halted (bit 6 of DH register) is dropped, not deferred.
+    uint64_t elapsedSeconds = 0;
+    if (cartridge->rtcClock == GB_RTC_EMULATED_CLOCK)
     {
-        return;
+        // - The pending cycles tick at a fixed rate in either speed mode, so
+        //   they need no scaling here.
+        elapsedSeconds = cartridge->rtcPendingCycles / GB_RTC_CYCLES_PER_SECOND;
+        cartridge->rtcPendingCycles %= GB_RTC_CYCLES_PER_SECOND;
     }
-
-    // - Calculate elapsed time since last update.
-    time_t currentTime = time(nullptr);
-    time_t elapsedSeconds = currentTime - cartridge->rtcLastUpdated;
-    cartridge->rtcLastUpdated = currentTime;
-
-    // - Update RTC registers.
-    while (elapsedSeconds > 0)
+    else
     {
-        // - Increment seconds.
-        cartridge->rtcRegisters[0]++;
-        if (cartridge->rtcRegisters[0] >= 60)
+        time_t currentTime = time(nullptr);
+        if (currentTime > cartridge->rtcLastUpdated)
         {
-            cartridge->rtcRegisters[0] = 0;
+            elapsedSeconds = (uint64_t) (currentTime - cartridge->rtcLastUpdated);
+        }
 
-            // - Increment minutes.
-            cartridge->rtcRegisters[1]++;
-            if (cartridge->rtcRegisters[1] >= 60)
-            {
-                cartridge->rtcRegisters[1] = 0;
+        cartridge->rtcLastUpdated = currentTime;
+    }
 
-                // - Increment hours.
-                cartridge->rtcRegisters[2]++;
-                if (cartridge->rtcRegisters[2] >= 24)
-                {
-                    cartridge->rtcRegisters[2] = 0;
-
-                    // - Increment day counter (9-bit: DL + bit 0 of DH).
-                    cartridge->rtcDayCounter++;
-                    if (cartridge->rtcDayCounter > 0x1FF)
-                    {
-                        // - Day counter overflow: set carry bit (bit 7 of DH).
-                        cartridge->rtcDayCounter = 0;
-                        cartridge->rtcCarryBit = true;
-                    }
-
-                    // - Update DL and DH registers from day counter.
-                    cartridge->rtcRegisters[3] = 
-                        (uint8_t) (cartridge->rtcDayCounter & 0xFF);
-                    
-                    // - Reconstruct DH: bit 0 = day counter bit 8, bit 6 = halt, 
-                    //   bit 7 = carry.
-                    cartridge->rtcRegisters[4] = 
-                        ((cartridge->rtcDayCounter >> 8) & 0x01) |
-                        (cartridge->rtcHalted ? 0x40 : 0x00) |
-                        (cartridge->rtcCarryBit ? 0x80 : 0x00);
-                }
-            }
-        }
+    if (cartridge->rtcHalted || elapsedSeconds == 0)
+    {
+        return;
+    }
+
+    // - Carry the elapsed seconds through each field in turn, so that a gap of
+    //   any length costs the same.
+    uint64_t minutes = gbAdvanceRTCField(&cartridge->rtcRegisters[0], 60,
+        elapsedSeconds);
+    uint64_t hours = gbAdvanceRTCField(&cartridge->rtcRegisters[1], 60, minutes);
+    uint64_t days = gbAdvanceRTCField(&cartridge->rtcRegisters[2], 24, hours);
+    if (days == 0)
+    {
+        return;
+    }
 
-        elapsedSeconds--;
+    // - Increment day counter (9-bit: DL + bit 0 of DH). If it overflows, set
+    //   the carry bit (bit 7 of DH), which stays set until written.
+    uint64_t dayCounter = cartridge->rtcDayCounter + days;
+    if (dayCounter > 0x1FF)
+    {
+        cartridge->rtcCarryBit = true;
     }
+
+    cartridge->rtcDayCounter = (uint16_t) (dayCounter & 0x1FF);
+
+    // - Update DL and DH registers from day counter.
+    cartridge->rtcRegisters[3] = 
+        (uint8_t) (cartridge->rtcDayCounter & 0xFF);
+    
+    // - Reconstruct DH: bit 0 = day counter bit 8, bit 6 = halt, 
+    //   bit 7 = carry.
+    cartridge->rtcRegisters[4] = 
+        ((cartridge->rtcDayCounter >> 8) & 0x01) |
+        (cartridge->rtcHalted ? 0x40 : 0x00) |
+        (cartridge->rtcCarryBit ? 0x80 : 0x00);
 }
 
 /* Private Function Definitions - Read ROM ************************************/
@@ -827,6 +1317,7 @@ bool gbWriteBasicCartridgeRAM (gbCartridge* cartridge,
     if (cartridge->ramData != nullptr)
     {
         cartridge->ramData[address] = value;
+        gbMarkCartridgeRAMDirty(cartridge, address);
         *outActual = value;
     }
     else
@@ -863,6 +1354,7 @@ bool gbWriteMBC1CartridgeRAM (gbCartridge* cartridge,
     if (!cartridge->ramBankingEnabled || cartridge->ramSize <= GB_EXTRAM_SIZE)
     {
         cartridge->ramData[address] = value;
+        gbMarkCartridgeRAMDirty(cartridge, address);
         *outActual = value;
     }
 
@@ -874,6 +1366,7 @@ bool gbWriteMBC1CartridgeRAM (gbCartridge* cartridge,
         size_t bankNumber = cartridge->ramBankNumber & maxRamBank;
         size_t bankOffset = bankNumber * GB_EXTRAM_SIZE;
         cartridge->ramData[bankOffset + address] = value;
+        gbMarkCartridgeRAMDirty(cartridge, bankOffset + address);
         *outActual = value;
     }
 
@@ -906,6 +1399,7 @@ bool gbWriteMBC2CartridgeRAM (gbCartridge* cartridge,
     
     // - Store only the lower 4 bits; upper 4 bits are ignored
     cartridge->ramData[ramAddress] = value & 0x0F;
+    gbMarkCartridgeRAMDirty(cartridge, ramAddress);
     *outActual = value & 0x0F;
 
     return true;
@@ -929,10 +1423,19 @@ bool gbWriteMBC3CartridgeRAM (gbCartridge* cartridge,
     if (cartridge->ramBankNumber >= 0x08 &&
         cartridge->ramBankNumber <= 0x0C)
     {
+        // - Count the time elapsed up to now before it is overwritten.
+        gbUpdateMBC3RTC(cartridge);
+
         uint8_t rtcIndex = cartridge->ramBankNumber - 0x08;
         cartridge->rtcRegisters[rtcIndex] = value;
         *outActual = value;
 
+        // - Writing the seconds register restarts the current second.
+        if (rtcIndex == 0)
+        {
+            cartridge->rtcPendingCycles = 0;
+        }
+
         // - Special handling for DH register (index 4): extract flags and day counter bit 8.
         if (rtcIndex == 4)
         {
@@ -968,6 +1471,7 @@ bool gbWriteMBC3CartridgeRAM (gbCartridge* cartridge,
         size_t bankNumber = cartridge->ramBankNumber & maxRamBank;
         size_t bankOffset = bankNumber * GB_EXTRAM_SIZE;
         cartridge->ramData[bankOffset + address] = value;
+        gbMarkCartridgeRAMDirty(cartridge, bankOffset + address);
         *outActual = value;
     }
 
@@ -1009,6 +1513,7 @@ bool gbWriteMBC5CartridgeRAM (gbCartridge* cartridge,
     bankNumber &= maxRamBank;
     size_t bankOffset = bankNumber * GB_EXTRAM_SIZE;
     cartridge->ramData[bankOffset + address] = value;
+    gbMarkCartridgeRAMDirty(cartridge, bankOffset + address);
     *outActual = value;
 
     return true;
@@ -1134,6 +1639,8 @@ bool gbValidateMBC3 (gbCartridge* cartridge, const gbCartridgeHeader* header)
     if (cartridge->hasTimer)
     {
         cartridge->rtcLastUpdated = time(nullptr);
+        cartridge->rtcClock = GB_RTC_WALL_CLOCK;
+        cartridge->rtcCycleMark = UINT64_MAX;
     }
 
     return true;
@@ -1242,108 +1749,140 @@ gbCartridge* gbCreateCartridge (const char* filepath)
     gbCheckv(filepath != nullptr, nullptr, "File path string is null.");
     gbCheckv(filepath[0] != '\0', nullptr, "File path string is blank.");
 
-    // - Attempt to open the specified file.
-    FILE* fp = fopen(filepath, "rb");
-    gbCheckpv(fp != nullptr, nullptr, "Failed to open ROM file '%s' for reading", 
-        filepath);
+    size_t romSize = 0;
+    uint8_t* romData = gbReadCartridgeFile(filepath, "ROM", &romSize);
+    gbCheckqv(romData, nullptr);
 
-    // - Determine the size of the file.
-    // - Make sure it meets the minimum size requirement.
-    fseek(fp, 0, SEEK_END);
-    long result = ftell(fp);
-    if (result < 0)
+    return gbCreateCartridgeFromImage(romData, romSize, filepath, false);
+}
+
+gbCartridge* gbCreateCartridgeWithPatches (const char* filepath,
+    const char* const* patchPaths, size_t patchCount)
+{
+    gbCheckv(filepath != nullptr, nullptr, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', nullptr, "File path string is blank.");
+    gbCheckv(patchCount == 0 || patchPaths != nullptr, nullptr,
+        "Patch path array is null.");
+
+    if (patchCount == 0)
     {
-        gbLogErrno("Failed to determine size of ROM file '%s'", filepath);
-        fclose(fp);
-        return nullptr;
+        return gbCreateCartridge(filepath);
     }
 
-    // - Create the cartridge structure.
-    gbCartridge* cartridge = gbCreateZero(1, gbCartridge);
-    if (cartridge == nullptr)
-    {
-        gbLogErrno("Error allocating memory for 'gbCartridge'");
-        fclose(fp);
-        return nullptr;
-    }
+    // - Read the base ROM and every patch, hashing each one to key the patched
+    //   image, and keeping them to confirm a cache hit.
+    gbPatchedImageKey key = { .patchCount = patchCount };
+    key.base = gbReadCartridgeFile(filepath, "ROM", &key.baseSize);
+    gbCheckqv(key.base, nullptr);
 
-    // - Allocate the ROM data buffer.
-    cartridge->romSize = (size_t) result;
-    if (cartridge->romSize < GB_CARTRIDGE_MINIMUM_SIZE)
+    key.patches = gbCreateZero(patchCount, uint8_t*);
+    key.patchSizes = gbCreateZero(patchCount, size_t);
+    key.patchHashes = gbCreateZero(patchCount, uint64_t);
+    if (
+        key.patches == nullptr || key.patchSizes == nullptr ||
+        key.patchHashes == nullptr
+    )
     {
-        gbLogError("ROM file '%s' is too small to be a valid Game Boy cartridge",
-            filepath);
-        gbDestroyCartridge(cartridge);
-        fclose(fp);
+        gbLogErrno("Error allocating memory for ROM patches");
+        gbDestroyPatchedImageKey(&key);
         return nullptr;
     }
 
-    cartridge->romData = gbCreateZero(cartridge->romSize, uint8_t);
-    if (cartridge->romData == nullptr)
+    key.baseHash = gbHash64(key.base, key.baseSize, 0);
+    bool ok = true;
+    for (size_t i = 0; i < patchCount && ok == true; ++i)
     {
-        gbLogErrno("Error allocating memory for cartridge ROM data");
-        gbDestroyCartridge(cartridge);
-        fclose(fp);
-        return nullptr;
+        key.patches[i] = gbReadCartridgeFile(patchPaths[i], "patch",
+            &key.patchSizes[i]);
+        ok = (key.patches[i] != nullptr);
+        if (ok == true)
+        {
+            key.patchHashes[i] = gbHash64(key.patches[i], key.patchSizes[i], 0);
+        }
     }
 
-    // - Read the ROM data from the file.
-    fseek(fp, 0, SEEK_SET);
-    size_t bytesRead = fread(cartridge->romData, 1, cartridge->romSize, fp);
-    if (bytesRead != cartridge->romSize)
+    // - If another cartridge already uses this patched image, share it;
+    //   otherwise, apply the patches in order to a copy of the base, which
+    //   the key keeps unpatched, and publish the result.
+    uint8_t* image = nullptr;
+    size_t imageSize = 0;
+    if (ok == true)
     {
-        gbLogErrno("Error reading ROM data from file '%s'", filepath);
-        gbDestroyCartridge(cartridge);
-        fclose(fp);
-        return nullptr;
+        image = gbAcquirePatchedImage(&key, &imageSize);
     }
 
-    // - Point to the header within the ROM data and validate it.
-    cartridge->header =
-        (const gbCartridgeHeader*) (cartridge->romData + 0x0100);
-    if (!gbValidateCartridgeHeader(cartridge, cartridge->header))
+    uint8_t* romData = nullptr;
+    size_t romSize = key.baseSize;
+    if (ok == true && image == nullptr)
     {
-        gbLogError("Invalid or corrupted cartridge header in file '%s'",
-            filepath);
-        gbDestroyCartridge(cartridge);
-        fclose(fp);
-        return nullptr;
+        romData = gbCreate((romSize > 0) ? romSize : 1, uint8_t);
+        ok = (romData != nullptr);
+        if (ok == true)
+        {
+            memcpy(romData, key.base, romSize);
+        }
+        else
+        {
+            gbLogErrno("Error allocating memory for the patched ROM image");
+        }
     }
 
-    // - Close the file, as we no longer need it.
-    fclose(fp);
-
-    // - Validate the ROM size.
-    const size_t expectedRomSize = gbGetCartridgeROMSize(cartridge->header);
-    if (cartridge->romSize != expectedRomSize)
+    for (size_t i = 0; i < patchCount && ok == true && image == nullptr; ++i)
     {
-        gbLogError("ROM size mismatch in file '%s': expected %zu bytes, got %zu bytes",
-            filepath, expectedRomSize, cartridge->romSize);
-        gbDestroyCartridge(cartridge);
-        return nullptr;
+        ok = gbApplyPatch(key.patches[i], key.patchSizes[i], &romData, &romSize);
+        if (ok == false)
+        {
+            gbLogError("Failed to apply %s patch '%s' to ROM file '%s'.",
+                gbStringifyPatchFormat(gbDetectPatchFormat(key.patches[i],
+                    key.patchSizes[i])), patchPaths[i], filepath);
+        }
     }
 
-    // - Allocate the RAM data buffer, if applicable.
-    if (cartridge->header->ramSizeByte != 0x00)
+    if (ok == true && image == nullptr)
     {
-        cartridge->ramSize = gbGetCartridgeRAMSize(cartridge->header);
-        cartridge->ramData = gbCreateZero(cartridge->ramSize, uint8_t);
-        if (cartridge->ramData == nullptr)
-        {
-            gbLogErrno("Error allocating memory for cartridge RAM data");
-            gbDestroyCartridge(cartridge);
-            return nullptr;
-        }
+        image = gbPublishPatchedImage(&key, romData, romSize);
+        imageSize = romSize;
+        romData = nullptr;
     }
 
-    return cartridge;
+    gbDestroyPatchedImageKey(&key);
+    gbDestroy(romData);
+    gbCheckqv(image, nullptr);
+
+    return gbCreateCartridgeFromImage(image, imageSize, filepath, true);
+}
+
+gbCartridge* gbCreateCartridgeFromMemory (const uint8_t* data, size_t size)
+{
+    gbCheckv(data != nullptr, nullptr, "ROM image pointer is null.");
+
+    // - Copy the image, so that the caller keeps ownership of its buffer.
+    uint8_t* romData = gbCreate((size > 0) ? size : 1, uint8_t);
+    gbCheckpv(romData != nullptr, nullptr,
+        "Error allocating memory for cartridge ROM data");
+
+    memcpy(romData, data, size);
+    return gbCreateCartridgeFromImage(romData, size, "<memory>", false);
 }
 
 bool gbDestroyCartridge (gbCartridge* cartridge)
 {
     gbCheckqv(cartridge, false);
+    if (cartridge->romShared == true)
+    {
+        gbReleasePatchedImage(cartridge->romData);
+        cartridge->romData = nullptr;
+    }
+
     gbDestroy(cartridge->romData);
+    if (cartridge->ramMapped == true)
+    {
+        gbUnmapSaveFile(cartridge->ramData, cartridge->ramSize);
+        cartridge->ramData = nullptr;
+    }
+
     gbDestroy(cartridge->ramData);
+    gbDestroy(cartridge->ramDirty);
     gbDestroy(cartridge);
     return true;
 }
@@ -1405,6 +1944,184 @@ size_t gbGetCartridgeRAMSize (const gbCartridgeHeader* header)
     return GB_CARTRIDGE_RAM_SIZES[header->ramSizeByte];
 }
 
+/* Public Function Definitions - Banking **************************************/
+
+bool gbGetCartridgeROMBank (const gbCartridge* cartridge, uint16_t address,
+    uint16_t* outBank)
+{
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+    gbCheckv(cartridge->header != nullptr, false,
+        "The provided 'gbCartridge' has no valid header.");
+    gbCheckv(outBank != nullptr, false, "No valid output pointer provided.");
+    gbCheckv(address < GB_ROM_SIZE, false,
+        "ROM relative address '$%04X' is out of bounds.", address);
+
+    // - Resolve the bank the same way the type-specific ROM read functions do,
+    //   masked to the number of banks actually present in the ROM.
+    size_t bankMask = (cartridge->romSize / GB_ROM_BANK_SIZE) - 1;
+    size_t bankNumber = 0;
+    switch (cartridge->header->cartridgeType)
+    {
+        case GB_CT_MBC1:
+        case GB_CT_MBC1_RAM:
+        case GB_CT_MBC1_RAM_BATTERY:
+            if (address < GB_ROM_BANK_SIZE)
+            {
+                bankNumber = (cartridge->ramBankingEnabled == true) ?
+                    (size_t) (cartridge->ramBankNumber << 5) : 0;
+            }
+            else
+            {
+                bankNumber = (size_t) (cartridge->ramBankNumber << 5) |
+                    (cartridge->romBankNumber & 0x1F);
+                if ((cartridge->romBankNumber & 0x1F) == 0x00)
+                {
+                    bankNumber |= 0x01;
+                }
+            }
+            break;
+
+        case GB_CT_MBC2:
+        case GB_CT_MBC2_BATTERY:
+            if (address >= GB_ROM_BANK_SIZE)
+            {
+                bankNumber = cartridge->romBankNumber & 0x0F;
+            }
+            break;
+
+        case GB_CT_MBC3:
+        case GB_CT_MBC3_RAM:
+        case GB_CT_MBC3_RAM_BATTERY:
+        case GB_CT_MBC3_TIMER_BATTERY:
+        case GB_CT_MBC3_TIMER_RAM_BATTERY:
+            if (address >= GB_ROM_BANK_SIZE)
+            {
+                // - The MBC3 read path does not mask its bank number; mirror it.
+                *outBank = cartridge->romBankNumber & 0x7F;
+                return true;
+            }
+            break;
+
+        case GB_CT_MBC5:
+        case GB_CT_MBC5_RAM:
+        case GB_CT_MBC5_RAM_BATTERY:
+        case GB_CT_MBC5_RUMBLE:
+        case GB_CT_MBC5_RUMBLE_RAM:
+        case GB_CT_MBC5_RUMBLE_RAM_BATTERY:
+            if (address >= GB_ROM_BANK_SIZE)
+            {
+                bankNumber = cartridge->romBankNumber |
+                    ((cartridge->ramBankingEnabled == true) ? 0x100 : 0x000);
+            }
+            break;
+
+        default:
+            // - Basic cartridges have no banking hardware; the address space
+            //   maps banks `0` and `1` directly.
+            bankNumber = (address < GB_ROM_BANK_SIZE) ? 0 : 1;
+            break;
+    }
+
+    *outBank = (uint16_t) (bankNumber & bankMask);
+    return true;
+}
+
+const uint8_t* gbGetCartridgeROMWindow (const gbCartridge* cartridge,
+    uint16_t address)
+{
+    gbCheckqv(cartridge, nullptr);
+    gbCheckqv(cartridge->header, nullptr);
+    gbCheckqv(address < GB_ROM_SIZE, nullptr);
+
+    // - Only the types which @a `gbReadCartridgeROM` supports are mapped.
+    switch (cartridge->header->cartridgeType)
+    {
+        case GB_CT_BASIC:
+        case GB_CT_BASIC_RAM:
+        case GB_CT_BASIC_RAM_BATTERY:
+        case GB_CT_MBC1:
+        case GB_CT_MBC1_RAM:
+        case GB_CT_MBC1_RAM_BATTERY:
+        case GB_CT_MBC2:
+        case GB_CT_MBC2_BATTERY:
+        case GB_CT_MBC3:
+        case GB_CT_MBC3_RAM:
+        case GB_CT_MBC3_RAM_BATTERY:
+        case GB_CT_MBC3_TIMER_BATTERY:
+        case GB_CT_MBC3_TIMER_RAM_BATTERY:
+        case GB_CT_MBC5:
+        case GB_CT_MBC5_RAM:
+        case GB_CT_MBC5_RAM_BATTERY:
+        case GB_CT_MBC5_RUMBLE:
+        case GB_CT_MBC5_RUMBLE_RAM:
+        case GB_CT_MBC5_RUMBLE_RAM_BATTERY:
+            break;
+
+        default:
+            return nullptr;
+    }
+
+    // - The bank is resolved exactly as the type-specific read functions do;
+    //   an MBC3 bank past the end of the image is left to them.
+    uint16_t bank = 0;
+    gbGetCartridgeROMBank(cartridge, address, &bank);
+    size_t offset = (size_t) bank * GB_ROM_BANK_SIZE;
+    if (offset + GB_ROM_BANK_SIZE > cartridge->romSize)
+    {
+        return nullptr;
+    }
+
+    return cartridge->romData + offset;
+}
+
+/* Public Function Definitions - Real-Time Clock ******************************/
+
+bool gbSetCartridgeRTCClock (gbCartridge* cartridge, gbRTCClock clock)
+{
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+
+    if (!cartridge->hasTimer || cartridge->rtcClock == clock)
+    {
+        cartridge->rtcClock = clock;
+        return true;
+    }
+
+    // - Count the time elapsed on the old clock, then start the new one from
+    //   now.
+    gbUpdateMBC3RTC(cartridge);
+    cartridge->rtcClock = clock;
+    cartridge->rtcLastUpdated = time(nullptr);
+    cartridge->rtcCycleMark = UINT64_MAX;
+    cartridge->rtcPendingCycles = 0;
+    return true;
+}
+
+gbRTCClock gbGetCartridgeRTCClock (const gbCartridge* cartridge)
+{
+    gbCheckqv(cartridge, GB_RTC_WALL_CLOCK);
+    return cartridge->rtcClock;
+}
+
+bool gbClockCartridgeRTC (gbCartridge* cartridge, uint64_t tickCycle)
+{
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+
+    if (!cartridge->hasTimer || cartridge->rtcClock != GB_RTC_EMULATED_CLOCK)
+    {
+        return true;
+    }
+
+    // - The cycles are only accumulated here; they become seconds when the
+    //   clock is next read, latched or written.
+    if (tickCycle > cartridge->rtcCycleMark && !cartridge->rtcHalted)
+    {
+        cartridge->rtcPendingCycles += tickCycle - cartridge->rtcCycleMark;
+    }
+
+    cartridge->rtcCycleMark = tickCycle;
+    return true;
+}
+
 /* Public Function Definitions - Battery-Backed RAM ***************************/
 
 bool gbLoadCartridgeRAM (gbCartridge* cartridge, const char* filepath,
@@ -1504,6 +2221,199 @@ bool gbSaveCartridgeRAM (const gbCartridge* cartridge,
     return true;
 }
 
+bool gbMapCartridgeRAM (gbCartridge* cartridge, const char* filepath,
+    bool evenIfNoBattery)
+{
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+    gbCheckv(cartridge->ramMapped == false, false,
+        "The provided 'gbCartridge' already has its RAM mapped to a file.");
+
+    // - As with loading, skip cartridges with no RAM, or no battery.
+    if (cartridge->ramSize == 0 || cartridge->ramData == nullptr)
+    {
+        return true;
+    }
+    else if (!cartridge->hasBattery && !evenIfNoBattery)
+    {
+        return true;
+    }
+
+    bool created = false;
+    uint8_t* data = gbMapSaveFile(filepath, cartridge->ramSize, &created);
+    if (data == nullptr)
+    {
+        return false;
+    }
+
+    // - An existing file's contents become the RAM as they are; a new file
+    //   takes on whatever the RAM holds now.
+    if (created == true)
+    {
+        memcpy(data, cartridge->ramData, cartridge->ramSize);
+    }
+
+    gbDestroy(cartridge->ramData);
+    cartridge->ramData = data;
+    cartridge->ramMapped = true;
+    return true;
+}
+
+bool gbIsCartridgeRAMMapped (const gbCartridge* cartridge)
+{
+    gbCheckqv(cartridge, false);
+    return cartridge->ramMapped;
+}
+
+bool gbSyncCartridgeRAM (gbCartridge* cartridge, bool wait)
+{
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+    gbCheckv(cartridge->ramMapped == true, false,
+        "The provided 'gbCartridge' does not have its RAM mapped to a file.");
+
+    // - Flush each run of dirty regions, widened to whole pages, and mark
+    //   them clean.
+#if defined(GB_WINDOWS)
+    SYSTEM_INFO system;
+    GetSystemInfo(&system);
+    size_t pageSize = (size_t) system.dwPageSize;
+#else
+    long pageResult = sysconf(_SC_PAGESIZE);
+    size_t pageSize = (pageResult > 0) ? (size_t) pageResult : 4096;
+#endif
+
+    bool result = true;
+    size_t regionCount = (cartridge->ramSize + GB_CARTRIDGE_RAM_REGION_SIZE - 1) /
+        GB_CARTRIDGE_RAM_REGION_SIZE;
+    size_t region = 0;
+    while (region < regionCount)
+    {
+        if ((cartridge->ramDirty[region >> 6] & (1ull << (region & 63))) == 0)
+        {
+            region++;
+            continue;
+        }
+
+        size_t first = region;
+        while (
+            region < regionCount &&
+            (cartridge->ramDirty[region >> 6] & (1ull << (region & 63))) != 0
+        )
+        {
+            cartridge->ramDirty[region >> 6] &= ~(1ull << (region & 63));
+            region++;
+        }
+
+        size_t start = (first * GB_CARTRIDGE_RAM_REGION_SIZE) & ~(pageSize - 1);
+        size_t end = region * GB_CARTRIDGE_RAM_REGION_SIZE;
+        if (end > cartridge->ramSize)
+        {
+            end = cartridge->ramSize;
+        }
+
+        result = gbFlushSaveFile(cartridge->ramData + start, end - start, wait) && result;
+    }
+
+    return result;
+}
+
+bool gbHasCartridgeBatteryRAM (const gbCartridge* cartridge)
+{
+    gbCheckqv(cartridge, false);
+    return cartridge->hasBattery == true && cartridge->ramData != nullptr;
+}
+
+bool gbIsCartridgeRAMDirty (const gbCartridge* cartridge)
+{
+    gbCheckqv(cartridge != nullptr && cartridge->ramDirty != nullptr, false);
+
+    size_t regionCount = (cartridge->ramSize + GB_CARTRIDGE_RAM_REGION_SIZE - 1) /
+        GB_CARTRIDGE_RAM_REGION_SIZE;
+    for (size_t i = 0; i < (regionCount + 63) / 64; ++i)
+    {
+        if (cartridge->ramDirty[i] != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool gbCopyCartridgeRAM (const gbCartridge* cartridge, uint8_t* image,
+    size_t imageSize)
+{
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+    gbCheckv(image != nullptr, false, "No valid image buffer provided.");
+    gbCheckv(imageSize == cartridge->ramSize, false,
+        "Image buffer is %zu bytes; the cartridge has %zu bytes of RAM.",
+        imageSize, cartridge->ramSize);
+
+    if (imageSize > 0)
+    {
+        memcpy(image, cartridge->ramData, imageSize);
+    }
+
+    return true;
+}
+
+bool gbCollectDirtyCartridgeRAM (gbCartridge* cartridge, uint8_t* image,
+    size_t imageSize, size_t* outRegionCount)
+{
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+    gbCheckv(image != nullptr, false, "No valid image buffer provided.");
+    gbCheckv(imageSize == cartridge->ramSize, false,
+        "Image buffer is %zu bytes; the cartridge has %zu bytes of RAM.",
+        imageSize, cartridge->ramSize);
+
+    // - Copy each dirty region into the image, and clear its bit. Only whole
+    //   words of the dirty map with a bit set are looked at closely.
+    size_t copied = 0;
+    size_t regionCount = (cartridge->ramSize + GB_CARTRIDGE_RAM_REGION_SIZE - 1) /
+        GB_CARTRIDGE_RAM_REGION_SIZE;
+    for (size_t word = 0; word < (regionCount + 63) / 64; ++word)
+    {
+        uint64_t bits = cartridge->ramDirty[word];
+        cartridge->ramDirty[word] = 0;
+        for (size_t bit = 0; bits != 0; ++bit, bits >>= 1)
+        {
+            if ((bits & 1) == 0)
+            {
+                continue;
+            }
+
+            size_t offset = (word * 64 + bit) * GB_CARTRIDGE_RAM_REGION_SIZE;
+            size_t length = cartridge->ramSize - offset;
+            if (length > GB_CARTRIDGE_RAM_REGION_SIZE)
+            {
+                length = GB_CARTRIDGE_RAM_REGION_SIZE;
+            }
+
+            memcpy(image + offset, cartridge->ramData + offset, length);
+            copied++;
+        }
+    }
+
+    if (outRegionCount != nullptr)
+    {
+        *outRegionCount = copied;
+    }
+
+    return true;
+}
+
+bool gbHashCartridgeRAM (const gbCartridge* cartridge, uint64_t seed,
+    uint64_t* outHash)
+{
+    gbCheckv(cartridge != nullptr, false, "No valid 'gbCartridge' provided.");
+    gbCheckv(outHash != nullptr, false, "No valid output pointer provided for hash.");
+
+    *outHash = gbHash64(cartridge->ramData,
+        (cartridge->ramData != nullptr) ? cartridge->ramSize : 0, seed);
+    return true;
+}
+
 /* Public Function Definitions - Memory Access ********************************/
 
 bool gbReadCartridgeROM (const gbCartridge* cartridge, uint16_t address,
@@ -51,6 +51,33 @@ typedef enum gbCartridgeType
     GB_CT_MBC5_RUMBLE_RAM_BATTERY   = 0x1E, /** @brief MBC5 with Rumble, RAM, Battery */
 } gbCartridgeType;
 
+/**
+ * @brief   Defines the size of the regions of cartridge RAM which are tracked
+ *          as dirty, in bytes. A write to any byte marks its whole region.
+ */
+#define GB_CARTRIDGE_RAM_REGION_SIZE 512
+
+/**
+ * @brief   Enumerates the clocks which can drive the real-time clock of an MBC3
+ *          cartridge with a timer.
+ */
+typedef enum gbRTCClock : uint8_t
+{
+    GB_RTC_WALL_CLOCK       = 0x00, /** @brief Counts the host's wall-clock seconds, as real hardware would. */
+    GB_RTC_EMULATED_CLOCK   = 0x01  /** @brief Counts the emulated T-cycles passed to @a `gbClockCartridgeRTC`. */
+} gbRTCClock;
+
+/**
+ * @brief   Defines the number of T-cycles in one second of emulated time, at
+ *          which an emulated real-time clock advances by one second.
+ *
+ * These are ticks of the fixed 4 MiHz clock, as counted by
+ * @a `gbGetTickCyclesConsumed`, not CPU cycles; the CPU's double-speed mode
+ * takes two ticks per machine cycle instead of four, so it does not speed up
+ * the clock.
+ */
+#define GB_RTC_CYCLES_PER_SECOND 4194304ull
+
 /* Public Unions and Structures ***********************************************/
 
 /**
@@ -99,6 +126,49 @@ typedef struct gbCartridgeHeader
  */
 GB_API gbCartridge* gbCreateCartridge (const char* filepath);
 
+/**
+ * @brief   Creates and loads a Game Boy cartridge device from a ROM file, with
+ *          IPS, UPS and/or BPS patches applied to it in the order given.
+ *
+ * The patched image is kept in a cache shared by every cartridge created
+ * from the same ROM and patches, so loading the same patched ROM again (for
+ * instance, for a lockstep run or a second emulator instance) reads the
+ * files and hashes them, but neither patches nor copies the image again. The
+ * image is freed when the last cartridge using it is destroyed.
+ *
+ * @param   filepath    The path to the base ROM file.
+ * @param   patchPaths  An array of paths to the patch files; the format of
+ *                      each is detected from its contents. May be `nullptr`
+ *                      if `patchCount` is zero.
+ * @param   patchCount  The number of patch files.
+ *
+ * @return  If successful, returns a pointer to the new @a `gbCartridge`.
+ *          If a file cannot be read, a patch does not apply, or the patched
+ *          image is not a valid ROM, returns `nullptr`.
+ */
+GB_API gbCartridge* gbCreateCartridgeWithPatches (const char* filepath,
+    const char* const* patchPaths, size_t patchCount);
+
+/**
+ * @brief   Creates and loads a Game Boy cartridge device from a ROM image which
+ *          is already in memory.
+ *
+ * The image is copied, so the caller keeps ownership of @a `data`, and may
+ * free or reuse it as soon as this function returns.
+ *
+ * @param   data        A pointer to the ROM image to be loaded. Must not be
+ *                      `nullptr`.
+ * @param   size        The size of the ROM image, in bytes. Must match the ROM
+ *                      size declared in the image's cartridge header.
+ * 
+ * @return  If successful, a pointer to the newly created @a `gbCartridge`
+ *          structure containing a copy of the ROM image.
+ *          If loading fails (e.g., invalid format, allocation failure, etc.),
+ *          returns `nullptr`.
+ */
+GB_API gbCartridge* gbCreateCartridgeFromMemory (const uint8_t* data,
+    size_t size);
+
 /**
  * @brief   Destroys and deallocates a Game Boy cartridge device.
  * 
@@ -194,6 +264,95 @@ GB_API size_t gbGetCartridgeROMSize (const gbCartridgeHeader* header);
  */
 GB_API size_t gbGetCartridgeRAMSize (const gbCartridgeHeader* header);
 
+/* Public Function Declarations - Banking *************************************/
+
+/**
+ * @brief   Retrieves the number of the ROM bank which is currently mapped at
+ *          the specified address within the given Game Boy cartridge device's
+ *          ROM area, as determined by its memory bank controller.
+ * 
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure to be
+ *                      inspected. Must not be `nullptr`.
+ * @param   address     The 16-bit address to be resolved, relative to the start
+ *                      of the ROM area. Must be within the range `0x0000` to
+ *                      `0x7FFF`.
+ * @param   outBank     A pointer to a variable where the bank number will be
+ *                      stored. Must not be `nullptr`.
+ * 
+ * @return  If successful, returns `true`.
+ *          If resolving fails (e.g., invalid address, null pointers, etc.),
+ *          returns `false`.
+ */
+GB_API bool gbGetCartridgeROMBank (const gbCartridge* cartridge,
+    uint16_t address, uint16_t* outBank);
+
+/**
+ * @brief   Retrieves the 16 KiB of ROM image currently mapped into the ROM
+ *          area half (`$0000` - `$3FFF` or `$4000` - `$7FFF`) containing the
+ *          specified address, so that it can be read without going through
+ *          the memory bank controller.
+ *
+ * The pointer is valid until the next write to the cartridge's ROM area,
+ * which may switch banks.
+ *
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure to be
+ *                      inspected.
+ * @param   address     An address within the ROM area half to be resolved.
+ *
+ * @return  A pointer to the start of the mapped bank; or `nullptr` if the
+ *          cartridge type is unsupported, or the bank lies outside the ROM
+ *          image, in which case @a `gbReadCartridgeROM` must be used.
+ */
+GB_API const uint8_t* gbGetCartridgeROMWindow (const gbCartridge* cartridge,
+    uint16_t address);
+
+/* Public Function Declarations - Real-Time Clock *****************************/
+
+/**
+ * @brief   Selects the clock which drives the real-time clock of the given
+ *          MBC3 cartridge.
+ * 
+ * The wall clock is the default. The emulated clock advances only as the
+ * context reports emulated time with @a `gbClockCartridgeRTC`, so a run
+ * which is fast-forwarded, paused or replayed sees the same clock every time.
+ * Time already elapsed on the old clock is applied before switching.
+ * 
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure to be
+ *                      changed. Must not be `nullptr`.
+ * @param   clock       The clock to drive the real-time clock from.
+ * 
+ * @return  If successful, or if the cartridge has no real-time clock, returns
+ *          `true`.
+ *          If the cartridge pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbSetCartridgeRTCClock (gbCartridge* cartridge, gbRTCClock clock);
+
+/**
+ * @brief   Retrieves the clock which drives the real-time clock of the given
+ *          cartridge.
+ */
+GB_API gbRTCClock gbGetCartridgeRTCClock (const gbCartridge* cartridge);
+
+/**
+ * @brief   Reports the emulated time to the given cartridge's real-time clock,
+ *          if it is driven by the emulated clock. The context calls this before
+ *          each cartridge access which can observe the clock.
+ * 
+ * Only the difference from the last reported time is used, so this costs the
+ * same however long ago that was. A time earlier than the last reported one,
+ * such as after a reset, starts counting afresh from it.
+ * 
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure to be
+ *                      clocked. Must not be `nullptr`.
+ * @param   tickCycle   The number of T-cycles consumed so far, at the fixed
+ *                      rate whatever the CPU's speed mode; see
+ *                      @a `gbGetTickCyclesConsumed`.
+ * 
+ * @return  If successful, returns `true`.
+ *          If the cartridge pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbClockCartridgeRTC (gbCartridge* cartridge, uint64_t tickCycle);
+
 /* Public Function Declarations - Battery-Backed RAM **************************/
 
 /**
@@ -236,6 +395,140 @@ GB_API bool gbLoadCartridgeRAM (gbCartridge* cartridge, const char* filepath,
 GB_API bool gbSaveCartridgeRAM (const gbCartridge* cartridge,
     const char* filepath, bool evenIfNoBattery);
 
+/**
+ * @brief   Backs a Game Boy cartridge's RAM directly with a shared memory
+ *          mapping of a save file, in place of loading and saving it.
+ * 
+ * If the file exists, its contents become the cartridge's RAM as they are,
+ * without being read in; it must be exactly the size of the RAM. If it does
+ * not, it is created, and takes on the RAM's current contents. From then on,
+ * every write to the RAM is a write to the file, which the operating system
+ * writes back on its own schedule, or when @a `gbSyncCartridgeRAM` is called,
+ * and finally when the cartridge is destroyed. Several processes mapping the
+ * same file share one copy of it in the page cache.
+ * 
+ * Mapped RAM and @a `gbAutosave` both consume the cartridge's dirty regions,
+ * so use one or the other.
+ * 
+ * @param   cartridge           A pointer to the @a `gbCartridge` structure
+ *                              whose RAM is to be mapped. Must not be `nullptr`.
+ * @param   filepath            The path of the save file to be mapped. Must not
+ *                              be `nullptr`, and also must not be an empty
+ *                              string.
+ * @param   evenIfNoBattery     If `true`, map the RAM even if the cartridge type
+ *                              does not indicate the presence of a battery.
+ * 
+ * @return  If successful, or if the cartridge RAM is not mapped (e.g., no
+ *          external RAM, no battery, etc.), returns `true`.
+ *          If mapping fails (e.g., the file cannot be opened, or is the wrong
+ *          size), returns `false`, and the RAM is left as it was.
+ */
+GB_API bool gbMapCartridgeRAM (gbCartridge* cartridge, const char* filepath,
+    bool evenIfNoBattery);
+
+/**
+ * @brief   Checks whether a Game Boy cartridge's RAM is mapped to a save file
+ *          by @a `gbMapCartridgeRAM`.
+ */
+GB_API bool gbIsCartridgeRAMMapped (const gbCartridge* cartridge);
+
+/**
+ * @brief   Asks the operating system to write the pages of a Game Boy
+ *          cartridge's mapped RAM which were touched since the last call back
+ *          to its save file, and marks them clean. Call this periodically.
+ * 
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure whose RAM is
+ *                      to be synchronized. Must not be `nullptr`, and its RAM
+ *                      must be mapped.
+ * @param   wait        If `true`, wait for the writes to reach the disk.
+ *                      Otherwise, only schedule them.
+ * 
+ * @return  If successful, returns `true`.
+ *          If the RAM is not mapped, or a flush fails, returns `false`.
+ */
+GB_API bool gbSyncCartridgeRAM (gbCartridge* cartridge, bool wait);
+
+/**
+ * @brief   Checks whether a Game Boy cartridge has RAM which is kept by a
+ *          battery, and so should be saved.
+ * 
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure to check.
+ * 
+ * @return  `true` if the cartridge has both RAM and a battery; `false`
+ *          otherwise, or if the cartridge pointer is `nullptr`.
+ */
+GB_API bool gbHasCartridgeBatteryRAM (const gbCartridge* cartridge);
+
+/**
+ * @brief   Checks whether any region of a Game Boy cartridge's RAM has been
+ *          written since it was last collected by
+ *          @a `gbCollectDirtyCartridgeRAM`.
+ * 
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure to check.
+ * 
+ * @return  `true` if any region is dirty; `false` otherwise, or if the
+ *          cartridge has no RAM.
+ */
+GB_API bool gbIsCartridgeRAMDirty (const gbCartridge* cartridge);
+
+/**
+ * @brief   Copies the whole of a Game Boy cartridge's RAM into an image of
+ *          that RAM. Dirty regions stay dirty.
+ * 
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure whose RAM is
+ *                      to be copied. Must not be `nullptr`.
+ * @param   image       A pointer to the buffer to be filled. Must not be
+ *                      `nullptr`.
+ * @param   imageSize   The size of the buffer, which must equal the size of the
+ *                      cartridge's RAM.
+ * 
+ * @return  If successful, returns `true`.
+ *          If invalid parameters are provided, returns `false`.
+ */
+GB_API bool gbCopyCartridgeRAM (const gbCartridge* cartridge, uint8_t* image,
+    size_t imageSize);
+
+/**
+ * @brief   Copies every dirty region of a Game Boy cartridge's RAM into an
+ *          image of that RAM, at the same offsets, and marks those regions
+ *          clean.
+ * 
+ * Regions are @a `GB_CARTRIDGE_RAM_REGION_SIZE` bytes each. Only the dirty
+ * regions are copied, so keeping an up-to-date image this way costs little
+ * more than the bytes the game actually wrote.
+ * 
+ * @param   cartridge       A pointer to the @a `gbCartridge` structure whose
+ *                          RAM is to be collected. Must not be `nullptr`.
+ * @param   image           A pointer to the RAM image to be updated. Must not
+ *                          be `nullptr`.
+ * @param   imageSize       The size of the image, which must equal the size of
+ *                          the cartridge's RAM.
+ * @param   outRegionCount  If not `nullptr`, receives the number of regions
+ *                          copied.
+ * 
+ * @return  If successful, returns `true`.
+ *          If invalid parameters are provided, returns `false`.
+ */
+GB_API bool gbCollectDirtyCartridgeRAM (gbCartridge* cartridge, uint8_t* image,
+    size_t imageSize, size_t* outRegionCount);
+
+/**
+ * @brief   Computes a 64-bit hash of a Game Boy cartridge's external RAM, for
+ *          comparing the states of two contexts cheaply.
+ * 
+ * @param   cartridge   A pointer to the @a `gbCartridge` structure whose RAM is
+ *                      to be hashed. Must not be `nullptr`.
+ * @param   seed        The seed value, or the hash of preceding state.
+ * @param   outHash     A pointer to a variable where the hash will be stored.
+ *                      Must not be `nullptr`.
+ * 
+ * @return  If successful, returns `true`. A cartridge without RAM hashes as
+ *          an empty buffer.
+ *          If invalid parameters are provided, returns `false`.
+ */
+GB_API bool gbHashCartridgeRAM (const gbCartridge* cartridge, uint64_t seed,
+    uint64_t* outHash);
+
 /* Public Function Declarations - Memory Access *******************************/
 
 /**
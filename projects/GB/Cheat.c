@@ -0,0 +1,163 @@
+/**
+ * @file    GB/Cheat.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's cheat code
+ *          parser.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Context.h>
+#include <GB/Cheat.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The most hex digits a supported cheat code has.
+ */
+#define GB_CHEAT_MAX_DIGITS 9
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static bool gbDecodeGameGenie (const uint8_t* digits, size_t count,
+    gbCheat* outCheat);
+static bool gbDecodeGameShark (const uint8_t* digits, gbCheat* outCheat);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+bool gbDecodeGameGenie (const uint8_t* digits, size_t count, gbCheat* outCheat)
+{
+    gbAssert(digits != nullptr);
+    gbAssert(outCheat != nullptr);
+
+    // - The sixth digit holds the top nibble of the address, inverted.
+    uint16_t address =
+        (uint16_t) ((digits[5] ^ 0x0F) << 12) |
+        (uint16_t) (digits[2] << 8) |
+        (uint16_t) (digits[3] << 4) |
+        (uint16_t) digits[4];
+    gbCheckv(address <= GB_ROMX_END, false,
+        "Game Genie code addresses '$%04X', outside cartridge ROM.", address);
+
+    outCheat->format = GB_CF_GAME_GENIE;
+    outCheat->value = (uint8_t) ((digits[0] << 4) | digits[1]);
+    outCheat->address = address;
+
+    // - The seventh and ninth digits hold the compare value, rotated right by
+    //   two and scrambled; the eighth is not used.
+    if (count == GB_CHEAT_MAX_DIGITS)
+    {
+        uint8_t scrambled = (uint8_t) ((digits[6] << 4) | digits[8]);
+        outCheat->hasCompare = true;
+        outCheat->compare =
+            (uint8_t) ((scrambled >> 2) | (scrambled << 6)) ^ 0xBA;
+    }
+
+    return true;
+}
+
+bool gbDecodeGameShark (const uint8_t* digits, gbCheat* outCheat)
+{
+    gbAssert(digits != nullptr);
+    gbAssert(outCheat != nullptr);
+
+    uint8_t type = (uint8_t) ((digits[0] << 4) | digits[1]);
+    uint16_t address =
+        (uint16_t) ((digits[6] << 12) | (digits[7] << 8)) |
+        (uint16_t) ((digits[4] << 4) | digits[5]);
+
+    gbCheckv(type == 0x01 || (type >= 0x90 && type <= 0x97), false,
+        "GameShark code type '%02X' is not supported.", type);
+    gbCheckv(
+        (address >= GB_EXTRAM_START && address <= GB_WRAMX_END) ||
+        (address >= GB_HRAM_START && address <= GB_HRAM_END),
+        false,
+        "GameShark code addresses '$%04X', outside of RAM.", address);
+
+    outCheat->format = GB_CF_GAMESHARK;
+    outCheat->value = (uint8_t) ((digits[2] << 4) | digits[3]);
+    outCheat->address = address;
+
+    // - A `9X` code names the WRAM bank it writes; bank `0` selects bank `1`,
+    //   as it does through `SVBK`.
+    if (type != 0x01 && address >= GB_WRAMX_START && address <= GB_WRAMX_END)
+    {
+        outCheat->bank = ((type & 0x07) != 0) ? (type & 0x07) : 1;
+    }
+
+    return true;
+}
+
+/* Public Function Definitions ************************************************/
+
+bool gbParseCheat (const char* code, gbCheat* outCheat)
+{
+    gbCheckv(code != nullptr, false, "Cheat code string is null.");
+    gbCheckv(outCheat != nullptr, false, "No valid output pointer provided.");
+
+    // - Collect the code's hex digits, skipping any dashes.
+    uint8_t digits[GB_CHEAT_MAX_DIGITS] = { 0 };
+    size_t count = 0;
+    for (const char* c = code; *c != '\0'; ++c)
+    {
+        if (*c == '-')
+        {
+            continue;
+        }
+
+        gbCheckv(isxdigit((unsigned char) *c) != 0 && count < GB_CHEAT_MAX_DIGITS,
+            false, "'%s' is not a Game Genie or GameShark code.", code);
+
+        digits[count++] = (uint8_t) (isdigit((unsigned char) *c) ?
+            (*c - '0') : (toupper((unsigned char) *c) - 'A' + 10));
+    }
+
+    gbCheat cheat = { .enabled = true };
+    bool result = false;
+    if (count == 6 || count == 9)
+    {
+        result = gbDecodeGameGenie(digits, count, &cheat);
+    }
+    else if (count == 8)
+    {
+        result = gbDecodeGameShark(digits, &cheat);
+    }
+    else
+    {
+        gbLogError("'%s' is not a Game Genie or GameShark code.", code);
+    }
+
+    if (result == false)
+    {
+        return false;
+    }
+
+    // - Keep the code in its usual written form.
+    static const char HEX[] = "0123456789ABCDEF";
+    size_t length = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (cheat.format == GB_CF_GAME_GENIE && (i == 3 || i == 6))
+        {
+            cheat.code[length++] = '-';
+        }
+
+        cheat.code[length++] = HEX[digits[i]];
+    }
+
+    cheat.code[length] = '\0';
+    *outCheat = cheat;
+    return true;
+}
+
+const char* gbStringifyCheatFormat (gbCheatFormat format)
+{
+    switch (format)
+    {
+        case GB_CF_GAME_GENIE:  return "Game Genie";
+        case GB_CF_GAMESHARK:   return "GameShark";
+        default:                return "Unknown";
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * @file    GB/Cheat.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's cheat code
+ *          parser, which decodes Game Genie and GameShark codes.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Common.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Enumerates the cheat code formats which the core can apply.
+ */
+typedef enum gbCheatFormat : uint8_t
+{
+    GB_CF_GAME_GENIE    = 0x00, /** @brief Game Genie; substitutes a byte read from cartridge ROM. */
+    GB_CF_GAMESHARK     = 0x01  /** @brief GameShark; writes a byte to RAM once per frame. */
+} gbCheatFormat;
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure representing one decoded cheat code.
+ */
+typedef struct gbCheat
+{
+    char            code[12];       /** @brief The code, upper-cased, with Game Genie dashes; null-terminated. */
+    gbCheatFormat   format;         /** @brief The format of the code. */
+    bool            enabled;        /** @brief Whether the code is applied. */
+    bool            hasCompare;     /** @brief Game Genie only - Whether the code only applies over `compare`. */
+    uint8_t         value;          /** @brief The byte substituted or written. */
+    uint8_t         compare;        /** @brief Game Genie only - The ROM byte the code applies over. */
+    uint8_t         bank;           /** @brief GameShark only - WRAM bank for `$D000` - `$DFFF`; `0` for the selected bank. */
+    uint16_t        address;        /** @brief The absolute address substituted or written. */
+} gbCheat;
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Decodes a cheat code.
+ *
+ * Game Genie codes are written `VVA-AAA` or `VVA-AAA-CCC`, and must address
+ * cartridge ROM (`$0000` - `$7FFF`). GameShark codes are written `TTVVLLHH`,
+ * where `TT` is `01` to write to the selected WRAM bank, or `9X` to write to
+ * WRAM bank `X`; they must address cartridge RAM, work RAM or high RAM. Codes
+ * are not case-sensitive, and Game Genie dashes are optional.
+ *
+ * @param   code        The cheat code to be decoded.
+ * @param   outCheat    A pointer to a @a `gbCheat` structure to receive the
+ *                      decoded code. It is enabled.
+ *
+ * @return  If successful, returns `true`.
+ *          If the code is not in a supported format, or addresses memory its
+ *          format cannot patch, returns `false`.
+ */
+GB_API bool gbParseCheat (const char* code, gbCheat* outCheat);
+
+/**
+ * @brief   Retrieves a string naming the given cheat code format.
+ */
+GB_API const char* gbStringifyCheatFormat (gbCheatFormat format);
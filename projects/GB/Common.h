@@ -45,36 +45,107 @@
 #if defined(__GNUC__) || defined(__clang__)
     #define GB_UNUSED __attribute__((unused))
     #define GB_PACKED __attribute__((packed))
+    #define GB_INLINE inline __attribute__((always_inline))
+    #define GB_PRINTF(formatIndex, argsIndex) \
+        __attribute__((format(printf, formatIndex, argsIndex)))
 #elif defined(_MSC_VER)
     #define GB_UNUSED
     #define GB_PACKED __pragma(pack(push, 1))
+    #define GB_INLINE __forceinline
+    #define GB_PRINTF(formatIndex, argsIndex)
 #else
     #define GB_UNUSED
     #define GB_PACKED
+    #define GB_INLINE inline
+    #define GB_PRINTF(formatIndex, argsIndex)
 #endif
 
+/* Public Constant Macros - Logging *******************************************/
+
+/**
+ * @brief   The log levels, as numbers the preprocessor can compare. Messages
+ *          below `GB_LOG_LEVEL` are compiled out; define it, as the premake
+ *          `log-level` option does, to raise it from `GB_LOG_LEVEL_INFO`.
+ */
+#define GB_LOG_LEVEL_INFO   0
+#define GB_LOG_LEVEL_WARN   1
+#define GB_LOG_LEVEL_ERROR  2
+#define GB_LOG_LEVEL_NONE   3
+
+#if !defined(GB_LOG_LEVEL)
+    #define GB_LOG_LEVEL GB_LOG_LEVEL_INFO
+#endif
+
+/* Public Enumerations - Logging **********************************************/
+
+/**
+ * @brief   Enumerates the levels of the core's log messages.
+ */
+typedef enum gbLogLevel : uint8_t
+{
+    GB_LL_INFO  = GB_LOG_LEVEL_INFO,    /** @brief Informational; written to `stdout` by default. */
+    GB_LL_WARN  = GB_LOG_LEVEL_WARN,    /** @brief Something unexpected, but recoverable; `stderr`. */
+    GB_LL_ERROR = GB_LOG_LEVEL_ERROR    /** @brief An operation failed; `stderr`. */
+} gbLogLevel;
+
+/* Public Function Declarations - Logging *************************************/
+
+/**
+ * @brief   Formats a log message, and queues it for the log sink. Use the
+ *          @a `gbLogInfo`, @a `gbLogWarn`, @a `gbLogError` and
+ *          @a `gbLogErrno` macros rather than calling this directly.
+ *
+ * Each call site may log a few messages per second; any more are counted
+ * and reported once the next second begins. Messages are queued without
+ * taking a lock, and written out by a background thread; see `GB/Log.h`.
+ *
+ * @param   level       The level of the message.
+ * @param   function    The name of the function logging the message.
+ * @param   line        The source line logging the message.
+ * @param   error       If not `0`, an `errno` value to be described after the
+ *                      message.
+ * @param   format      The message's `printf`-style format string.
+ */
+GB_API void gbWriteLog (gbLogLevel level, const char* function, int line,
+    int error, const char* format, ...) GB_PRINTF(5, 6);
+
 /* Public Function Macros - Logging *******************************************/
 
-#define gbLog(stream, ...) \
-    do \
-    { \
-        fprintf((stream), "[%s] ", __FUNCTION__); \
-        fprintf((stream), __VA_ARGS__); \
-        fprintf((stream), "\n"); \
-        fflush((stream)); \
-    } while (0)
-#define gbLogInfo(...)  gbLog(stdout, "[INFO] " __VA_ARGS__)
-#define gbLogWarn(...)  gbLog(stderr, "[WARN] " __VA_ARGS__)
-#define gbLogError(...) gbLog(stderr, "[ERROR] " __VA_ARGS__)
-#define gbLogErrno(...) \
+#define gbLog(level, ...) \
+    gbWriteLog((level), __FUNCTION__, __LINE__, 0, __VA_ARGS__)
+
+// - A message below `GB_LOG_LEVEL` is never logged, but its arguments are kept
+//   in dead code, so they are still type-checked and counted as used.
+#define gbLogNever(...) \
     do \
     { \
-        fprintf(stderr, "[%s] [ERROR] ", __FUNCTION__); \
-        fprintf(stderr, __VA_ARGS__); \
-        fprintf(stderr, ": '%s'\n", strerror(errno)); \
-        fflush(stderr); \
+        if (0) \
+        { \
+            gbWriteLog(GB_LL_INFO, __FUNCTION__, __LINE__, 0, __VA_ARGS__); \
+        } \
     } while (0)
 
+#if GB_LOG_LEVEL <= GB_LOG_LEVEL_INFO
+    #define gbLogInfo(...)  gbLog(GB_LL_INFO, __VA_ARGS__)
+#else
+    #define gbLogInfo(...)  gbLogNever(__VA_ARGS__)
+#endif
+
+#if GB_LOG_LEVEL <= GB_LOG_LEVEL_WARN
+    #define gbLogWarn(...)  gbLog(GB_LL_WARN, __VA_ARGS__)
+#else
+    #define gbLogWarn(...)  gbLogNever(__VA_ARGS__)
+#endif
+
+#if GB_LOG_LEVEL <= GB_LOG_LEVEL_ERROR
+    #define gbLogError(...) gbLog(GB_LL_ERROR, __VA_ARGS__)
+    #define gbLogErrno(...) \
+        gbWriteLog(GB_LL_ERROR, __FUNCTION__, __LINE__, errno, __VA_ARGS__)
+#else
+    #define gbLogError(...) gbLogNever(__VA_ARGS__)
+    #define gbLogErrno(...) gbLogNever(__VA_ARGS__)
+#endif
+
 /* Public Function Macros - Memory ********************************************/
 
 #define gbCreate(count, type) ((type*) malloc((count) * sizeof(type)))
@@ -12,7 +12,15 @@
 #include <GB/Memory.h>
 #include <GB/Processor.h>
 #include <GB/Timer.h>
+#include <GB/Serial.h>
+#include <GB/Trace.h>
+#include <GB/Profiler.h>
+#include <GB/Coverage.h>
+#include <GB/Stats.h>
+#include <GB/Cheat.h>
+#include <GB/Hash.h>
 #include <GB/Context.h>
+#include <GB/Internal.h>
 
 /* Private Constants and Enumerations *****************************************/
 
@@ -41,245 +49,389 @@ struct gbContext
     // Callbacks
     gbBusReadCallback   busReadCallback;
     gbBusWriteCallback  busWriteCallback;
+    gbBusReadOverride   busReadOverride;
+    gbBusWriteOverride  busWriteOverride;
+    uint8_t             busHooks;                   // `GB_HE_BUS_*` bits of the callbacks set above.
+    gbAddressFilter     busFilter;
 
     // Components
     gbCartridge*        cartridge;
     gbMemory*           memory;
     gbProcessor*        processor;
     gbTimer*            timer;
+    gbSerial*           serial;
+    gbTrace*            trace;
+    gbProfiler*         profiler;
+    gbCoverage*         coverage;
+
+    // Memory Map
+    const uint8_t*      readPages[GB_PAGE_COUNT];   // `nullptr` where the general path must be taken.
+    uint8_t*            writePages[GB_PAGE_COUNT];  // Likewise, for writes.
+    uint16_t            romBanks[2];                // The bank in each half of the ROM area, as of the last remap.
+
+    // Cheats
+    gbCheat*            cheats;
+    size_t              cheatCount;
+    size_t              cheatCapacity;
+    uint64_t            cheatROMPages[2];           // One bit per ROM page with an enabled Game Genie code.
+    uint8_t*            cheatShadows;               // `GB_ROM_SIZE` bytes; shadow copies of those pages.
+    size_t              ramCheatCount;              // Enabled GameShark codes.
+    uint64_t            nextCheatCycle;             // T-cycle of the next frame boundary.
 
     // Internal State
     bool                engineMode;
+    bool                referenceMode;
+    bool                stopRequested;
+
+    // Statistics
+#if defined(GB_ENABLE_STATS)
+    gbStats             stats;
+#endif
 };
 
+/* Private Function Declarations - Helper Functions ***************************/
+
+static void gbTraceBusAccess (const gbContext* context, gbTraceRecordType type,
+    uint16_t address, uint8_t value);
+static bool gbCheckInterruptReachable (const gbContext* context);
+static uint8_t gbSubstituteROMByte (const gbContext* context, uint16_t address,
+    uint8_t original);
+static void gbMapROMPages (gbContext* context, bool force);
+static void gbMapWorkRAMPages (gbContext* context);
+static bool gbRefreshCheats (gbContext* context);
+static uint64_t gbGetRunLimit (const gbContext* context, uint64_t end);
+static GB_INLINE bool gbCheckBusFilter (const gbContext* context,
+    uint16_t address);
+static bool gbCheckSelfJump (const gbContext* context,
+    const gbProcessorRegisterFile* registers);
+
+/* Private Function Declarations - Address Bus ********************************/
+
+static GB_INLINE bool gbReadMappedByte (const gbContext* context,
+    uint16_t address, uint8_t* outValue, const gbCheckRules* checkRules);
+static GB_INLINE bool gbWriteMappedByte (gbContext* context, uint16_t address,
+    uint8_t value, const gbCheckRules* checkRules, uint8_t* outActual);
+static bool gbReadCPUByte (const gbContext* context, uint16_t address,
+    uint8_t* outValue);
+static bool gbWriteCPUByte (gbContext* context, uint16_t address,
+    uint8_t value, uint8_t* outActual);
+
 /* Private Static Variables ***************************************************/
 
 /**
  * @brief   A pointer to the Game Boy Emulator Core context designated as the
  *          "current context" for operations that do not explicitly receive a
- *          context parameter.
+ *          context parameter. Each thread has its own current context.
  */
-static gbContext* s_currentContext = nullptr;
+static thread_local gbContext* s_currentContext = nullptr;
 
-/* Public Function Definitions ************************************************/
+/* Private Function Definitions - Helper Functions ****************************/
 
-gbContext* gbCreateContext (bool engineMode)
+void gbTraceBusAccess (const gbContext* context, gbTraceRecordType type,
+    uint16_t address, uint8_t value)
 {
-    gbContext* context = gbCreateZero(1, gbContext);
-    gbCheckpv(context, nullptr, "Error allocating memory for 'gbContext'");
+    gbAssert(context != nullptr);
+    gbAssert(context->trace != nullptr);
+
+    const gbProcessorRegisterFile* registers =
+        gbGetRegisterFile(context->processor);
+
+    gbTraceRecord record = {
+        .cycle          = gbGetTickCyclesConsumed(context->processor),
+        .address        = address,
+        .opcode         = value,
+        .stackPointer   = registers->stackPointer,
+        .accumulator    = registers->accumulator,
+        .flags          = registers->flags.raw & 0xF0,
+        .type           = type
+    };
 
-    if (
-        (context->memory = gbCreateMemory(context)) == nullptr ||
-        (context->processor = gbCreateProcessor(context)) == nullptr ||
-        (context->timer = gbCreateTimer(context)) == nullptr
-    )
+    if (address <= GB_ROMX_END)
     {
-        gbDestroyContext(context);
-        return nullptr;
+        record.bank = context->romBanks[address >> 14];
     }
 
-    context->engineMode = engineMode;
-    gbInitializeContext(context);
-    return context;
+    gbAppendTraceRecord(context->trace, &record);
 }
 
-bool gbDestroyContext (gbContext* context)
+bool gbCheckInterruptReachable (const gbContext* context)
 {
-    gbCheckqv(context, false);
+    gbAssert(context != nullptr);
+
+    // - Gather the interrupts which are already pending...
+    uint8_t ie = 0x00, iflags = 0x00, tac = 0x00, sc = 0x00;
+    gbReadIE(context->processor, &ie, nullptr);
+    gbReadIF(context->processor, &iflags, nullptr);
+
+    // - ...and those whose source components are still running. The PPU and
+    //   joypad are not emulated yet, so their interrupts can never be
+    //   requested.
+    uint8_t reachable = iflags;
+    gbReadTAC(context->timer, &tac, nullptr);
+    if ((tac & 0b00000100) != 0)
+    {
+        reachable |= (1 << GB_INT_TIMER);
+    }
 
-    // - Un-set userdata pointer to avoid dangling references.
-    context->userdata = nullptr;
+    gbReadSC(context->serial, &sc, nullptr);
+    if ((sc & 0b10000001) == 0b10000001)
+    {
+        reachable |= (1 << GB_INT_SERIAL);
+    }
 
-    gbDestroyMemory(context->memory);
-    gbDestroyProcessor(context->processor);
-    gbDestroyTimer(context->timer);
+    // - Engine Mode's extra interrupts may be requested by the host at any
+    //   time, so they are always considered reachable.
+    uint8_t mask = (context->engineMode == true) ? 0xFF : 0x1F;
+    if (context->engineMode == true)
+    {
+        reachable |= 0xE0;
+    }
 
-    gbDestroy(context);
-    return true;
+    return (ie & reachable & mask) != 0;
 }
 
-bool gbInitializeContext (gbContext* context)
+uint8_t gbSubstituteROMByte (const gbContext* context, uint16_t address,
+    uint8_t original)
 {
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
-
-    return
-        gbInitializeProcessor(context->processor) &&
-        gbInitializeMemory(context->memory) &&
-        gbInitializeTimer(context->timer);
-}
+    gbAssert(context != nullptr);
 
-/* Public Functions - Cartridge ***********************************************/
-
-bool gbAttachCartridge (gbContext* context, gbCartridge* cartridge)
-{
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
+    // - Game Genie codes compare against the byte in ROM, not against what an
+    //   earlier code substituted; the last matching code wins.
+    uint8_t value = original;
+    for (size_t i = 0; i < context->cheatCount; ++i)
+    {
+        const gbCheat* cheat = &context->cheats[i];
+        if (
+            cheat->enabled == true && cheat->format == GB_CF_GAME_GENIE &&
+            cheat->address == address &&
+            (cheat->hasCompare == false || cheat->compare == original)
+        )
+        {
+            value = cheat->value;
+        }
+    }
 
-    // - Attach the cartridge to the context, then re-initialize the context.
-    context->cartridge = cartridge;
-    return gbInitializeContext(context);
+    return value;
 }
 
-/* Public Functions - Context Operation Mode **********************************/
-
-bool gbCheckCGBMode (const gbContext* context, bool* outIsCGBMode)
+void gbMapROMPages (gbContext* context, bool force)
 {
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
-    gbCheckv(outIsCGBMode != nullptr, false,
-        "No valid output pointer provided for CGB mode check.");
-
-    // - If in engine mode, then CGB mode is forced.
-    if (context->engineMode)
-    {
-        *outIsCGBMode = true;
-        return true;
-    }
-
-    // - If no cartridge is attached, then assume non-CGB mode.
-    if (context->cartridge == nullptr)
+    gbAssert(context != nullptr);
+
+    // - Point each page of the ROM area at the bank mapped there, or at its
+    //   shadow copy if a Game Genie code patches it. In reference mode, and
+    //   where the bank cannot be mapped, the pages are left to the general
+    //   path. Unless forced, a half whose bank has not changed is left as it
+    //   is, so that most MBC writes cost two bank lookups and nothing more.
+    const size_t pagesPerBank = GB_ROM_BANK_SIZE / GB_PAGE_SIZE;
+    for (size_t half = 0; half < 2; ++half)
     {
-        *outIsCGBMode = false;
-        return true;
-    }
+        uint16_t address = (uint16_t) (half * GB_ROM_BANK_SIZE);
+        uint16_t bank = 0;
+        if (context->cartridge != nullptr)
+        {
+            gbGetCartridgeROMBank(context->cartridge, address, &bank);
+        }
 
-    // - Check the attached cartridge's header for CGB support/requirement.
-    const gbCartridgeHeader* header = gbGetCartridgeHeader(context->cartridge);
-    gbCheckCartridgeCGBSupport(header, outIsCGBMode, nullptr);
+        if (force == false && bank == context->romBanks[half])
+        {
+            continue;
+        }
 
-    return true;
-}
+        context->romBanks[half] = bank;
+        const uint8_t* window = nullptr;
+        if (context->cartridge != nullptr && context->referenceMode == false)
+        {
+            window = gbGetCartridgeROMWindow(context->cartridge, address);
+        }
 
-bool gbCheckEngineMode (const gbContext* context, bool* outIsEngineMode)
-{
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
-    gbCheckv(outIsEngineMode != nullptr, false,
-        "No valid output pointer provided for engine mode check.");
+        const uint8_t** pages = &context->readPages[half * pagesPerBank];
+        uint64_t cheatPages = context->cheatROMPages[half];
+        for (size_t i = 0; i < pagesPerBank; ++i)
+        {
+            pages[i] = (window != nullptr) ? window + i * GB_PAGE_SIZE : nullptr;
+        }
 
-    *outIsEngineMode = context->engineMode;
-    return true;
-}
+        // - Only the pages patched by a Game Genie code need shadow copies.
+        for (size_t i = 0; window != nullptr && cheatPages != 0 &&
+            i < pagesPerBank; ++i)
+        {
+            if (((cheatPages >> i) & 1) == 0)
+            {
+                continue;
+            }
 
-/* Public Functions - Current Context and Components **************************/
+            size_t page = half * pagesPerBank + i;
+            uint8_t* shadow = context->cheatShadows + page * GB_PAGE_SIZE;
+            memcpy(shadow, pages[i], GB_PAGE_SIZE);
+            for (size_t j = 0; j < context->cheatCount; ++j)
+            {
+                uint16_t cheatAddress = context->cheats[j].address;
+                if ((cheatAddress >> 8) == page)
+                {
+                    shadow[cheatAddress & 0xFF] = gbSubstituteROMByte(context,
+                        cheatAddress, pages[i][cheatAddress & 0xFF]);
+                }
+            }
 
-bool gbMakeContextCurrent (gbContext* context)
-{
-    s_currentContext = context;
-    return (s_currentContext != nullptr);
+            pages[i] = shadow;
+        }
+    }
 }
 
-gbContext* gbGetCurrentContext ()
+void gbMapWorkRAMPages (gbContext* context)
 {
-    return s_currentContext;
-}
+    gbAssert(context != nullptr);
 
-gbMemory* gbGetMemory (const gbContext* context)
-{
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, nullptr,
-        "No valid 'gbContext' provided, and no current context is set.");
+    // - Point each page of WRAM, and of echo RAM outside of engine mode, at
+    //   the bank mapped there, for both reads and writes. In reference mode,
+    //   the pages are left to the general path.
+    for (size_t page = GB_WRAM0_START >> 8; page <= (GB_ECHO_END >> 8); ++page)
+    {
+        uint8_t* target = nullptr;
+        if (
+            context->referenceMode == false &&
+            (page < (GB_ECHO_START >> 8) || context->engineMode == false)
+        )
+        {
+            uint16_t relativeAddress = (uint16_t) (
+                ((page << 8) - GB_WRAM0_START) % GB_WRAM_SIZE);
+            target = gbGetWorkRAMWindow(context->memory, relativeAddress) +
+                (relativeAddress % GB_WRAM_BANK_SIZE);
+        }
 
-    return context->memory;
+        context->readPages[page] = target;
+        context->writePages[page] = target;
+    }
 }
 
-gbProcessor* gbGetProcessor (const gbContext* context)
+bool gbRefreshCheats (gbContext* context)
 {
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, nullptr,
-        "No valid 'gbContext' provided, and no current context is set.");
+    gbAssert(context != nullptr);
+
+    // - Note which ROM pages need shadow copies, and whether any codes need
+    //   applying once per frame.
+    context->cheatROMPages[0] = 0;
+    context->cheatROMPages[1] = 0;
+    context->ramCheatCount = 0;
+    for (size_t i = 0; i < context->cheatCount; ++i)
+    {
+        const gbCheat* cheat = &context->cheats[i];
+        if (cheat->enabled == false)
+        {
+            continue;
+        }
+        else if (cheat->format == GB_CF_GAME_GENIE)
+        {
+            size_t page = cheat->address >> 8;
+            context->cheatROMPages[page >> 6] |= (1ull << (page & 63));
+        }
+        else
+        {
+            context->ramCheatCount++;
+        }
+    }
 
-    return context->processor;
-}
+    bool result = true;
+    if (
+        (context->cheatROMPages[0] | context->cheatROMPages[1]) != 0 &&
+        context->cheatShadows == nullptr
+    )
+    {
+        context->cheatShadows = gbCreate(GB_ROM_SIZE, uint8_t);
+        if (context->cheatShadows == nullptr)
+        {
+            gbLogErrno("Error allocating memory for cheat shadow pages");
+            context->cheatROMPages[0] = 0;
+            context->cheatROMPages[1] = 0;
+            result = false;
+        }
+    }
 
-gbTimer* gbGetTimer (const gbContext* context)
-{
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, nullptr,
-        "No valid 'gbContext' provided, and no current context is set.");
+    if (context->ramCheatCount > 0)
+    {
+        uint64_t cycle = gbGetTickCyclesConsumed(context->processor);
+        context->nextCheatCycle =
+            (cycle / GB_CYCLES_PER_FRAME + 1) * GB_CYCLES_PER_FRAME;
+    }
 
-    return context->timer;
+    gbMapROMPages(context, true);
+    return result;
 }
 
-/* Public Functions - Userdata ************************************************/
-
-bool gbSetUserdata (gbContext* context, void* userdata)
+uint64_t gbGetRunLimit (const gbContext* context, uint64_t end)
 {
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
+    gbAssert(context != nullptr);
 
-    context->userdata = userdata;
-    return true;
+    return (context->ramCheatCount > 0 && context->nextCheatCycle < end) ?
+        context->nextCheatCycle : end;
 }
 
-void* gbGetUserdata (const gbContext* context)
+bool gbCheckBusFilter (const gbContext* context, uint16_t address)
 {
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, nullptr,
-        "No valid 'gbContext' provided, and no current context is set.");
-
-    return context->userdata;
+    return
+        context->busFilter.enabled == false ||
+        (address >= context->busFilter.first && address <= context->busFilter.last);
 }
 
-/* Public Functions - Callbacks ***********************************************/
-
-bool gbSetBusReadCallback (gbContext* context, gbBusReadCallback callback)
+bool gbCheckSelfJump (const gbContext* context,
+    const gbProcessorRegisterFile* registers)
 {
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
+    gbAssert(context != nullptr);
+    gbAssert(registers != nullptr);
+
+    // - Read the instruction around `PC` as a debugger would: through the
+    //   bus override, if set, but without tracing or invoking callbacks.
+    const gbCheckRules rules = { 0 };
+    uint16_t address = registers->programCounter;
+    uint8_t bytes[3] = { 0xFF, 0xFF, 0xFF };
+    for (uint16_t i = 0; i < 3; ++i)
+    {
+        if (
+            context->busReadOverride == nullptr ||
+            context->busReadOverride(context, address + i, &bytes[i]) == false
+        )
+        {
+            gbReadMappedByte(context, address + i, &bytes[i], &rules);
+        }
+    }
 
-    context->busReadCallback = callback;
-    return true;
-}
+    switch (bytes[0])
+    {
+        // - `JR e8` and `JR cc, e8`, with an offset of `-2`.
+        case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+            return bytes[1] == 0xFE;
 
-bool gbSetBusWriteCallback (gbContext* context, gbBusWriteCallback callback)
-{
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
+        // - `JP a16` and `JP cc, a16`, targeting their own address.
+        case 0xC3: case 0xC2: case 0xCA: case 0xD2: case 0xDA:
+            return (uint16_t) (bytes[1] | (bytes[2] << 8)) == address;
 
-    context->busWriteCallback = callback;
-    return true;
+        // - `JP HL`, with `HL` pointing at itself.
+        case 0xE9:
+            return (uint16_t) ((registers->h << 8) | registers->l) == address;
+
+        default:
+            return false;
+    }
 }
 
-/* Public Functions - Ticking *************************************************/
+/* Private Function Definitions - Address Bus *********************************/
 
-bool gbTick (gbContext* context)
+bool gbReadMappedByte (const gbContext* context, uint16_t address,
+    uint8_t* outValue, const gbCheckRules* checkRules)
 {
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
+    gbAssert(context != nullptr);
+    gbAssert(outValue != nullptr);
+    gbAssert(checkRules != nullptr);
 
-    if (context->cartridge == nullptr)
+    // - A page mapped straight to host memory is read directly.
+    const uint8_t* page = context->readPages[address >> 8];
+    if (page != nullptr)
     {
+        *outValue = page[address & 0xFF];
         return true;
     }
 
-    return gbTickProcessor(context->processor);
-}
-
-/* Public Functions - Address Bus *********************************************/
-
-bool gbReadByte (const gbContext* context, uint16_t address, uint8_t* outValue, 
-    const gbCheckRules* rules)
-{
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
-    gbCheckv(outValue != nullptr, false,
-        "No valid output pointer provided for read value.");
-
-    // - Use default check rules if none are provided.
-    const gbCheckRules* checkRules = (rules != nullptr) ?
-        rules : &GB_DEFAULT_CHECK_RULES;
-
     // - Store the read value and result here.
     uint8_t value = 0xFF;
     bool result = false;
@@ -292,6 +444,17 @@ bool gbReadByte (const gbContext* context, uint16_t address, uint8_t* outValue,
         if (context->cartridge != nullptr)
         {
             result = gbReadCartridgeROM(context->cartridge, address, &value);
+
+            // - Game Genie codes are normally made by the page map; only
+            //   unmapped pages, as in reference mode, reach here.
+            size_t cheatPage = address >> 8;
+            if (
+                context->cheatCount > 0 &&
+                ((context->cheatROMPages[cheatPage >> 6] >> (cheatPage & 63)) & 1) != 0
+            )
+            {
+                value = gbSubstituteROMByte(context, address, value);
+            }
         }
     }
 
@@ -306,6 +469,8 @@ bool gbReadByte (const gbContext* context, uint16_t address, uint8_t* outValue,
     {
         if (context->cartridge != nullptr)
         {
+            gbClockCartridgeRTC(context->cartridge,
+                gbGetTickCyclesConsumed(context->processor));
             result = gbReadCartridgeRAM(context->cartridge, 
                 address - GB_EXTRAM_START, &value);
         }
@@ -315,7 +480,7 @@ bool gbReadByte (const gbContext* context, uint16_t address, uint8_t* outValue,
     else if (address >= GB_WRAM0_START && address <= GB_WRAMX_END)
     {
         result = gbReadWorkRAM(context->memory, 
-            address - GB_WRAM0_START, &value, rules);
+            address - GB_WRAM0_START, &value, checkRules);
     }
 
     // - `$E000` - `$FDFF`: Echo RAM (mirror of `$C000` - `$DDFF`)
@@ -386,8 +551,8 @@ bool gbReadByte (const gbContext* context, uint16_t address, uint8_t* outValue,
     switch (address)
     {
         case GB_PR_P1:      break;
-        case GB_PR_SB:      break;
-        case GB_PR_SC:      break;
+        case GB_PR_SB:      result = gbReadSB(context->serial, &value, checkRules); break;
+        case GB_PR_SC:      result = gbReadSC(context->serial, &value, checkRules); break;
         case GB_PR_DIV:     result = gbReadDIV(context->timer, &value, checkRules); break;
         case GB_PR_TIMA:    result = gbReadTIMA(context->timer, &value, checkRules); break;
         case GB_PR_TMA:     result = gbReadTMA(context->timer, &value, checkRules); break;
@@ -448,26 +613,25 @@ bool gbReadByte (const gbContext* context, uint16_t address, uint8_t* outValue,
         default:            break;
     }
 
-    // - If a bus read callback is set, invoke it.
-    if (context->busReadCallback != nullptr)
-    {
-        context->busReadCallback(context, address, value);
-    }
-
     *outValue = value;
-    return true;
+    return result;
 }
 
-bool gbWriteByte (gbContext* context, uint16_t address, uint8_t value, 
-    const gbCheckRules* rules, uint8_t* outActual)
+bool gbWriteMappedByte (gbContext* context, uint16_t address, uint8_t value,
+    const gbCheckRules* checkRules, uint8_t* outActual)
 {
-    gbFallback(context, gbGetCurrentContext());
-    gbCheckv(context != nullptr, false,
-        "No valid 'gbContext' provided, and no current context is set.");
+    gbAssert(context != nullptr);
+    gbAssert(outActual != nullptr);
+    gbAssert(checkRules != nullptr);
 
-    // - Use default check rules if none are provided.
-    const gbCheckRules* checkRules = (rules != nullptr) ?
-        rules : &GB_DEFAULT_CHECK_RULES;
+    // - A page mapped straight to host memory is written directly.
+    uint8_t* page = context->writePages[address >> 8];
+    if (page != nullptr)
+    {
+        page[address & 0xFF] = value;
+        *outActual = value;
+        return true;
+    }
 
     // - Store the actual written value and result here.
     uint8_t actual = 0xFF;
@@ -480,8 +644,21 @@ bool gbWriteByte (gbContext* context, uint16_t address, uint8_t value,
     {
         if (context->cartridge != nullptr)
         {
+#if defined(GB_ENABLE_STATS)
+            uint16_t bankBefore = context->romBanks[1];
+#endif
+
+            gbClockCartridgeRTC(context->cartridge,
+                gbGetTickCyclesConsumed(context->processor));
             result = gbWriteCartridgeROM(context->cartridge, address, value, 
                 &actual);
+            gbMapROMPages(context, false);
+
+#if defined(GB_ENABLE_STATS)
+            gbCountStat(context, mbcWrites, 1);
+            gbCountStat(context, bankSwitches,
+                (bankBefore != context->romBanks[1]) ? 1 : 0);
+#endif
         }
     }
 
@@ -496,6 +673,8 @@ bool gbWriteByte (gbContext* context, uint16_t address, uint8_t value,
     {
         if (context->cartridge != nullptr)
         {
+            gbClockCartridgeRTC(context->cartridge,
+                gbGetTickCyclesConsumed(context->processor));
             result = gbWriteCartridgeRAM(context->cartridge, 
                 address - GB_EXTRAM_START, value, &actual);
         }
@@ -557,8 +736,8 @@ bool gbWriteByte (gbContext* context, uint16_t address, uint8_t value,
     switch (address)
     {
         case GB_PR_P1:      break;
-        case GB_PR_SB:      break;
-        case GB_PR_SC:      break;
+        case GB_PR_SB:      result = gbWriteSB(context->serial, value, &actual, checkRules); break;
+        case GB_PR_SC:      result = gbWriteSC(context->serial, value, &actual, checkRules); break;
         case GB_PR_DIV:     result = gbWriteDIV(context->timer, value, &actual, checkRules); break;
         case GB_PR_TIMA:    result = gbWriteTIMA(context->timer, value, &actual, checkRules); break;
         case GB_PR_TMA:     result = gbWriteTMA(context->timer, value, &actual, checkRules); break;
@@ -612,22 +791,1024 @@ bool gbWriteByte (gbContext* context, uint16_t address, uint8_t value,
         case GB_PR_OCPS:    break;
         case GB_PR_OCPD:    break;
         case GB_PR_OPRI:    break;
-        case GB_PR_SVBK:    result = gbWriteSVBK(context->memory, value, &actual, checkRules); break;
+        case GB_PR_SVBK:
+            result = gbWriteSVBK(context->memory, value, &actual, checkRules);
+            gbMapWorkRAMPages(context);
+            break;
         case GB_PR_PCM12:   break;
         case GB_PR_PCM34:   break;
         case GB_PR_IE:      result = gbWriteIE(context->processor, value, &actual, checkRules); break;
         default:            break;
     }
 
-    // - If a bus write callback is set, invoke it.
-    if (context->busWriteCallback != nullptr)
-    {
-        context->busWriteCallback(context, address, value, actual);
-    }
+    *outActual = actual;
+    return result;
+}
 
-    if (outActual != nullptr)
-    {
-        *outActual = actual;
+bool gbReadCPUByte (const gbContext* context, uint16_t address,
+    uint8_t* outValue)
+{
+    // - The CPU always uses the default rules. The components check their
+    //   rules in their own files, at run time, so this saves only the
+    //   caller's choice of rules, not the checks themselves.
+    return gbReadMappedByte(context, address, outValue,
+        &GB_DEFAULT_CHECK_RULES);
+}
+
+bool gbWriteCPUByte (gbContext* context, uint16_t address, uint8_t value,
+    uint8_t* outActual)
+{
+    return gbWriteMappedByte(context, address, value,
+        &GB_DEFAULT_CHECK_RULES, outActual);
+}
+
+/* Internal Function Definitions **********************************************/
+
+const uint16_t* gbGetROMBankMap (const gbContext* context)
+{
+    gbAssert(context != nullptr);
+
+    return context->romBanks;
+}
+
+/* Public Function Definitions ************************************************/
+
+gbContext* gbCreateContext (bool engineMode)
+{
+    gbContext* context = gbCreateZero(1, gbContext);
+    gbCheckpv(context, nullptr, "Error allocating memory for 'gbContext'");
+
+    if (
+        (context->memory = gbCreateMemory(context)) == nullptr ||
+        (context->processor = gbCreateProcessor(context)) == nullptr ||
+        (context->timer = gbCreateTimer(context)) == nullptr ||
+        (context->serial = gbCreateSerial(context)) == nullptr
+    )
+    {
+        gbDestroyContext(context);
+        return nullptr;
+    }
+
+    context->engineMode = engineMode;
+    gbInitializeContext(context);
+    return context;
+}
+
+bool gbDestroyContext (gbContext* context)
+{
+    gbCheckqv(context, false);
+
+    // - Un-set userdata pointer to avoid dangling references.
+    context->userdata = nullptr;
+
+    gbDestroyMemory(context->memory);
+    gbDestroyProcessor(context->processor);
+    gbDestroyTimer(context->timer);
+    gbDestroySerial(context->serial);
+    gbDestroy(context->cheats);
+    gbDestroy(context->cheatShadows);
+
+    gbDestroy(context);
+    return true;
+}
+
+bool gbInitializeContext (gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    bool result =
+        gbInitializeProcessor(context->processor) &&
+        gbInitializeMemory(context->memory) &&
+        gbInitializeTimer(context->timer) &&
+        gbInitializeSerial(context->serial);
+
+    // - The cartridge may have changed; map its banks and WRAM, and restart the
+    //   frame count for any GameShark codes.
+    gbMapWorkRAMPages(context);
+    gbRefreshCheats(context);
+    return result;
+}
+
+/* Public Functions - Cartridge ***********************************************/
+
+bool gbAttachCartridge (gbContext* context, gbCartridge* cartridge)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    // - Attach the cartridge to the context, then re-initialize the context.
+    context->cartridge = cartridge;
+    return gbInitializeContext(context);
+}
+
+gbCartridge* gbGetCartridge (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->cartridge;
+}
+
+/* Public Functions - Tracing *************************************************/
+
+bool gbAttachTrace (gbContext* context, gbTrace* trace)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    // - The processor keeps its own copy of the pointer, so that an untraced
+    //   instruction costs it no more than a check of its hook mask.
+    context->trace = trace;
+    gbSetProcessorAttachments(context->processor, context->trace,
+        context->coverage, context->profiler);
+    return true;
+}
+
+gbTrace* gbGetTrace (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->trace;
+}
+
+/* Public Functions - Profiling ***********************************************/
+
+bool gbAttachProfiler (gbContext* context, gbProfiler* profiler)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->profiler = profiler;
+    gbSetProcessorAttachments(context->processor, context->trace,
+        context->coverage, context->profiler);
+    return true;
+}
+
+gbProfiler* gbGetProfiler (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->profiler;
+}
+
+bool gbAttachCoverage (gbContext* context, gbCoverage* coverage)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->coverage = coverage;
+    gbSetProcessorAttachments(context->processor, context->trace,
+        context->coverage, context->profiler);
+    return true;
+}
+
+gbCoverage* gbGetCoverage (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->coverage;
+}
+
+/* Public Functions - Statistics **********************************************/
+
+#if defined(GB_ENABLE_STATS)
+
+gbStats* gbGetContextStats (const gbContext* context)
+{
+    gbAssert(context != nullptr);
+
+    // - Counters are bumped from read-only paths such as `gbReadByte`. The
+    //   context itself is never `const`, so casting it away here is safe.
+    return (gbStats*) &context->stats;
+}
+
+#endif
+
+/* Public Functions - Context Operation Mode **********************************/
+
+bool gbCheckCGBMode (const gbContext* context, bool* outIsCGBMode)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(outIsCGBMode != nullptr, false,
+        "No valid output pointer provided for CGB mode check.");
+
+    // - If in engine mode, then CGB mode is forced.
+    if (context->engineMode)
+    {
+        *outIsCGBMode = true;
+        return true;
+    }
+
+    // - If no cartridge is attached, then assume non-CGB mode.
+    if (context->cartridge == nullptr)
+    {
+        *outIsCGBMode = false;
+        return true;
+    }
+
+    // - Check the attached cartridge's header for CGB support/requirement.
+    const gbCartridgeHeader* header = gbGetCartridgeHeader(context->cartridge);
+    gbCheckCartridgeCGBSupport(header, outIsCGBMode, nullptr);
+
+    return true;
+}
+
+bool gbCheckEngineMode (const gbContext* context, bool* outIsEngineMode)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(outIsEngineMode != nullptr, false,
+        "No valid output pointer provided for engine mode check.");
+
+    *outIsEngineMode = context->engineMode;
+    return true;
+}
+
+bool gbSetReferenceMode (gbContext* context, bool referenceMode)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->referenceMode = referenceMode;
+    gbMapROMPages(context, true);
+    gbMapWorkRAMPages(context);
+    return true;
+}
+
+bool gbCheckReferenceMode (const gbContext* context, bool* outIsReferenceMode)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(outIsReferenceMode != nullptr, false,
+        "No valid output pointer provided for reference mode check.");
+
+    *outIsReferenceMode = context->referenceMode;
+    return true;
+}
+
+bool gbHashContextMemory (const gbContext* context, uint64_t* outHash)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(outHash != nullptr, false, "No valid output pointer provided for hash.");
+
+    // - Where the bus shows all of work RAM, as on the DMG, hash it and high
+    //   RAM as the CPU sees them, through two block reads, rather than every
+    //   bank the memory component can hold. The CGB's and engine mode's banks
+    //   out of view are hashed from the memory component.
+    uint64_t hash = 0;
+    bool isCGBMode = false;
+    gbCheckCGBMode(context, &isCGBMode);
+    if (isCGBMode == true || context->engineMode == true)
+    {
+        if (gbHashMemory(context->memory, 0, &hash) == false)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        uint8_t ram[GB_WRAM_SIZE + GB_HRAM_SIZE];
+        if (
+            gbReadBlock(context, GB_WRAM0_START, GB_WRAM_SIZE, ram,
+                GB_BF_PEEK) == false ||
+            gbReadBlock(context, GB_HRAM_START, GB_HRAM_SIZE,
+                ram + GB_WRAM_SIZE, GB_BF_PEEK) == false
+        )
+        {
+            return false;
+        }
+
+        hash = gbHash64(ram, sizeof(ram), 0);
+    }
+
+    if (context->cartridge != nullptr)
+    {
+        return gbHashCartridgeRAM(context->cartridge, hash, outHash);
+    }
+
+    *outHash = hash;
+    return true;
+}
+
+/* Public Functions - Current Context and Components **************************/
+
+bool gbMakeContextCurrent (gbContext* context)
+{
+    s_currentContext = context;
+    return (s_currentContext != nullptr);
+}
+
+gbContext* gbGetCurrentContext ()
+{
+    return s_currentContext;
+}
+
+gbMemory* gbGetMemory (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->memory;
+}
+
+gbProcessor* gbGetProcessor (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->processor;
+}
+
+gbTimer* gbGetTimer (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->timer;
+}
+
+gbSerial* gbGetSerial (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->serial;
+}
+
+/* Public Functions - Userdata ************************************************/
+
+bool gbSetUserdata (gbContext* context, void* userdata)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->userdata = userdata;
+    return true;
+}
+
+void* gbGetUserdata (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, nullptr,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    return context->userdata;
+}
+
+/* Public Functions - Callbacks ***********************************************/
+
+bool gbSetBusReadCallback (gbContext* context, gbBusReadCallback callback)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->busReadCallback = callback;
+    context->busHooks = (context->busHooks & ~GB_HE_BUS_READ) |
+        ((callback != nullptr) ? GB_HE_BUS_READ : GB_HE_NONE);
+    return true;
+}
+
+bool gbSetBusWriteCallback (gbContext* context, gbBusWriteCallback callback)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->busWriteCallback = callback;
+    context->busHooks = (context->busHooks & ~GB_HE_BUS_WRITE) |
+        ((callback != nullptr) ? GB_HE_BUS_WRITE : GB_HE_NONE);
+    return true;
+}
+
+bool gbSetBusCallbackFilter (gbContext* context, const gbAddressFilter* filter)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->busFilter = (filter != nullptr) ? *filter : (gbAddressFilter) { 0 };
+    return true;
+}
+
+bool gbSetHooks (gbContext* context, const gbHooks* hooks)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(context->processor != nullptr, false,
+        "The 'gbContext' has no valid 'gbProcessor'.");
+
+    const gbHooks none = { 0 };
+    if (hooks == nullptr)
+    {
+        hooks = &none;
+    }
+
+    // - Every argument is checked above, so that nothing below can fail and
+    //   leave the hooks half-set.
+    uint8_t events = hooks->events;
+    context->busReadCallback = (events & GB_HE_BUS_READ) ?
+        hooks->busRead : nullptr;
+    context->busWriteCallback = (events & GB_HE_BUS_WRITE) ?
+        hooks->busWrite : nullptr;
+    context->busFilter = hooks->busFilter;
+    context->busHooks =
+        ((context->busReadCallback != nullptr) ? GB_HE_BUS_READ : GB_HE_NONE) |
+        ((context->busWriteCallback != nullptr) ? GB_HE_BUS_WRITE : GB_HE_NONE);
+    gbSetProcessorHooks(context->processor, hooks);
+    return true;
+}
+
+bool gbSetBusReadOverride (gbContext* context, gbBusReadOverride override)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->busReadOverride = override;
+    return true;
+}
+
+bool gbSetBusWriteOverride (gbContext* context, gbBusWriteOverride override)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->busWriteOverride = override;
+    return true;
+}
+
+/* Public Functions - Ticking *************************************************/
+
+bool gbTick (gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    if (context->cartridge == nullptr)
+    {
+        return true;
+    }
+
+    return gbTickProcessor(context->processor);
+}
+
+bool gbRun (gbContext* context, uint64_t tickCycles, gbStopReason* outReason)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    if (context->cartridge == nullptr)
+    {
+        if (outReason != nullptr)
+        {
+            *outReason = GB_SR_NO_CARTRIDGE;
+        }
+
+        return true;
+    }
+
+    gbStopReason reason = GB_SR_TICK_BUDGET;
+    bool result = true;
+
+    gbProcessor* processor = context->processor;
+    const gbProcessorRegisterFile* registers = gbGetRegisterFile(processor);
+    uint64_t start = gbGetTickCyclesConsumed(processor);
+    uint64_t end = (tickCycles > UINT64_MAX - start) ?
+        UINT64_MAX : start + tickCycles;
+    uint64_t limit = gbGetRunLimit(context, end);
+    context->stopRequested = false;
+
+#if defined(GB_ENABLE_STATS)
+    struct timespec hostStart, hostEnd;
+    timespec_get(&hostStart, TIME_UTC);
+#endif
+
+    while (true)
+    {
+        // - The limit is the end of the budget, or the next frame boundary if
+        //   GameShark codes are enabled; either way, this is the only check
+        //   made per instruction.
+        uint64_t cycle = gbGetTickCyclesConsumed(processor);
+        if (cycle >= limit)
+        {
+            if (context->ramCheatCount > 0 && cycle >= context->nextCheatCycle)
+            {
+                gbApplyCheats(context);
+            }
+
+            if (cycle >= end)
+            {
+                break;
+            }
+
+            limit = gbGetRunLimit(context, end);
+        }
+
+        // - Note where this instruction starts, so that a jump to itself can be
+        //   recognized once it completes.
+        uint16_t programCounter = registers->programCounter;
+        uint16_t stackPointer = registers->stackPointer;
+
+        // - An instruction run just after the `HALT` bug is fetched without
+        //   advancing `PC`, so it may leave `PC` where it was without being a
+        //   jump at all.
+        bool haltBug = false;
+        gbCheckForHaltBug(processor, &haltBug);
+
+        if (gbTickProcessor(processor) == false)
+        {
+            reason = GB_SR_ERROR;
+            result = false;
+            break;
+        }
+
+        if (context->stopRequested == true)
+        {
+            context->stopRequested = false;
+            reason = GB_SR_REQUESTED;
+            break;
+        }
+
+        // - `STOP` is only left by a joypad press, and no joypad is connected.
+        bool stopped = false, halted = false;
+        gbCheckStopState(processor, &stopped);
+        if (stopped == true)
+        {
+            reason = GB_SR_STOP;
+            break;
+        }
+
+        // - `HALT` is left once any interrupt in `IE` becomes pending, whether
+        //   or not `IME` is set.
+        gbCheckHaltState(processor, &halted);
+        if (halted == true)
+        {
+            if (gbCheckInterruptReachable(context) == false)
+            {
+                reason = GB_SR_HALT;
+                break;
+            }
+
+            continue;
+        }
+
+        // - An instruction which leaves `PC` and `SP` as they were may be a
+        //   jump to itself; it is one if it is `JR -2`, or `JP a16` or `JP HL`
+        //   targeting its own address, or a conditional form of these whose
+        //   condition held. Only an interrupt can break such a loop.
+        if (
+            haltBug == false &&
+            registers->programCounter == programCounter &&
+            registers->stackPointer == stackPointer &&
+            gbCheckSelfJump(context, registers) == true
+        )
+        {
+            bool ime = false, imePending = false;
+            gbCheckInterruptMasterEnabled(processor, &ime);
+            gbCheckInterruptMasterPending(processor, &imePending);
+            if (
+                (ime == false && imePending == false) ||
+                gbCheckInterruptReachable(context) == false
+            )
+            {
+                reason = GB_SR_SELF_JUMP;
+                break;
+            }
+        }
+    }
+
+#if defined(GB_ENABLE_STATS)
+    timespec_get(&hostEnd, TIME_UTC);
+    gbCountStat(context, runNanoseconds,
+        (uint64_t) (hostEnd.tv_sec - hostStart.tv_sec) * 1000000000ull +
+        (uint64_t) hostEnd.tv_nsec - (uint64_t) hostStart.tv_nsec);
+#endif
+
+    if (outReason != nullptr)
+    {
+        *outReason = reason;
+    }
+
+    return result;
+}
+
+bool gbRequestStop (gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->stopRequested = true;
+    return true;
+}
+
+const char* gbStringifyStopReason (gbStopReason reason)
+{
+    switch (reason)
+    {
+        case GB_SR_TICK_BUDGET:     return "tick-budget";
+        case GB_SR_REQUESTED:       return "requested";
+        case GB_SR_ERROR:           return "error";
+        case GB_SR_NO_CARTRIDGE:    return "no-cartridge";
+        case GB_SR_SELF_JUMP:       return "self-jump";
+        case GB_SR_HALT:            return "halt";
+        case GB_SR_STOP:            return "stop";
+        default:                    return "unknown";
+    }
+}
+
+/* Public Functions - Cheats **************************************************/
+
+bool gbAddCheat (gbContext* context, const char* code)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    gbCheat cheat;
+    gbCheckqv(gbParseCheat(code, &cheat), false);
+
+    if (context->cheatCount == context->cheatCapacity)
+    {
+        size_t capacity = (context->cheatCapacity > 0) ?
+            context->cheatCapacity * 2 : 8;
+        gbCheat* cheats = gbResize(context->cheats, capacity, gbCheat);
+        gbCheckpv(cheats != nullptr, false,
+            "Error allocating memory for cheat codes");
+
+        context->cheats = cheats;
+        context->cheatCapacity = capacity;
+    }
+
+    context->cheats[context->cheatCount++] = cheat;
+    if (gbRefreshCheats(context) == false)
+    {
+        context->cheatCount--;
+        gbRefreshCheats(context);
+        return false;
+    }
+
+    return true;
+}
+
+bool gbRemoveCheat (gbContext* context, size_t index)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(index < context->cheatCount, false,
+        "Cheat index %zu is out of range.", index);
+
+    memmove(&context->cheats[index], &context->cheats[index + 1],
+        (context->cheatCount - index - 1) * sizeof(gbCheat));
+    context->cheatCount--;
+    gbRefreshCheats(context);
+    return true;
+}
+
+bool gbClearCheats (gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    context->cheatCount = 0;
+    gbRefreshCheats(context);
+    return true;
+}
+
+bool gbSetCheatEnabled (gbContext* context, size_t index, bool enabled)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(index < context->cheatCount, false,
+        "Cheat index %zu is out of range.", index);
+
+    if (context->cheats[index].enabled == enabled)
+    {
+        return true;
+    }
+
+    context->cheats[index].enabled = enabled;
+    return gbRefreshCheats(context);
+}
+
+size_t gbGetCheatCount (const gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckqv(context, 0);
+
+    return context->cheatCount;
+}
+
+const gbCheat* gbGetCheat (const gbContext* context, size_t index)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckqv(context, nullptr);
+    gbCheckqv(index < context->cheatCount, nullptr);
+
+    return &context->cheats[index];
+}
+
+bool gbApplyCheats (gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    uint64_t cycle = gbGetTickCyclesConsumed(context->processor);
+    context->nextCheatCycle =
+        (cycle / GB_CYCLES_PER_FRAME + 1) * GB_CYCLES_PER_FRAME;
+
+    // - Write each code's value as the CPU would, switching in the WRAM bank
+    //   it names for the write, if any.
+    uint8_t actual = 0x00;
+    for (size_t i = 0; i < context->cheatCount && context->ramCheatCount > 0; ++i)
+    {
+        const gbCheat* cheat = &context->cheats[i];
+        if (cheat->enabled == false || cheat->format != GB_CF_GAMESHARK)
+        {
+            continue;
+        }
+
+        if (cheat->bank == 0)
+        {
+            gbWriteCPUByte(context, cheat->address, cheat->value, &actual);
+            continue;
+        }
+
+        uint8_t svbk = 0x00;
+        gbReadCPUByte(context, GB_PR_SVBK, &svbk);
+        gbWriteCPUByte(context, GB_PR_SVBK, cheat->bank, &actual);
+        gbWriteCPUByte(context, cheat->address, cheat->value, &actual);
+        gbWriteCPUByte(context, GB_PR_SVBK, svbk, &actual);
+    }
+
+    return true;
+}
+
+/* Public Functions - Address Bus *********************************************/
+
+bool gbReadByte (const gbContext* context, uint16_t address, uint8_t* outValue, 
+    const gbCheckRules* rules)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(outValue != nullptr, false,
+        "No valid output pointer provided for read value.");
+
+    // - If a bus read override is set and claims this address, it supplies
+    //   the value in place of the memory map.
+    uint8_t value = 0xFF;
+    if (
+        context->busReadOverride == nullptr ||
+        context->busReadOverride(context, address, &value) == false
+    )
+    {
+        // - The CPU passes no rules, and reads with the default ones; any
+        //   others, as from a debugger, are passed along as given.
+        if (rules == nullptr)
+        {
+            gbReadCPUByte(context, address, &value);
+        }
+        else
+        {
+            gbReadMappedByte(context, address, &value, rules);
+        }
+    }
+
+    // - If tracing bus accesses, record this read.
+    if (
+        context->trace != nullptr &&
+        gbCheckTraceFlag(context->trace, GB_TF_BUS_ACCESSES) == true
+    )
+    {
+        gbTraceBusAccess(context, GB_TRT_BUS_READ, address, value);
+    }
+
+    // - If a bus read callback is set, and the address passes its filter,
+    //   invoke it.
+    gbCountStat(context, busReads[gbGetBusRegion(address)], 1);
+    if (
+        (context->busHooks & GB_HE_BUS_READ) != 0 &&
+        gbCheckBusFilter(context, address) == true
+    )
+    {
+        gbCountStat(context, busCallbacks, 1);
+        context->busReadCallback(context, address, value);
+    }
+
+    *outValue = value;
+    return true;
+}
+
+bool gbWriteByte (gbContext* context, uint16_t address, uint8_t value, 
+    const gbCheckRules* rules, uint8_t* outActual)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+    // - If a bus write override is set and claims this address, it absorbs
+    //   the write in place of the memory map.
+    uint8_t actual = value;
+    if (
+        context->busWriteOverride == nullptr ||
+        context->busWriteOverride(context, address, value) == false
+    )
+    {
+        if (rules == nullptr)
+        {
+            gbWriteCPUByte(context, address, value, &actual);
+        }
+        else
+        {
+            gbWriteMappedByte(context, address, value, rules, &actual);
+        }
+    }
+
+    // - If tracing bus accesses, record this write.
+    if (
+        context->trace != nullptr &&
+        gbCheckTraceFlag(context->trace, GB_TF_BUS_ACCESSES) == true
+    )
+    {
+        gbTraceBusAccess(context, GB_TRT_BUS_WRITE, address, value);
+    }
+
+    // - Likewise, for the bus write callback.
+    gbCountStat(context, busWrites[gbGetBusRegion(address)], 1);
+    if (
+        (context->busHooks & GB_HE_BUS_WRITE) != 0 &&
+        gbCheckBusFilter(context, address) == true
+    )
+    {
+        gbCountStat(context, busCallbacks, 1);
+        context->busWriteCallback(context, address, value, actual);
+    }
+
+    if (outActual != nullptr)
+    {
+        *outActual = actual;
+    }
+
+    return true;
+}
+
+bool gbReadBlock (const gbContext* context, uint16_t address, size_t length,
+    uint8_t* outBuffer, uint8_t flags)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(outBuffer != nullptr || length == 0, false,
+        "No valid output buffer provided.");
+    gbCheckv(address + length <= 0x10000, false,
+        "A block of %zu bytes at '$%04X' runs past the end of the bus.",
+        length, address);
+
+    // - Read a page at a time; every byte of a page lies in the same area.
+    for (size_t offset = 0; offset < length; )
+    {
+        size_t current = address + offset;
+        size_t span = GB_PAGE_SIZE - (current % GB_PAGE_SIZE);
+        if (span > length - offset) { span = length - offset; }
+
+        const uint8_t* page = context->readPages[current >> 8];
+        if (page != nullptr)
+        {
+            memcpy(outBuffer + offset, page + (current % GB_PAGE_SIZE), span);
+        }
+        else if (
+            (flags & GB_BF_PEEK) != 0 &&
+            current >= GB_EXTRAM_START && current <= GB_EXTRAM_END
+        )
+        {
+            // - A peek reads cartridge RAM, or the RTC register mapped there,
+            //   without bringing the clock up to date first.
+            for (size_t i = 0; i < span; ++i)
+            {
+                outBuffer[offset + i] = 0xFF;
+                if (context->cartridge != nullptr)
+                {
+                    gbReadCartridgeRAM(context->cartridge,
+                        (uint16_t) (current + i - GB_EXTRAM_START),
+                        &outBuffer[offset + i]);
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < span; ++i)
+            {
+                gbReadCPUByte(context, (uint16_t) (current + i),
+                    &outBuffer[offset + i]);
+            }
+        }
+
+        offset += span;
+    }
+
+    return true;
+}
+
+bool gbWriteBlock (gbContext* context, uint16_t address, size_t length,
+    const uint8_t* buffer, uint8_t flags)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(buffer != nullptr || length == 0, false,
+        "No valid input buffer provided.");
+    gbCheckv(address + length <= 0x10000, false,
+        "A block of %zu bytes at '$%04X' runs past the end of the bus.",
+        length, address);
+
+    // - Write a page at a time; every byte of a page lies in the same area.
+    //   Pages are looked up as they are reached, since a write to `SVBK`
+    //   remaps WRAM.
+    bool peek = (flags & GB_BF_PEEK) != 0;
+    uint8_t actual = 0x00;
+    for (size_t offset = 0; offset < length; )
+    {
+        size_t current = address + offset;
+        size_t span = GB_PAGE_SIZE - (current % GB_PAGE_SIZE);
+        if (span > length - offset) { span = length - offset; }
+
+        uint8_t* page = context->writePages[current >> 8];
+        if (page != nullptr)
+        {
+            memcpy(page + (current % GB_PAGE_SIZE), buffer + offset, span);
+        }
+        else if (peek == true && current <= GB_ROMX_END)
+        {
+            // - A poke leaves the cartridge's bank registers alone.
+        }
+        else if (
+            peek == true &&
+            current >= GB_EXTRAM_START && current <= GB_EXTRAM_END
+        )
+        {
+            for (size_t i = 0; i < span && context->cartridge != nullptr; ++i)
+            {
+                gbWriteCartridgeRAM(context->cartridge,
+                    (uint16_t) (current + i - GB_EXTRAM_START),
+                    buffer[offset + i], &actual);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < span; ++i)
+            {
+                // - A poke leaves the I/O registers alone, writing only HRAM
+                //   on their page.
+                uint16_t target = (uint16_t) (current + i);
+                if (
+                    peek == true &&
+                    ((target >= GB_PR_P1 && target < GB_HRAM_START) ||
+                        target == GB_PR_IE)
+                )
+                {
+                    continue;
+                }
+
+                gbWriteCPUByte(context, target, buffer[offset + i], &actual);
+            }
+        }
+
+        offset += span;
     }
 
     return true;
@@ -67,6 +67,16 @@ typedef struct gbProcessor gbProcessor;
  */
 typedef struct gbTimer gbTimer;
 
+/**
+ * @brief   Defines an opaque structure representing the Game Boy Emulator Core's
+ *          internal serial port component.
+ * 
+ * This structure encapsulates the serial port's registers and transfer state.
+ * No link partner is emulated; transfers clocked internally complete as if the
+ * link cable were disconnected.
+ */
+typedef struct gbSerial gbSerial;
+
 /**
  * @brief   Defines an opaque structure representing the Game Boy Emulator Core's
  *          internal pixel processing unit (PPU) component (henceforth, the
@@ -77,6 +87,48 @@ typedef struct gbTimer gbTimer;
  */
 typedef struct gbRenderer gbRenderer;
 
+/**
+ * @brief   Defines an opaque structure representing a binary execution trace
+ *          buffer.
+ *
+ * A trace buffer is a preallocated ring buffer of fixed-size records, each
+ * describing one executed instruction (and, optionally, one bus access). Once
+ * the buffer is full, the oldest records are overwritten by the newest ones,
+ * so recording never allocates memory nor performs any I/O.
+ *
+ * Like the cartridge, the trace buffer is an external component which is
+ * attached to the Game Boy Emulator Core context. Its memory is not managed by
+ * the core context itself, and will need to be freed separately when no longer
+ * needed.
+ */
+typedef struct gbTrace gbTrace;
+
+/**
+ * @brief   Defines an opaque structure representing a guest code profiler.
+ *
+ * A profiler accumulates the T-cycles spent at each instruction address, per
+ * cartridge ROM bank, and attributes them to symbols loaded from an RGBDS
+ * `.sym` file. Like the trace buffer, it is attached to the Game Boy Emulator
+ * Core context, and its memory is managed separately.
+ */
+typedef struct gbProfiler gbProfiler;
+
+/**
+ * @brief   Defines an opaque structure representing an execution coverage
+ *          bitmap.
+ *
+ * A coverage bitmap keeps one bit per cartridge ROM byte, set when that byte
+ * is fetched as an opcode. Like the profiler, it is attached to the Game Boy
+ * Emulator Core context, and its memory is managed separately.
+ */
+typedef struct gbCoverage gbCoverage;
+
+/**
+ * @brief   Defines a structure representing one decoded cheat code. See
+ *          `GB/Cheat.h`.
+ */
+typedef struct gbCheat gbCheat;
+
 /**
  * @brief   Defines a pointer to a function called by the Game Boy Emulator Core
  *          context when a read operation is attempted on its emulated, 16-bit
@@ -104,6 +156,104 @@ typedef void (*gbBusReadCallback) (const gbContext* context, uint16_t address,
 typedef void (*gbBusWriteCallback) (gbContext* context, uint16_t address,
     uint8_t value, uint8_t actual);
 
+/**
+ * @brief   Defines a pointer to a function which may take over a read from the
+ *          Game Boy Emulator Core context's emulated address bus, in place of
+ *          its memory map (e.g., to run code against a flat test bus).
+ * 
+ * @param   context     A pointer to the @a `gbContext` attempting the read operation.
+ * @param   address     The 16-bit, absolute address from which data is being read.
+ * @param   outValue    A pointer to a byte variable where the value read should
+ *                      be stored, if the override handles the read.
+ * 
+ * @return  `true` if the override handled the read; `false` to let the memory
+ *          map handle it as usual.
+ */
+typedef bool (*gbBusReadOverride) (const gbContext* context, uint16_t address,
+    uint8_t* outValue);
+
+/**
+ * @brief   Defines a pointer to a function which may take over a write to the
+ *          Game Boy Emulator Core context's emulated address bus, in place of
+ *          its memory map.
+ * 
+ * @param   context     A pointer to the @a `gbContext` attempting the write operation.
+ * @param   address     The 16-bit, absolute address to which data is being written.
+ * @param   value       The byte value being written to the bus.
+ * 
+ * @return  `true` if the override handled the write; `false` to let the memory
+ *          map handle it as usual.
+ */
+typedef bool (*gbBusWriteOverride) (gbContext* context, uint16_t address,
+    uint8_t value);
+
+/**
+ * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
+ *          CPU processor component when a new instruction is fetched from memory
+ *          and is about to be executed.
+ * 
+ * @param   context         A pointer to the @a `gbContext` whose processor is
+ *                          fetching the instruction.
+ * @param   address         The 16-bit, absolute address from which the instruction's
+ *                          opcode (and any prefix bytes) were fetched.
+ * @param   opcode          A 16-bit value, the lower byte of which contains the
+ *                          instruction's opcode. If the instruction is a prefixed
+ *                          instruction (i.e., uses the `0xCB` prefix), the upper
+ *                          byte contains the prefix byte (`0xCB`); otherwise, it
+ *                          is `0x00`.
+ * 
+ * @return  The callback function can return `true` to allow the @a `gbProcessor`
+ *          to proceed with executing the fetched instruction as normal, or `false`
+ *          to skip execution of the instruction (effectively treating it as a
+ *          `NOP` instruction). This can be useful for debugging, logging, or
+ *          modifying the behavior of certain instructions at runtime.
+ */
+typedef bool (*gbInstructionFetchCallback) (gbContext* context,
+    uint16_t address, uint16_t opcode);
+
+/**
+ * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
+ *          CPU processor component immediately after an instruction has been
+ *          executed.
+ *
+ * @param   context         A pointer to the @a `gbContext` whose processor executed the
+ *                          instruction.
+ * @param   address         The 16-bit, absolute address from which the instruction's
+ *                          opcode (and any prefix bytes) were fetched.
+ * @param   opcode          A 16-bit value, the lower byte of which contains the
+ *                          instruction's opcode. If the instruction is a prefixed
+ *                          instruction (i.e., uses the `0xCB` prefix), the upper
+ *                          byte contains the prefix byte (`0xCB`); otherwise, it
+ *                          is `0x00`.
+ * @param   success         A boolean value indicating whether the instruction
+ *                          executed successfully, without errors.
+ */
+typedef void (*gbInstructionExecuteCallback) (gbContext* context,
+    uint16_t address, uint16_t opcode, bool success);
+
+/**
+ * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
+ *          CPU processor component when it services an interrupt.
+ * 
+ * @param   context         A pointer to the @a `gbContext` whose processor is servicing
+ *                          the interrupt.
+ * @param   interrupt       The type of interrupt being serviced.
+ */
+typedef void (*gbInterruptServiceCallback) (gbContext* context,
+    uint8_t interrupt);
+
+/**
+ * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
+ *          CPU processor component in response to executing one of the `RST`
+ *          restart vector instructions.
+ * 
+ * @param   context         A pointer to the @a `gbContext` whose processor is invoking
+ *                          the restart vector. 
+ * @param   restartVector   The restart vector address being invoked.
+ */
+typedef void (*gbRestartVectorCallback) (gbContext* context,
+    uint16_t restartVector);
+
 /* Public Constants and Enumerations ******************************************/
 
 /**
@@ -142,6 +292,18 @@ typedef void (*gbBusWriteCallback) (gbContext* context, uint16_t address,
 #define GB_HRAM_END         0xFFFE
 #define GB_HRAM_SIZE        0x007F
 
+/**
+ * @brief   Defines the size of the pages in which the context maps its address
+ *          space straight to host memory, and the number of such pages.
+ */
+#define GB_PAGE_SIZE        0x0100
+#define GB_PAGE_COUNT       0x0100
+
+/**
+ * @brief   Defines the number of T-cycles in one frame of the Game Boy's LCD.
+ */
+#define GB_CYCLES_PER_FRAME 70224ull
+
 /**
  * @brief   Enumerates specific addresses in the Game Boy's 16-bit address
  *          space which are mapped to port registers provided by the Game Boy's
@@ -211,6 +373,47 @@ typedef enum gbPortRegister : uint16_t
     GB_PR_IE    = 0xFFFF    /** @brief `IE` - CPU Interrupt Enable (R/W) */
 } gbPortRegister;
 
+/**
+ * @brief   Enumerates the reasons for which @a `gbRun` can stop running a Game
+ *          Boy Emulator Core context.
+ */
+typedef enum gbStopReason : uint8_t
+{
+    GB_SR_TICK_BUDGET   = 0x00, /** @brief The requested number of T-cycles was consumed. */
+    GB_SR_REQUESTED     = 0x01, /** @brief A stop was requested with @a `gbRequestStop`. */
+    GB_SR_ERROR         = 0x02, /** @brief The processor reported an error. */
+    GB_SR_NO_CARTRIDGE  = 0x03, /** @brief No cartridge is attached, so nothing can run. */
+    GB_SR_SELF_JUMP     = 0x04, /** @brief The processor is jumping to itself, and no interrupt can break the loop. */
+    GB_SR_HALT          = 0x05, /** @brief The processor is halted, and no interrupt can wake it. */
+    GB_SR_STOP          = 0x06  /** @brief The processor is stopped, and no joypad is connected to wake it. */
+} gbStopReason;
+
+/**
+ * @brief   Enumerates the flags which change how @a `gbReadBlock` and
+ *          @a `gbWriteBlock` access the address bus.
+ */
+typedef enum gbBlockFlags : uint8_t
+{
+    GB_BF_NONE  = 0x00, /** @brief Access each byte as the CPU would, with its side effects. */
+    GB_BF_PEEK  = 0x01  /** @brief Leave the hardware as it is: reads do not clock the RTC, and writes skip cartridge ROM and I/O registers. */
+} gbBlockFlags;
+
+/**
+ * @brief   Enumerates the events which a context's callbacks can hook, as bits
+ *          of the mask given to @a `gbSetHooks`.
+ */
+typedef enum gbHookEvent : uint8_t
+{
+    GB_HE_NONE                  = 0x00,
+    GB_HE_BUS_READ              = 0x01, /** @brief A read from the address bus. */
+    GB_HE_BUS_WRITE             = 0x02, /** @brief A write to the address bus. */
+    GB_HE_INSTRUCTION_FETCH     = 0x04, /** @brief An instruction fetched, before it executes. */
+    GB_HE_INSTRUCTION_EXECUTE   = 0x08, /** @brief An instruction executed. */
+    GB_HE_INTERRUPT_SERVICE     = 0x10, /** @brief An interrupt serviced. */
+    GB_HE_RESTART_VECTOR        = 0x20, /** @brief An `RST` instruction executed. */
+    GB_HE_ALL                   = 0x3F
+} gbHookEvent;
+
 /* Public Unions and Structures ***********************************************/
 
 /**
@@ -235,6 +438,34 @@ typedef union gbCheckRules
     uint8_t value;
 } gbCheckRules;
 
+/**
+ * @brief   Defines a range of addresses to which a context's callbacks are
+ *          limited. A zeroed filter passes every address.
+ */
+typedef struct gbAddressFilter
+{
+    bool        enabled;    /** @brief Whether the range applies at all. */
+    uint16_t    first;      /** @brief The first address in the range. */
+    uint16_t    last;       /** @brief The last address in the range, inclusive. */
+} gbAddressFilter;
+
+/**
+ * @brief   Defines a structure describing every callback of a context at once,
+ *          for @a `gbSetHooks`.
+ */
+typedef struct gbHooks
+{
+    uint8_t                         events;             /** @brief The `GB_HE_*` events to be hooked. The callbacks of the rest are cleared. */
+    gbAddressFilter                 busFilter;          /** @brief Limits the bus callbacks to accesses within a range of addresses. */
+    gbAddressFilter                 instructionFilter;  /** @brief Limits the instruction callbacks to opcodes fetched from a range of addresses. */
+    gbBusReadCallback               busRead;
+    gbBusWriteCallback              busWrite;
+    gbInstructionFetchCallback      instructionFetch;
+    gbInstructionExecuteCallback    instructionExecute;
+    gbInterruptServiceCallback      interruptService;
+    gbRestartVectorCallback         restartVector;
+} gbHooks;
+
 /* Public Function Declarations ***********************************************/
 
 /**
@@ -300,6 +531,132 @@ GB_API bool gbInitializeContext (gbContext* context);
 GB_API bool gbAttachCartridge (gbContext* context,
     gbCartridge* cartridge);
 
+/**
+ * @brief   Retrieves the cartridge device attached to the given Game Boy
+ *          Emulator Core context.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure from which to
+ *                      retrieve the cartridge. Pass `nullptr` to use the
+ *                      current context.
+ * 
+ * @return  If a cartridge is attached, returns a pointer to the attached
+ *          @a `gbCartridge`.
+ *          If no cartridge is attached, or if no context is provided (i.e.,
+ *          `nullptr`) and no current context exists, returns `nullptr`.
+ */
+GB_API gbCartridge* gbGetCartridge (const gbContext* context);
+
+/* Public Function Declarations - Tracing *************************************/
+
+/**
+ * @brief   Attaches a trace buffer to the given Game Boy Emulator Core context.
+ * 
+ * While a trace buffer is attached, the context's processor records every
+ * executed instruction into it, as does the context's address bus with every
+ * access, if the trace buffer was created with the @a `GB_TF_BUS_ACCESSES`
+ * flag. Unlike attaching a cartridge, attaching a trace buffer does not reset
+ * the context.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure to which to
+ *                      attach the trace buffer. Pass `nullptr` to use the
+ *                      current context.
+ * @param   trace       A pointer to the @a `gbTrace` structure to be attached.
+ *                      Pass `nullptr` to detach any currently attached trace
+ *                      buffer, which disables tracing.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbAttachTrace (gbContext* context, gbTrace* trace);
+
+/**
+ * @brief   Retrieves the trace buffer attached to the given Game Boy Emulator
+ *          Core context.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure from which to
+ *                      retrieve the trace buffer. Pass `nullptr` to use the
+ *                      current context.
+ * 
+ * @return  If a trace buffer is attached, returns a pointer to it.
+ *          If no trace buffer is attached, or if no context is provided (i.e.,
+ *          `nullptr`) and no current context exists, returns `nullptr`.
+ */
+GB_API gbTrace* gbGetTrace (const gbContext* context);
+
+/* Public Function Declarations - Profiling ***********************************/
+
+/**
+ * @brief   Attaches a guest code profiler to the given Game Boy Emulator Core
+ *          context.
+ *
+ * While a profiler is attached, the context's processor counts the T-cycles
+ * taken by every executed instruction against its address, and the T-cycles
+ * spent in the `HALT` state separately. Attaching a profiler does not reset
+ * the context.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure to which to
+ *                      attach the profiler. Pass `nullptr` to use the current
+ *                      context.
+ * @param   profiler    A pointer to the @a `gbProfiler` structure to be
+ *                      attached. Pass `nullptr` to detach any currently
+ *                      attached profiler, which disables profiling.
+ *
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbAttachProfiler (gbContext* context, gbProfiler* profiler);
+
+/**
+ * @brief   Retrieves the guest code profiler attached to the given Game Boy
+ *          Emulator Core context.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure from which to
+ *                      retrieve the profiler. Pass `nullptr` to use the current
+ *                      context.
+ *
+ * @return  If a profiler is attached, returns a pointer to it.
+ *          If no profiler is attached, or if no context is provided (i.e.,
+ *          `nullptr`) and no current context exists, returns `nullptr`.
+ */
+GB_API gbProfiler* gbGetProfiler (const gbContext* context);
+
+/**
+ * @brief   Attaches an execution coverage bitmap to the given Game Boy Emulator
+ *          Core context.
+ *
+ * While a coverage bitmap is attached, the context's processor marks the
+ * address of every opcode it fetches. Attaching a coverage bitmap does not
+ * reset the context.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure to which to
+ *                      attach the coverage bitmap. Pass `nullptr` to use the
+ *                      current context.
+ * @param   coverage    A pointer to the @a `gbCoverage` structure to be
+ *                      attached. Pass `nullptr` to detach any currently
+ *                      attached coverage bitmap.
+ *
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbAttachCoverage (gbContext* context, gbCoverage* coverage);
+
+/**
+ * @brief   Retrieves the execution coverage bitmap attached to the given Game
+ *          Boy Emulator Core context.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure from which to
+ *                      retrieve the coverage bitmap. Pass `nullptr` to use the
+ *                      current context.
+ *
+ * @return  If a coverage bitmap is attached, returns a pointer to it.
+ *          If none is attached, or if no context is provided (i.e., `nullptr`)
+ *          and no current context exists, returns `nullptr`.
+ */
+GB_API gbCoverage* gbGetCoverage (const gbContext* context);
+
 /* Public Function Declarations - Context Operation Mode **********************/
 
 /**
@@ -340,6 +697,65 @@ GB_API bool gbCheckCGBMode (const gbContext* context, bool* outIsCGBMode);
  */
 GB_API bool gbCheckEngineMode (const gbContext* context, bool* outIsEngineMode);
 
+/**
+ * @brief   Enables or disables "reference mode" on the given Game Boy context.
+ * 
+ * In reference mode, the core takes its general, straightforward code paths
+ * everywhere, bypassing any fast paths (e.g., cached lookups or bulk copies)
+ * which are meant to behave identically. Running a reference-mode context in
+ * lockstep with a normal one (see `gbt lockstep`) proves that the fast paths
+ * really are identical. Every fast path added to the core must check this
+ * mode and fall back to its general path while it is set.
+ * 
+ * Reference mode is kept when the context is re-initialized.
+ * 
+ * @param   context         A pointer to the @a `gbContext` structure to be
+ *                          changed. Pass `nullptr` to use the current context.
+ * @param   referenceMode   Whether reference mode should be enabled.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbSetReferenceMode (gbContext* context, bool referenceMode);
+
+/**
+ * @brief   Checks whether the given Game Boy context is in "reference mode".
+ *          See @a `gbSetReferenceMode`.
+ * 
+ * @param   context             A pointer to the @a `gbContext` structure to be
+ *                              checked. Pass `nullptr` to use the current
+ *                              context.
+ * @param   outIsReferenceMode  A pointer to a boolean variable where the result
+ *                              will be stored. Must not be `nullptr`.
+ * 
+ * @return  If checked successfully, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbCheckReferenceMode (const gbContext* context,
+    bool* outIsReferenceMode);
+
+/**
+ * @brief   Computes a 64-bit hash of the given Game Boy context's memory: its
+ *          WRAM, HRAM and, if a cartridge is attached, its external RAM.
+ * 
+ * Two contexts which have run the same program identically hash identically,
+ * so this is a cheap way to compare their states without copying memory out.
+ * On the DMG, WRAM and HRAM are hashed as the CPU sees them on the address
+ * bus; in CGB mode, every WRAM bank is hashed, whether mapped or not.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure to be hashed.
+ *                      Pass `nullptr` to use the current context.
+ * @param   outHash     A pointer to a variable where the hash will be stored.
+ *                      Must not be `nullptr`.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbHashContextMemory (const gbContext* context, uint64_t* outHash);
+
 /* Public Function Declarations - Current Context and Components **************/
 
 /**
@@ -349,7 +765,8 @@ GB_API bool gbCheckEngineMode (const gbContext* context, bool* outIsEngineMode);
  * By default, nearly all functions in the Game Boy Emulator Core library's
  * public API fall back to operating on a "current context" if one is not
  * provided explicitly. This function sets the specified context as that current
- * context.
+ * context. Each thread has its own current context, so worker threads driving
+ * separate contexts do not interfere with one another.
  * 
  * @param   context     A pointer to the @a `gbContext` structure to become the
  *                      current context. Pass `nullptr` to un-set any current
@@ -412,6 +829,20 @@ GB_API gbProcessor* gbGetProcessor (const gbContext* context);
  */
 GB_API gbTimer* gbGetTimer (const gbContext* context);
 
+/**
+ * @brief   Retrieves the serial port component associated with the given Game
+ *          Boy Emulator Core context.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure from which to
+ *                      retrieve the serial port component. Pass `nullptr` to use
+ *                      the current context.
+ *
+ * @return  If successful, returns a pointer to the associated @a `gbSerial`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `nullptr`.
+ */
+GB_API gbSerial* gbGetSerial (const gbContext* context);
+
 /* Public Function Declarations - Userdata ************************************/
 
 /**
@@ -483,6 +914,81 @@ GB_API bool gbSetBusReadCallback (gbContext* context,
 GB_API bool gbSetBusWriteCallback (gbContext* context,
     gbBusWriteCallback callback);
 
+/**
+ * @brief   Limits the given context's bus read and write callbacks to accesses
+ *          within a range of addresses. Accesses outside it cost no call.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure for which to
+ *                      set the filter. Pass `nullptr` to use the current
+ *                      context.
+ * @param   filter      A pointer to the @a `gbAddressFilter` to be applied.
+ *                      Pass `nullptr` to pass every address.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbSetBusCallbackFilter (gbContext* context,
+    const gbAddressFilter* filter);
+
+/**
+ * @brief   Sets every callback of the given context, and of its processor, at
+ *          once: those of the events in @a `hooks->events`, and the address
+ *          filters. The callbacks of all other events are cleared.
+ * 
+ * The processor keeps the events it has callbacks for as one bit mask, which
+ * it checks once per instruction; an event left out of the mask costs nothing
+ * as the context runs.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure whose callbacks
+ *                      are to be set. Pass `nullptr` to use the current context.
+ * @param   hooks       A pointer to the @a `gbHooks` to be set. Pass `nullptr`
+ *                      to clear every callback and filter.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbSetHooks (gbContext* context, const gbHooks* hooks);
+
+/**
+ * @brief   Sets the override function which may take over read operations on
+ *          the given context's emulated address bus. Reads it handles skip the
+ *          memory map entirely, but are still traced and still reported to the
+ *          bus read callback.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure for which to
+ *                      set the bus read override. Pass `nullptr` to use the
+ *                      current context.
+ * @param   override    A pointer to the @a `gbBusReadOverride` function. Pass
+ *                      `nullptr` to clear any existing override.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbSetBusReadOverride (gbContext* context,
+    gbBusReadOverride override);
+
+/**
+ * @brief   Sets the override function which may take over write operations on
+ *          the given context's emulated address bus. Writes it handles skip the
+ *          memory map entirely, but are still traced and still reported to the
+ *          bus write callback.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure for which to
+ *                      set the bus write override. Pass `nullptr` to use the
+ *                      current context.
+ * @param   override    A pointer to the @a `gbBusWriteOverride` function. Pass
+ *                      `nullptr` to clear any existing override.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbSetBusWriteOverride (gbContext* context,
+    gbBusWriteOverride override);
+
 /* Public Function Declarations - Ticking *************************************/
 
 /**
@@ -499,6 +1005,136 @@ GB_API bool gbSetBusWriteCallback (gbContext* context,
  */
 GB_API bool gbTick (gbContext* context);
 
+/**
+ * @brief   Runs the given Game Boy Emulator Core context for up to the given
+ *          number of T-cycles, stopping early if a stop is requested or if the
+ *          processor reaches a provably terminal state.
+ * 
+ * A state is terminal if emulation can never leave it. The following states
+ * are detected:
+ * 
+ * - A jump to itself (`JR -2`, or `JP a16` or `JP HL` targeting its own
+ *   address) with `IME` clear, or with no interrupt in `IE` pending or able
+ *   to become pending.
+ * 
+ * - `HALT` with no interrupt in `IE` pending or able to become pending.
+ * 
+ * - `STOP`, since no joypad is connected to wake the processor.
+ * 
+ * An interrupt is able to become pending if the component which requests it is
+ * running: the timer, if it is enabled in `TAC`; or the serial port, if a
+ * transfer is in progress on the internal clock.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure to be run.
+ *                      Pass `nullptr` to use the current context.
+ * @param   tickCycles  The maximum number of T-cycles to run for. The last
+ *                      instruction may overshoot this budget by a few cycles.
+ * @param   outReason   A pointer to a @a `gbStopReason` variable where the
+ *                      reason for stopping will be stored. May be `nullptr`.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists; or if the processor reports an error, returns `false`.
+ */
+GB_API bool gbRun (gbContext* context, uint64_t tickCycles,
+    gbStopReason* outReason);
+
+/**
+ * @brief   Requests that @a `gbRun` stop running the given Game Boy Emulator
+ *          Core context once its current instruction completes. This is meant
+ *          to be called from within one of the context's callbacks.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure to be stopped.
+ *                      Pass `nullptr` to use the current context.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbRequestStop (gbContext* context);
+
+/**
+ * @brief   Retrieves a string representation of the given stop reason.
+ * 
+ * @param   reason      The @a `gbStopReason` to be stringified.
+ * 
+ * @return  A pointer to a null-terminated string naming the stop reason, or
+ *          `"unknown"` if the reason is not recognized.
+ */
+GB_API const char* gbStringifyStopReason (gbStopReason reason);
+
+/* Public Function Declarations - Cheats **************************************/
+
+/**
+ * @brief   Decodes a cheat code and adds it to the given Game Boy Emulator
+ *          Core context, enabled.
+ *
+ * Neither kind of code adds any work to the bus. A Game Genie code redirects
+ * the 256-byte page of the memory map holding its address to a shadow copy of
+ * the mapped ROM with the substitution made, which is rebuilt whenever the
+ * cartridge switches banks. GameShark codes are applied in a batch once per
+ * frame; @a `gbRun` stops at frame boundaries only while one is enabled.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure to be changed.
+ *                      Pass `nullptr` to use the current context.
+ * @param   code        The cheat code; see @a `gbParseCheat`.
+ *
+ * @return  If successful, returns `true`.
+ *          If the code cannot be decoded, or memory allocation fails, returns
+ *          `false`.
+ */
+GB_API bool gbAddCheat (gbContext* context, const char* code);
+
+/**
+ * @brief   Removes one of the given context's cheat codes.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure to be changed.
+ *                      Pass `nullptr` to use the current context.
+ * @param   index       The index of the code; later codes move down by one.
+ *
+ * @return  If successful, returns `true`.
+ *          If the index is out of range, returns `false`.
+ */
+GB_API bool gbRemoveCheat (gbContext* context, size_t index);
+
+/**
+ * @brief   Removes all of the given context's cheat codes.
+ */
+GB_API bool gbClearCheats (gbContext* context);
+
+/**
+ * @brief   Enables or disables one of the given context's cheat codes.
+ */
+GB_API bool gbSetCheatEnabled (gbContext* context, size_t index, bool enabled);
+
+/**
+ * @brief   Retrieves the number of cheat codes added to the given context.
+ */
+GB_API size_t gbGetCheatCount (const gbContext* context);
+
+/**
+ * @brief   Retrieves one of the given context's cheat codes.
+ *
+ * @return  A pointer to the code, valid until codes are next added or
+ *          removed; or `nullptr` if the index is out of range.
+ */
+GB_API const gbCheat* gbGetCheat (const gbContext* context, size_t index);
+
+/**
+ * @brief   Applies the given context's enabled GameShark codes now.
+ *
+ * @a `gbRun` does this at every frame boundary. A frontend which drives the
+ * context with @a `gbTick` should call this once per frame instead.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure to be changed.
+ *                      Pass `nullptr` to use the current context.
+ *
+ * @return  If successful, returns `true`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbApplyCheats (gbContext* context);
+
 /* Public Function Declarations - Address Bus *********************************/
 
 /**
@@ -514,6 +1150,7 @@ GB_API bool gbTick (gbContext* context);
  *                      access rules to enforce during this read operation.
  *                      Pass `nullptr` to specify default CPU external access
  *                      rules, or a zeroed-out union to bypass all checks.
+ *                      Either way, the rules are checked on every access.
  * 
  * @return  If successful, returns `true` and stores the read byte in
  *          @a `outValue`.
@@ -539,6 +1176,7 @@ GB_API bool gbReadByte (const gbContext* context, uint16_t address,
  *                      access rules to enforce during this write operation.
  *                      Pass `nullptr` to specify default CPU external access
  *                      rules, or a zeroed-out union to bypass all checks.
+ *                      Either way, the rules are checked on every access.
  * @param   outActual   A pointer to a byte variable where the actual value
  *                      written to the bus will be stored, which may differ from
  *                      the requested value due to hardware quirks or restrictions.
@@ -556,3 +1194,51 @@ GB_API bool gbReadByte (const gbContext* context, uint16_t address,
  */
 GB_API bool gbWriteByte (gbContext* context, uint16_t address,
     uint8_t value, const gbCheckRules* rules, uint8_t* outActual);
+
+/**
+ * @brief   Reads a span of bytes from the given Game Boy Emulator Core
+ *          context's address bus, as a memory viewer or DMA would.
+ *
+ * Pages mapped straight to host memory are copied whole; the rest are read a
+ * byte at a time through the memory map, under the CPU's rules. No bus
+ * override, callback or trace record is involved.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure from which to
+ *                      read. Pass `nullptr` to use the current context.
+ * @param   address     The absolute address of the first byte to read.
+ * @param   length      The number of bytes to read; the span must not run past
+ *                      `$FFFF`.
+ * @param   outBuffer   A pointer to a buffer of at least @a `length` bytes to
+ *                      receive the bytes read. Must not be `nullptr`.
+ * @param   flags       Any of @a `gbBlockFlags`.
+ *
+ * @return  If successful, returns `true`.
+ *          If no context is available, or invalid parameters are provided,
+ *          returns `false`.
+ */
+GB_API bool gbReadBlock (const gbContext* context, uint16_t address,
+    size_t length, uint8_t* outBuffer, uint8_t flags);
+
+/**
+ * @brief   Writes a span of bytes to the given Game Boy Emulator Core
+ *          context's address bus, as a memory editor or DMA would.
+ *
+ * Pages mapped straight to host memory are copied whole; the rest are written
+ * a byte at a time through the memory map, under the CPU's rules. No bus
+ * override, callback or trace record is involved.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure to which to
+ *                      write. Pass `nullptr` to use the current context.
+ * @param   address     The absolute address of the first byte to write.
+ * @param   length      The number of bytes to write; the span must not run
+ *                      past `$FFFF`.
+ * @param   buffer      A pointer to the @a `length` bytes to be written. Must
+ *                      not be `nullptr`.
+ * @param   flags       Any of @a `gbBlockFlags`.
+ *
+ * @return  If successful, returns `true`.
+ *          If no context is available, or invalid parameters are provided,
+ *          returns `false`.
+ */
+GB_API bool gbWriteBlock (gbContext* context, uint16_t address,
+    size_t length, const uint8_t* buffer, uint8_t flags);
@@ -0,0 +1,342 @@
+/**
+ * @file    GB/Coverage.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's execution
+ *          coverage bitmap.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Coverage.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   Defines the size of one cartridge ROM bank, in bytes.
+ */
+#define GB_COVERAGE_BANK_SIZE 0x4000
+
+/* Private Unions and Structures **********************************************/
+
+struct gbCoverage
+{
+    uint8_t*    rom;            // One bit per ROM byte.
+    size_t      romSize;
+    uint8_t     ram[GB_COVERAGE_RAM_SIZE / 8];
+};
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static size_t gbCountBits (const uint8_t* bits, size_t size);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+size_t gbCountBits (const uint8_t* bits, size_t size)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        for (uint8_t byte = bits[i]; byte != 0; byte &= (uint8_t) (byte - 1))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/* Public Function Definitions - Lifecycle ************************************/
+
+gbCoverage* gbCreateCoverage (size_t romSize)
+{
+    gbCoverage* coverage = gbCreateZero(1, gbCoverage);
+    gbCheckpv(coverage != nullptr, nullptr,
+        "Error allocating memory for 'gbCoverage'");
+
+    coverage->romSize = (romSize + GB_COVERAGE_BANK_SIZE - 1) &
+        ~((size_t) GB_COVERAGE_BANK_SIZE - 1);
+    if (coverage->romSize == 0)
+    {
+        coverage->romSize = GB_COVERAGE_BANK_SIZE;
+    }
+
+    coverage->rom = gbCreateZero(coverage->romSize / 8, uint8_t);
+    if (coverage->rom == nullptr)
+    {
+        gbLogErrno("Error allocating memory for coverage bitmap");
+        gbDestroy(coverage);
+        return nullptr;
+    }
+
+    return coverage;
+}
+
+bool gbDestroyCoverage (gbCoverage* coverage)
+{
+    gbCheckqv(coverage, false);
+
+    gbDestroy(coverage->rom);
+    gbDestroy(coverage);
+    return true;
+}
+
+bool gbClearCoverage (gbCoverage* coverage)
+{
+    gbCheckv(coverage != nullptr, false, "No valid 'gbCoverage' provided.");
+
+    memset(coverage->rom, 0, coverage->romSize / 8);
+    memset(coverage->ram, 0, sizeof(coverage->ram));
+    return true;
+}
+
+/* Public Function Definitions - Recording ************************************/
+
+void gbMarkCoverage (gbCoverage* coverage, uint16_t bank, uint16_t address)
+{
+    gbAssert(coverage);
+
+    // - Code outside of ROM shares one bitmap, whatever is mapped there.
+    if (address > GB_ROMX_END)
+    {
+        size_t index = address - GB_VRAM_START;
+        coverage->ram[index >> 3] |= (uint8_t) (1 << (index & 7));
+        return;
+    }
+
+    size_t offset = (size_t) bank * GB_COVERAGE_BANK_SIZE +
+        (address & (GB_COVERAGE_BANK_SIZE - 1));
+    if (offset < coverage->romSize)
+    {
+        coverage->rom[offset >> 3] |= (uint8_t) (1 << (offset & 7));
+    }
+}
+
+bool gbIsCoverageMarked (const gbCoverage* coverage, size_t offset)
+{
+    gbCheckqv(coverage != nullptr && offset < coverage->romSize, false);
+    return (coverage->rom[offset >> 3] & (1 << (offset & 7))) != 0;
+}
+
+bool gbMergeCoverage (gbCoverage* coverage, const gbCoverage* other)
+{
+    gbCheckv(coverage != nullptr && other != nullptr, false,
+        "No valid 'gbCoverage' provided.");
+    gbCheckv(coverage->romSize == other->romSize, false,
+        "Cannot merge coverage of a %zu-byte ROM into that of a %zu-byte ROM.",
+        other->romSize, coverage->romSize);
+
+    for (size_t i = 0; i < coverage->romSize / 8; ++i)
+    {
+        coverage->rom[i] |= other->rom[i];
+    }
+
+    for (size_t i = 0; i < sizeof(coverage->ram); ++i)
+    {
+        coverage->ram[i] |= other->ram[i];
+    }
+
+    return true;
+}
+
+/* Public Function Definitions - Reporting ************************************/
+
+size_t gbGetCoverageROMSize (const gbCoverage* coverage)
+{
+    gbCheckqv(coverage, 0);
+    return coverage->romSize;
+}
+
+size_t gbCountCoverageBank (const gbCoverage* coverage, size_t bank)
+{
+    gbCheckqv(coverage, 0);
+    if (bank >= coverage->romSize / GB_COVERAGE_BANK_SIZE)
+    {
+        return 0;
+    }
+
+    return gbCountBits(coverage->rom + bank * (GB_COVERAGE_BANK_SIZE / 8),
+        GB_COVERAGE_BANK_SIZE / 8);
+}
+
+size_t gbCountCoverage (const gbCoverage* coverage)
+{
+    gbCheckqv(coverage, 0);
+    return gbCountBits(coverage->rom, coverage->romSize / 8);
+}
+
+/* Public Function Definitions - Files ****************************************/
+
+bool gbSaveCoverage (const gbCoverage* coverage, const char* filepath)
+{
+    gbCheckv(coverage != nullptr, false, "No valid 'gbCoverage' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+
+    FILE* fp = fopen(filepath, "wb");
+    gbCheckpv(fp != nullptr, false, "Failed to open coverage file '%s' for writing",
+        filepath);
+
+    gbCoverageFileHeader header = { 0 };
+    memcpy(header.magic, GB_COVERAGE_MAGIC, sizeof(header.magic));
+    header.version = GB_COVERAGE_VERSION;
+    header.romSize = coverage->romSize;
+    if (
+        fwrite(&header, sizeof(header), 1, fp) != 1 ||
+        fwrite(coverage->rom, 1, coverage->romSize / 8, fp) != coverage->romSize / 8 ||
+        fwrite(coverage->ram, 1, sizeof(coverage->ram), fp) != sizeof(coverage->ram)
+    )
+    {
+        gbLogErrno("Error writing coverage file '%s'", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    fclose(fp);
+    return true;
+}
+
+bool gbLoadCoverage (gbCoverage* coverage, const char* filepath)
+{
+    gbCheckv(coverage != nullptr, false, "No valid 'gbCoverage' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+
+    FILE* fp = fopen(filepath, "rb");
+    gbCheckpv(fp != nullptr, false, "Failed to open coverage file '%s' for reading",
+        filepath);
+
+    // - Read and validate the file header.
+    gbCoverageFileHeader header = { 0 };
+    if (
+        fread(&header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header.magic, GB_COVERAGE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != GB_COVERAGE_VERSION
+    )
+    {
+        gbLogError("File '%s' is not a supported coverage file.", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    if (header.romSize != coverage->romSize)
+    {
+        gbLogError("Coverage file '%s' is of a %llu-byte ROM, not a %zu-byte ROM.",
+            filepath, (unsigned long long) header.romSize, coverage->romSize);
+        fclose(fp);
+        return false;
+    }
+
+    // - Merge the bitmaps in, a chunk at a time.
+    bool result = true;
+    uint8_t chunk[4096];
+    for (size_t part = 0; part < 2 && result == true; ++part)
+    {
+        uint8_t* bits = (part == 0) ? coverage->rom : coverage->ram;
+        size_t size = (part == 0) ? coverage->romSize / 8 : sizeof(coverage->ram);
+        for (size_t offset = 0; offset < size; offset += sizeof(chunk))
+        {
+            size_t length = (size - offset < sizeof(chunk)) ? size - offset : sizeof(chunk);
+            if (fread(chunk, 1, length, fp) != length)
+            {
+                gbLogError("Coverage file '%s' is truncated.", filepath);
+                result = false;
+                break;
+            }
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                bits[offset + i] |= chunk[i];
+            }
+        }
+    }
+
+    fclose(fp);
+    return result;
+}
+
+bool gbSaveCoverageLCOV (const gbCoverage* coverage, const char* filepath,
+    const char* sourceName, const gbSymbolTable* symbols)
+{
+    gbCheckv(coverage != nullptr, false, "No valid 'gbCoverage' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+
+    FILE* fp = fopen(filepath, "w");
+    gbCheckpv(fp != nullptr, false, "Failed to open LCOV file '%s' for writing",
+        filepath);
+
+    fprintf(fp, "TN:\nSF:%s\n", (sourceName != nullptr) ? sourceName : "rom.gb");
+
+    // - Each ROM symbol is a function, spanning the bytes up to the next
+    //   symbol in its bank, or the end of the bank.
+    size_t symbolCount = gbGetSymbolCount(symbols);
+    size_t functionsFound = 0, functionsHit = 0;
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        for (size_t i = 0; i < symbolCount; ++i)
+        {
+            uint16_t bank = 0, address = 0;
+            const char* name = gbGetSymbol(symbols, i, &bank, &address);
+            size_t start = (size_t) bank * GB_COVERAGE_BANK_SIZE +
+                (address & (GB_COVERAGE_BANK_SIZE - 1));
+            if (address > GB_ROMX_END || start >= coverage->romSize)
+            {
+                continue;
+            }
+
+            if (pass == 0)
+            {
+                fprintf(fp, "FN:%zu,%s\n", start + 1, name);
+                functionsFound++;
+                continue;
+            }
+
+            uint16_t nextBank = 0, nextAddress = 0;
+            size_t end = (start | (GB_COVERAGE_BANK_SIZE - 1)) + 1;
+            if (
+                gbGetSymbol(symbols, i + 1, &nextBank, &nextAddress) != nullptr &&
+                nextBank == bank && nextAddress <= GB_ROMX_END
+            )
+            {
+                end = (size_t) bank * GB_COVERAGE_BANK_SIZE +
+                    (nextAddress & (GB_COVERAGE_BANK_SIZE - 1));
+            }
+
+            size_t hits = 0;
+            for (size_t offset = start; offset < end; ++offset)
+            {
+                hits += gbIsCoverageMarked(coverage, offset);
+            }
+
+            fprintf(fp, "FNDA:%zu,%s\n", hits, name);
+            functionsHit += (hits > 0);
+        }
+    }
+
+    fprintf(fp, "FNF:%zu\nFNH:%zu\n", functionsFound, functionsHit);
+
+    // - Every fetched opcode is a line, hit once.
+    size_t linesHit = 0;
+    for (size_t offset = 0; offset < coverage->romSize; ++offset)
+    {
+        if ((coverage->rom[offset >> 3] & (1 << (offset & 7))) != 0)
+        {
+            fprintf(fp, "DA:%zu,1\n", offset + 1);
+            linesHit++;
+        }
+    }
+
+    fprintf(fp, "LF:%zu\nLH:%zu\nend_of_record\n", coverage->romSize, linesHit);
+
+    if (ferror(fp) != 0)
+    {
+        gbLogErrno("Error writing LCOV file '%s'", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    fclose(fp);
+    return true;
+}
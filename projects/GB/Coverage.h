@@ -0,0 +1,211 @@
+/**
+ * @file    GB/Coverage.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's execution
+ *          coverage bitmap, which records which ROM bytes have been fetched as
+ *          opcodes.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Symbols.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Defines the four-character magic string found at the start of a
+ *          binary coverage file.
+ */
+#define GB_COVERAGE_MAGIC "GBCV"
+
+/**
+ * @brief   Defines the version number of the binary coverage file format.
+ */
+#define GB_COVERAGE_VERSION 1
+
+/**
+ * @brief   Defines the number of bytes outside of ROM, at `$8000` - `$FFFF`,
+ *          which a coverage bitmap keeps bits for.
+ */
+#define GB_COVERAGE_RAM_SIZE 0x8000
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure representing the header of a binary coverage
+ *          file.
+ *
+ * The header is followed by the ROM bitmap, one bit per ROM byte, `romSize / 8`
+ * bytes long; then the RAM bitmap, `GB_COVERAGE_RAM_SIZE / 8` bytes long. Bit
+ * `n % 8` of byte `n / 8` is set if the byte at ROM offset `n` was fetched as
+ * an opcode.
+ *
+ * @note    All fields are stored in the byte order of the machine which wrote
+ *          the coverage file.
+ */
+typedef struct gbCoverageFileHeader
+{
+    char        magic[4];       /** @brief Magic string; see @a `GB_COVERAGE_MAGIC`. */
+    uint16_t    version;        /** @brief File format version; see @a `GB_COVERAGE_VERSION`. */
+    uint16_t    reserved;       /** @brief Reserved; always zero. */
+    uint64_t    romSize;        /** @brief Size of the covered ROM, in bytes. */
+} gbCoverageFileHeader;
+
+/* Public Function Declarations - Lifecycle ***********************************/
+
+/**
+ * @brief   Allocates and creates a new, empty coverage bitmap.
+ *
+ * @param   romSize     The size of the cartridge ROM to be covered, in bytes;
+ *                      see @a `gbGetCartridgeROMSize`. It is rounded up to a
+ *                      whole number of 16 KiB banks.
+ *
+ * @return  If successful, returns a pointer to the new @a `gbCoverage`.
+ *          If memory allocation fails, returns `nullptr`.
+ */
+GB_API gbCoverage* gbCreateCoverage (size_t romSize);
+
+/**
+ * @brief   Destroys and deallocates the given coverage bitmap.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be destroyed.
+ *
+ * @return  If successful, returns `true`.
+ *          If the coverage pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbDestroyCoverage (gbCoverage* coverage);
+
+/**
+ * @brief   Clears every bit in the given coverage bitmap.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be cleared.
+ *
+ * @return  If successful, returns `true`.
+ *          If the coverage pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbClearCoverage (gbCoverage* coverage);
+
+/* Public Function Declarations - Recording ***********************************/
+
+/**
+ * @brief   Marks the byte at the given address as fetched as an opcode. This
+ *          is called by the context's processor on each opcode fetch while the
+ *          coverage bitmap is attached.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be updated.
+ * @param   bank        The ROM bank mapped at @a `address`. Ignored outside
+ *                      of ROM.
+ * @param   address     The address of the opcode.
+ */
+GB_API void gbMarkCoverage (gbCoverage* coverage, uint16_t bank,
+    uint16_t address);
+
+/**
+ * @brief   Checks whether the byte at the given ROM offset has been fetched as
+ *          an opcode.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be checked.
+ * @param   offset      The offset of the byte in the ROM file; that is,
+ *                      `bank * 0x4000 + (address & 0x3FFF)`.
+ *
+ * @return  `true` if the byte has been fetched; `false` if it has not, or if
+ *          the offset is out of range.
+ */
+GB_API bool gbIsCoverageMarked (const gbCoverage* coverage, size_t offset);
+
+/**
+ * @brief   Merges the bits set in one coverage bitmap into another, such as
+ *          when combining the runs of a test corpus.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be merged into.
+ * @param   other       A pointer to the @a `gbCoverage` to be merged from. It
+ *                      must cover a ROM of the same size.
+ *
+ * @return  If successful, returns `true`.
+ *          If either pointer is `nullptr`, or the ROM sizes differ, returns
+ *          `false`.
+ */
+GB_API bool gbMergeCoverage (gbCoverage* coverage, const gbCoverage* other);
+
+/* Public Function Declarations - Reporting ***********************************/
+
+/**
+ * @brief   Retrieves the size of the ROM covered by the given bitmap, in bytes.
+ */
+GB_API size_t gbGetCoverageROMSize (const gbCoverage* coverage);
+
+/**
+ * @brief   Counts the ROM bytes fetched as opcodes in one bank of the given
+ *          coverage bitmap.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be counted.
+ * @param   bank        The ROM bank to be counted.
+ *
+ * @return  The number of bytes marked in the bank, or `0` if it is out of
+ *          range.
+ */
+GB_API size_t gbCountCoverageBank (const gbCoverage* coverage, size_t bank);
+
+/**
+ * @brief   Counts the ROM bytes fetched as opcodes across the whole of the
+ *          given coverage bitmap.
+ *
+ * Only opcode bytes are marked, never operands, so even a ROM whose every
+ * instruction has been executed reports well under its full size.
+ */
+GB_API size_t gbCountCoverage (const gbCoverage* coverage);
+
+/* Public Function Declarations - Files ***************************************/
+
+/**
+ * @brief   Writes the given coverage bitmap to a binary coverage file; see
+ *          @a `gbCoverageFileHeader`.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be saved.
+ * @param   filepath    The path of the file to be written.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be written, returns `false`.
+ */
+GB_API bool gbSaveCoverage (const gbCoverage* coverage, const char* filepath);
+
+/**
+ * @brief   Reads a binary coverage file, and merges its bits into the given
+ *          coverage bitmap.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be merged into.
+ * @param   filepath    The path of the file to be read. It must cover a ROM of
+ *                      the same size.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be read, is not a coverage file, or covers a ROM
+ *          of a different size, returns `false`.
+ */
+GB_API bool gbLoadCoverage (gbCoverage* coverage, const char* filepath);
+
+/**
+ * @brief   Writes the given coverage bitmap as an LCOV tracefile, for the
+ *          usual coverage report tools.
+ *
+ * The ROM stands in for the source file: "line" `n` is the byte at ROM offset
+ * `n - 1`. Each symbol in a ROM bank becomes a function, hit if any opcode
+ * between it and the next symbol was fetched; each fetched opcode becomes a
+ * line hit once. `LF` counts every byte of the ROM, so `LH / LF` is the same
+ * fraction @a `gbCountCoverage` reports.
+ *
+ * @param   coverage    A pointer to the @a `gbCoverage` to be exported.
+ * @param   filepath    The path of the file to be written.
+ * @param   sourceName  The name written in the `SF:` record, usually the ROM's
+ *                      path.
+ * @param   symbols     A pointer to the @a `gbSymbolTable` whose symbols become
+ *                      functions. May be `nullptr`.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be written, returns `false`.
+ */
+GB_API bool gbSaveCoverageLCOV (const gbCoverage* coverage,
+    const char* filepath, const char* sourceName, const gbSymbolTable* symbols);
@@ -14,12 +14,25 @@ extern "C" {
 
 /* Public Includes ************************************************************/
 
+#include <GB/Log.h>
 #include <GB/Context.h>
 #include <GB/Cartridge.h>
+#include <GB/Autosave.h>
 #include <GB/Memory.h>
 #include <GB/Processor.h>
 #include <GB/Instructions.h>
 #include <GB/Timer.h>
+#include <GB/Serial.h>
+#include <GB/Trace.h>
+#include <GB/Symbols.h>
+#include <GB/Profiler.h>
+#include <GB/Coverage.h>
+#include <GB/Library.h>
+#include <GB/Patch.h>
+#include <GB/Cheat.h>
+#include <GB/Search.h>
+#include <GB/Hash.h>
+#include <GB/Stats.h>
 
 #if defined(__cplusplus)
 } // extern "C"
@@ -0,0 +1,137 @@
+/**
+ * @file    GB/Hash.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's fast,
+ *          non-cryptographic 64-bit hash function.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Hash.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The secret constants mixed into the hash state.
+ */
+static const uint64_t GB_HASH_SECRET[4] = {
+    0x2D358DCCAA6C78A5ull, 0x8BB84B93962EACC9ull,
+    0x4B33A62ED433D4A3ull, 0x4D5A2DA51DE1AA47ull
+};
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static inline uint64_t gbHashRead64 (const uint8_t* data);
+static inline uint64_t gbHashRead32 (const uint8_t* data);
+static inline void gbHashMultiply (uint64_t* a, uint64_t* b);
+static inline uint64_t gbHashMix (uint64_t a, uint64_t b);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+uint64_t gbHashRead64 (const uint8_t* data)
+{
+    return
+        ((uint64_t) data[0]      ) | ((uint64_t) data[1] <<  8) |
+        ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24) |
+        ((uint64_t) data[4] << 32) | ((uint64_t) data[5] << 40) |
+        ((uint64_t) data[6] << 48) | ((uint64_t) data[7] << 56);
+}
+
+uint64_t gbHashRead32 (const uint8_t* data)
+{
+    return
+        ((uint64_t) data[0]      ) | ((uint64_t) data[1] <<  8) |
+        ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24);
+}
+
+void gbHashMultiply (uint64_t* a, uint64_t* b)
+{
+    // - Replace `a` and `b` with the low and high halves of their 128-bit
+    //   product.
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128) *a * *b;
+    *a = (uint64_t) product;
+    *b = (uint64_t) (product >> 64);
+#else
+    uint64_t aHigh = *a >> 32, aLow = (uint32_t) *a;
+    uint64_t bHigh = *b >> 32, bLow = (uint32_t) *b;
+    uint64_t highHigh = aHigh * bHigh, highLow = aHigh * bLow;
+    uint64_t lowHigh = aLow * bHigh, lowLow = aLow * bLow;
+    uint64_t middle = highLow + (lowLow >> 32) + (uint32_t) lowHigh;
+    *a = (middle << 32) | (uint32_t) lowLow;
+    *b = highHigh + (middle >> 32) + (lowHigh >> 32);
+#endif
+}
+
+uint64_t gbHashMix (uint64_t a, uint64_t b)
+{
+    gbHashMultiply(&a, &b);
+    return a ^ b;
+}
+
+/* Public Function Definitions ************************************************/
+
+uint64_t gbHash64 (const void* data, size_t size, uint64_t seed)
+{
+    const uint8_t* bytes = data;
+    uint64_t a = 0, b = 0;
+
+    seed ^= gbHashMix(seed ^ GB_HASH_SECRET[0], GB_HASH_SECRET[1]);
+    if (size <= 16)
+    {
+        // - Short inputs are read as overlapping words from either end.
+        if (size >= 4)
+        {
+            size_t step = (size >> 3) << 2;
+            a = (gbHashRead32(bytes) << 32) | gbHashRead32(bytes + step);
+            b = (gbHashRead32(bytes + size - 4) << 32) |
+                gbHashRead32(bytes + size - 4 - step);
+        }
+        else if (size > 0)
+        {
+            a = ((uint64_t) bytes[0] << 16) | ((uint64_t) bytes[size >> 1] << 8) |
+                bytes[size - 1];
+        }
+    }
+    else
+    {
+        size_t remaining = size;
+        if (remaining > 48)
+        {
+            // - Three independent lanes keep the multipliers busy.
+            uint64_t lane1 = seed, lane2 = seed;
+            do
+            {
+                seed = gbHashMix(gbHashRead64(bytes) ^ GB_HASH_SECRET[1],
+                    gbHashRead64(bytes + 8) ^ seed);
+                lane1 = gbHashMix(gbHashRead64(bytes + 16) ^ GB_HASH_SECRET[2],
+                    gbHashRead64(bytes + 24) ^ lane1);
+                lane2 = gbHashMix(gbHashRead64(bytes + 32) ^ GB_HASH_SECRET[3],
+                    gbHashRead64(bytes + 40) ^ lane2);
+                bytes += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+
+            seed ^= lane1 ^ lane2;
+        }
+
+        while (remaining > 16)
+        {
+            seed = gbHashMix(gbHashRead64(bytes) ^ GB_HASH_SECRET[1],
+                gbHashRead64(bytes + 8) ^ seed);
+            bytes += 16;
+            remaining -= 16;
+        }
+
+        // - The final 16 bytes may overlap the last block.
+        a = gbHashRead64(bytes + remaining - 16);
+        b = gbHashRead64(bytes + remaining - 8);
+    }
+
+    a ^= GB_HASH_SECRET[1];
+    b ^= seed;
+    gbHashMultiply(&a, &b);
+    return gbHashMix(a ^ GB_HASH_SECRET[0] ^ size, b ^ GB_HASH_SECRET[1]);
+}
@@ -0,0 +1,37 @@
+/**
+ * @file    GB/Hash.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's fast,
+ *          non-cryptographic 64-bit hash function.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Common.h>
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Computes a 64-bit hash of the given data.
+ *
+ * The hash follows the design of `wyhash`: input is consumed in 48-byte blocks
+ * across three independent lanes, each mixed with a 64-by-64-bit multiply. It
+ * is fast enough to hash every frame of emulated memory, but is not suitable
+ * for cryptographic use.
+ *
+ * Input bytes are always read in little-endian order, so hashes are stable
+ * across hosts and may be stored in files.
+ *
+ * @param   data    A pointer to the data to be hashed. May be `nullptr` if
+ *                  `size` is zero.
+ * @param   size    The size of the data, in bytes.
+ * @param   seed    The seed value. Chaining calls by passing one hash as the
+ *                  next call's seed hashes several buffers as one.
+ *
+ * @return  The 64-bit hash of the data.
+ */
+GB_API uint64_t gbHash64 (const void* data, size_t size, uint64_t seed);
@@ -0,0 +1,117 @@
+/**
+ * @file    GB/Internal.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the plumbing which the Game Boy Emulator
+ *          Core's components use to keep one another in step. None of these
+ *          are exported from the library, and this header is not included by
+ *          @a `GB/GB.h`.
+ */
+
+#pragma once
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Context.h>
+#include <GB/Trace.h>
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines the trace buffer, opaque outside of the core, so that the
+ *          processor can append its records without a call per instruction.
+ */
+struct gbTrace
+{
+    // Record Storage
+    gbTraceRecord*  records;
+    size_t          capacity;       // Always a power of two.
+    size_t          mask;           // `capacity - 1`
+
+    // Internal State
+    uint64_t        totalPushed;
+    uint64_t        droppedBeforeLoad;
+    uint8_t         flags;
+};
+
+/* Private Function Declarations - Context ************************************/
+
+/**
+ * @brief   Retrieves the ROM bank mapping of the given context: the bank mapped
+ *          into each half of the ROM area, indexed by `address >> 14`, which
+ *          the context updates as MBC writes change it.
+ *
+ * The processor keeps this pointer for the life of its context, so that it
+ * can tag each traced, profiled or covered instruction with its bank without
+ * asking the cartridge.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure.
+ *
+ * @return  A pointer to the context's two mapped bank numbers.
+ */
+const uint16_t* gbGetROMBankMap (const gbContext* context);
+
+/* Private Function Declarations - Processor **********************************/
+
+/**
+ * @brief   Sets the instruction callbacks and instruction filter of the given
+ *          CPU processor component from a @a `gbHooks` structure, keeping only
+ *          the callbacks of the events in @a `hooks->events`.
+ *
+ * This function is called by @a `gbSetHooks`, once it has checked all of its
+ * arguments, and cannot fail.
+ *
+ * @param   processor   A pointer to the @a `gbProcessor` structure to be set.
+ * @param   hooks       A pointer to the @a `gbHooks` to be set.
+ */
+void gbSetProcessorHooks (gbProcessor* processor, const gbHooks* hooks);
+
+/**
+ * @brief   Sets the trace buffer, coverage bitmap and profiler the given CPU
+ *          processor component records each instruction into.
+ *
+ * This function is called by @a `gbAttachTrace`, @a `gbAttachCoverage` and
+ * @a `gbAttachProfiler`, so that the processor checks its own hook mask per
+ * instruction, rather than asking its context for each attachment.
+ *
+ * @param   processor   A pointer to the @a `gbProcessor` structure whose
+ *                      attachments are to be set.
+ * @param   trace       A pointer to the @a `gbTrace` to record into, or
+ *                      `nullptr`.
+ * @param   coverage    A pointer to the @a `gbCoverage` to mark, or `nullptr`.
+ * @param   profiler    A pointer to the @a `gbProfiler` to count cycles in, or
+ *                      `nullptr`.
+ */
+void gbSetProcessorAttachments (gbProcessor* processor, gbTrace* trace,
+    gbCoverage* coverage, gbProfiler* profiler);
+
+/**
+ * @brief   Sets the serial port component whose transfer the given CPU
+ *          processor component clocks as it consumes cycles.
+ *
+ * This function is called by the serial port as a transfer driven by its
+ * internal clock starts and ends, so that the processor skips ticking the
+ * serial port while it is idle.
+ *
+ * @param   processor   A pointer to the @a `gbProcessor` structure to be set.
+ * @param   serial      A pointer to the @a `gbSerial` whose transfer is to be
+ *                      clocked. Pass `nullptr` once the transfer ends.
+ */
+void gbSetProcessorSerialTransfer (gbProcessor* processor, gbSerial* serial);
+
+/* Private Function Definitions - Trace ***************************************/
+
+/**
+ * @brief   Appends a record to the given trace buffer, overwriting the oldest
+ *          record once the buffer has wrapped around.
+ *
+ * @param   trace       A pointer to the @a `gbTrace` to append to.
+ * @param   record      A pointer to the @a `gbTraceRecord` to be copied.
+ */
+static GB_INLINE void gbAppendTraceRecord (gbTrace* trace,
+    const gbTraceRecord* record)
+{
+    trace->records[trace->totalPushed & trace->mask] = *record;
+    trace->totalPushed++;
+}
@@ -0,0 +1,846 @@
+/**
+ * @file    GB/Library.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's ROM library
+ *          indexer.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <stdatomic.h>
+#include <threads.h>
+#include <GB/Hash.h>
+#include <GB/Library.h>
+
+#if defined(GB_WINDOWS)
+    #include <io.h>
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The offset and size of the header read from each ROM file: the
+ *          entry point through the global checksum.
+ */
+#define GB_LIBRARY_HEADER_OFFSET    0x100
+#define GB_LIBRARY_HEADER_SIZE      0x50
+
+/**
+ * @brief   The largest ROM file which @a `GB_LS_VERIFY` reads whole; 8 MiB, the
+ *          largest size a cartridge header can declare.
+ */
+#define GB_LIBRARY_MAX_ROM_SIZE     0x800000
+
+/**
+ * @brief   The longest path an index file may hold.
+ */
+#define GB_LIBRARY_MAX_PATH         4096
+
+/**
+ * @brief   The sizes of an index file's header and of each of its records, as
+ *          stored; see @a `gbLibraryFileHeader`.
+ */
+#define GB_LIBRARY_FILE_HEADER_SIZE 16
+#define GB_LIBRARY_RECORD_SIZE      52
+
+/**
+ * @brief   Bits of the flags byte of an index file's record.
+ */
+#define GB_LIBRARY_HAS_HEADER       0x01
+#define GB_LIBRARY_HEADER_VALID     0x02
+#define GB_LIBRARY_VERIFIED         0x04
+#define GB_LIBRARY_GLOBAL_VALID     0x08
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines the working state of a scan, from @a `gbBeginLibraryScan` to
+ *          @a `gbEndLibraryScan`.
+ */
+typedef struct gbLibraryScan
+{
+    uint8_t             flags;
+    gbLibraryEntry*     entries;        // Sorted by path; one per job.
+    bool*               failed;         // Set until each job succeeds.
+    size_t              count;
+    atomic_size_t       scannedCount;   // Files read, rather than reused.
+} gbLibraryScan;
+
+struct gbLibrary
+{
+    gbLibraryEntry*     entries;        // Sorted by path.
+    size_t              entryCount;
+    size_t              scannedCount;
+    gbLibraryScan*      scan;           // The scan in progress, if any.
+    atomic_size_t       progressDone;
+    atomic_size_t       progressTotal;
+};
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static void gbFreeLibraryEntries (gbLibraryEntry* entries, size_t count);
+static void gbDestroyLibraryScan (gbLibraryScan* scan);
+static int gbCompareLibraryEntries (const void* a, const void* b);
+static bool gbStatLibraryFile (const char* path, uint64_t* outModifiedTime,
+    uint64_t* outFileSize);
+static bool gbReadLibraryFile (const char* path, uint64_t offset, void* buffer,
+    size_t size);
+static bool gbReplaceLibraryIndex (const char* tempPath, const char* filepath);
+static uint32_t gbSumLibraryBytes (const uint8_t* data, size_t size);
+static void gbParseLibraryHeader (gbLibraryEntry* entry, const uint8_t* header);
+static bool gbScanLibraryFile (gbLibraryEntry* entry, uint8_t flags);
+static void gbStoreLibraryU16 (uint8_t* data, uint16_t value);
+static void gbStoreLibraryU64 (uint8_t* data, uint64_t value);
+static uint16_t gbLoadLibraryU16 (const uint8_t* data);
+static uint64_t gbLoadLibraryU64 (const uint8_t* data);
+static void gbEncodeLibraryRecord (const gbLibraryEntry* entry,
+    uint16_t pathLength, uint8_t* record);
+static void gbDecodeLibraryRecord (const uint8_t* record,
+    gbLibraryEntry* entry, uint16_t* outPathLength);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+void gbFreeLibraryEntries (gbLibraryEntry* entries, size_t count)
+{
+    if (entries == nullptr)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        char* path = (char*) entries[i].path;
+        gbDestroy(path);
+    }
+
+    gbDestroy(entries);
+}
+
+void gbDestroyLibraryScan (gbLibraryScan* scan)
+{
+    if (scan == nullptr)
+    {
+        return;
+    }
+
+    gbFreeLibraryEntries(scan->entries, scan->count);
+    gbDestroy(scan->failed);
+    gbDestroy(scan);
+}
+
+int gbCompareLibraryEntries (const void* a, const void* b)
+{
+    return strcmp(((const gbLibraryEntry*) a)->path,
+        ((const gbLibraryEntry*) b)->path);
+}
+
+#if defined(GB_WINDOWS)
+
+bool gbStatLibraryFile (const char* path, uint64_t* outModifiedTime,
+    uint64_t* outFileSize)
+{
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (
+        GetFileAttributesExA(path, GetFileExInfoStandard, &attributes) == 0 ||
+        (attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0
+    )
+    {
+        return false;
+    }
+
+    uint64_t written = ((uint64_t) attributes.ftLastWriteTime.dwHighDateTime << 32) |
+        attributes.ftLastWriteTime.dwLowDateTime;
+    *outModifiedTime = (written - 116444736000000000ull) / 10000000ull;
+    *outFileSize = ((uint64_t) attributes.nFileSizeHigh << 32) |
+        attributes.nFileSizeLow;
+    return true;
+}
+
+bool gbReadLibraryFile (const char* path, uint64_t offset, void* buffer,
+    size_t size)
+{
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    OVERLAPPED position = { 0 };
+    position.Offset = (DWORD) offset;
+    position.OffsetHigh = (DWORD) (offset >> 32);
+
+    DWORD bytesRead = 0;
+    bool result = ReadFile(file, buffer, (DWORD) size, &bytesRead, &position) != 0 &&
+        bytesRead == size;
+
+    CloseHandle(file);
+    return result;
+}
+
+bool gbReplaceLibraryIndex (const char* tempPath, const char* filepath)
+{
+    if (MoveFileExA(tempPath, filepath,
+        MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == 0)
+    {
+        gbLogError("Failed to replace library index '%s' (error %lu).",
+            filepath, (unsigned long) GetLastError());
+        return false;
+    }
+
+    return true;
+}
+
+#else
+
+bool gbStatLibraryFile (const char* path, uint64_t* outModifiedTime,
+    uint64_t* outFileSize)
+{
+    struct stat info;
+    if (stat(path, &info) != 0 || S_ISREG(info.st_mode) == false)
+    {
+        return false;
+    }
+
+    *outModifiedTime = (uint64_t) info.st_mtime;
+    *outFileSize = (uint64_t) info.st_size;
+    return true;
+}
+
+bool gbReadLibraryFile (const char* path, uint64_t offset, void* buffer,
+    size_t size)
+{
+    int descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    // - One positioned read, without seeking; loop only on a short read.
+    size_t total = 0;
+    while (total < size)
+    {
+        ssize_t bytesRead = pread(descriptor, (uint8_t*) buffer + total,
+            size - total, (off_t) (offset + total));
+        if (bytesRead <= 0)
+        {
+            break;
+        }
+
+        total += (size_t) bytesRead;
+    }
+
+    close(descriptor);
+    return total == size;
+}
+
+bool gbReplaceLibraryIndex (const char* tempPath, const char* filepath)
+{
+    gbCheckpv(rename(tempPath, filepath) == 0, false,
+        "Failed to replace library index '%s'", filepath);
+    return true;
+}
+
+#endif
+
+uint32_t gbSumLibraryBytes (const uint8_t* data, size_t size)
+{
+    // - Sum eight bytes at a time: split each word into its even and odd
+    //   bytes, so that the four 16-bit lanes of each half can take 128 words
+    //   before they must be folded into the total.
+    const uint64_t mask = 0x00FF00FF00FF00FFull;
+    uint32_t sum = 0;
+    size_t offset = 0;
+    while (size - offset >= 8)
+    {
+        uint64_t lanes = 0;
+        size_t words = (size - offset) / 8;
+        if (words > 128)
+        {
+            words = 128;
+        }
+
+        for (size_t i = 0; i < words; ++i, offset += 8)
+        {
+            uint64_t word;
+            memcpy(&word, data + offset, sizeof(word));
+            lanes += (word & mask) + ((word >> 8) & mask);
+        }
+
+        lanes = (lanes & 0x0000FFFF0000FFFFull) + ((lanes >> 16) & 0x0000FFFF0000FFFFull);
+        sum += (uint32_t) (lanes + (lanes >> 32));
+    }
+
+    for (; offset < size; ++offset)
+    {
+        sum += data[offset];
+    }
+
+    return sum;
+}
+
+void gbParseLibraryHeader (gbLibraryEntry* entry, const uint8_t* header)
+{
+    gbAssert(entry != nullptr);
+    gbAssert(header != nullptr);
+
+    // - Offsets here are relative to `$0100`.
+    entry->hasHeader = true;
+    entry->cgbFlag = header[0x43];
+    entry->cartridgeType = header[0x47];
+    entry->romSizeByte = header[0x48];
+    entry->ramSizeByte = header[0x49];
+    entry->headerChecksum = header[0x4D];
+    entry->globalChecksum = (uint16_t) ((header[0x4E] << 8) | header[0x4F]);
+
+    // - The title ends at its first unprintable byte; on a CGB cartridge, its
+    //   last byte is the CGB flag.
+    size_t titleLength = ((entry->cgbFlag & 0x80) != 0) ? 15 : 16;
+    memset(entry->title, 0, sizeof(entry->title));
+    for (size_t i = 0; i < titleLength && isprint(header[0x34 + i]); ++i)
+    {
+        entry->title[i] = (char) header[0x34 + i];
+    }
+
+    uint8_t checksum = 0;
+    for (size_t i = 0x34; i <= 0x4C; ++i)
+    {
+        checksum = (uint8_t) (checksum - header[i] - 1);
+    }
+
+    entry->headerValid = (checksum == entry->headerChecksum);
+}
+
+bool gbScanLibraryFile (gbLibraryEntry* entry, uint8_t flags)
+{
+    gbAssert(entry != nullptr);
+
+    entry->hash = 0;
+    entry->hasHeader = false;
+    entry->headerValid = false;
+    entry->verified = false;
+    entry->globalValid = false;
+    memset(entry->title, 0, sizeof(entry->title));
+
+    if ((flags & GB_LS_VERIFY) == 0 || entry->fileSize > GB_LIBRARY_MAX_ROM_SIZE)
+    {
+        // - A file too small to hold a header is still listed, by its path.
+        if (entry->fileSize < GB_LIBRARY_HEADER_OFFSET + GB_LIBRARY_HEADER_SIZE)
+        {
+            return true;
+        }
+
+        uint8_t header[GB_LIBRARY_HEADER_SIZE];
+        if (gbReadLibraryFile(entry->path, GB_LIBRARY_HEADER_OFFSET, header,
+            sizeof(header)) == false)
+        {
+            return false;
+        }
+
+        gbParseLibraryHeader(entry, header);
+        return true;
+    }
+
+    // - Verifying reads the whole file, and takes the header from that.
+    uint8_t* image = gbCreate(entry->fileSize + 1, uint8_t);
+    if (image == nullptr)
+    {
+        return false;
+    }
+
+    if (gbReadLibraryFile(entry->path, 0, image, (size_t) entry->fileSize) == false)
+    {
+        gbDestroy(image);
+        return false;
+    }
+
+    size_t size = (size_t) entry->fileSize;
+    entry->verified = true;
+    entry->hash = gbHash64(image, size, 0);
+    if (size >= GB_LIBRARY_HEADER_OFFSET + GB_LIBRARY_HEADER_SIZE)
+    {
+        gbParseLibraryHeader(entry, image + GB_LIBRARY_HEADER_OFFSET);
+
+        // - The global checksum covers every byte but its own two.
+        uint32_t sum = gbSumLibraryBytes(image, size) - image[0x14E] - image[0x14F];
+        entry->globalValid = ((uint16_t) sum == entry->globalChecksum);
+    }
+
+    gbDestroy(image);
+    return true;
+}
+
+void gbStoreLibraryU16 (uint8_t* data, uint16_t value)
+{
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+}
+
+void gbStoreLibraryU64 (uint8_t* data, uint64_t value)
+{
+    for (size_t i = 0; i < 8; ++i)
+    {
+        data[i] = (uint8_t) (value >> (i * 8));
+    }
+}
+
+uint16_t gbLoadLibraryU16 (const uint8_t* data)
+{
+    return (uint16_t) (data[0] | (data[1] << 8));
+}
+
+uint64_t gbLoadLibraryU64 (const uint8_t* data)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        value |= (uint64_t) data[i] << (i * 8);
+    }
+
+    return value;
+}
+
+void gbEncodeLibraryRecord (const gbLibraryEntry* entry, uint16_t pathLength,
+    uint8_t* record)
+{
+    gbAssert(entry != nullptr);
+    gbAssert(record != nullptr);
+
+    // - Every field is written at a fixed offset, little-endian, so that an
+    //   index reads back the same on any machine and from any compiler.
+    memset(record, 0, GB_LIBRARY_RECORD_SIZE);
+    gbStoreLibraryU64(record + 0, entry->modifiedTime);
+    gbStoreLibraryU64(record + 8, entry->fileSize);
+    gbStoreLibraryU64(record + 16, entry->hash);
+    memcpy(record + 24, entry->title, 16);
+    gbStoreLibraryU16(record + 40, entry->globalChecksum);
+    gbStoreLibraryU16(record + 42, pathLength);
+    record[44] = entry->cgbFlag;
+    record[45] = entry->cartridgeType;
+    record[46] = entry->romSizeByte;
+    record[47] = entry->ramSizeByte;
+    record[48] = entry->headerChecksum;
+    record[49] =
+        (entry->hasHeader ? GB_LIBRARY_HAS_HEADER : 0) |
+        (entry->headerValid ? GB_LIBRARY_HEADER_VALID : 0) |
+        (entry->verified ? GB_LIBRARY_VERIFIED : 0) |
+        (entry->globalValid ? GB_LIBRARY_GLOBAL_VALID : 0);
+}
+
+void gbDecodeLibraryRecord (const uint8_t* record, gbLibraryEntry* entry,
+    uint16_t* outPathLength)
+{
+    gbAssert(record != nullptr);
+    gbAssert(entry != nullptr);
+    gbAssert(outPathLength != nullptr);
+
+    memset(entry, 0, sizeof(*entry));
+    entry->modifiedTime = gbLoadLibraryU64(record + 0);
+    entry->fileSize = gbLoadLibraryU64(record + 8);
+    entry->hash = gbLoadLibraryU64(record + 16);
+    memcpy(entry->title, record + 24, 16);
+    entry->title[16] = '\0';
+    entry->globalChecksum = gbLoadLibraryU16(record + 40);
+    *outPathLength = gbLoadLibraryU16(record + 42);
+    entry->cgbFlag = record[44];
+    entry->cartridgeType = record[45];
+    entry->romSizeByte = record[46];
+    entry->ramSizeByte = record[47];
+    entry->headerChecksum = record[48];
+    entry->hasHeader = (record[49] & GB_LIBRARY_HAS_HEADER) != 0;
+    entry->headerValid = (record[49] & GB_LIBRARY_HEADER_VALID) != 0;
+    entry->verified = (record[49] & GB_LIBRARY_VERIFIED) != 0;
+    entry->globalValid = (record[49] & GB_LIBRARY_GLOBAL_VALID) != 0;
+}
+
+/* Public Function Definitions - Lifecycle ************************************/
+
+gbLibrary* gbCreateLibrary ()
+{
+    gbLibrary* library = gbCreateZero(1, gbLibrary);
+    gbCheckpv(library != nullptr, nullptr,
+        "Error allocating memory for 'gbLibrary'");
+
+    atomic_init(&library->progressDone, 0);
+    atomic_init(&library->progressTotal, 0);
+    return library;
+}
+
+bool gbDestroyLibrary (gbLibrary* library)
+{
+    gbCheckqv(library, false);
+
+    gbDestroyLibraryScan(library->scan);
+    gbFreeLibraryEntries(library->entries, library->entryCount);
+    gbDestroy(library);
+    return true;
+}
+
+/* Public Function Definitions - Scanning *************************************/
+
+bool gbBeginLibraryScan (gbLibrary* library, const char* const* paths,
+    size_t pathCount, uint8_t flags)
+{
+    gbCheckv(library != nullptr, false, "No valid 'gbLibrary' provided.");
+    gbCheckv(paths != nullptr || pathCount == 0, false,
+        "No valid list of file paths provided.");
+    gbCheckv(library->scan == nullptr, false,
+        "A scan of this library is already in progress.");
+
+    gbLibraryScan* scan = gbCreateZero(1, gbLibraryScan);
+    gbCheckpv(scan != nullptr, false, "Error allocating memory for library scan");
+
+    // - Each file is marked failed until its job reads it, or finds its entry
+    //   current, so that a job which never runs leaves its file out.
+    scan->flags = flags;
+    scan->entries = gbCreateZero(pathCount + 1, gbLibraryEntry);
+    scan->failed = gbCreateZero(pathCount + 1, bool);
+    bool result = (scan->entries != nullptr && scan->failed != nullptr);
+    for (size_t i = 0; i < pathCount && result == true; ++i)
+    {
+        size_t length = strlen(paths[i]);
+        char* copy = gbCreate(length + 1, char);
+        result = (copy != nullptr);
+        if (result == true)
+        {
+            memcpy(copy, paths[i], length + 1);
+            scan->entries[scan->count] = (gbLibraryEntry) { .path = copy };
+            scan->failed[scan->count++] = true;
+        }
+    }
+
+    if (result == false)
+    {
+        gbLogErrno("Error allocating memory for library scan");
+        gbDestroyLibraryScan(scan);
+        return false;
+    }
+
+    // - Sort the files, so that the entries the scan ends with are sorted too.
+    if (scan->count > 1)
+    {
+        qsort(scan->entries, scan->count, sizeof(gbLibraryEntry),
+            gbCompareLibraryEntries);
+    }
+
+    atomic_init(&scan->scannedCount, 0);
+    atomic_store(&library->progressDone, 0);
+    atomic_store(&library->progressTotal, scan->count);
+    library->scan = scan;
+    return true;
+}
+
+bool gbRunLibraryScanJob (gbLibrary* library, size_t index)
+{
+    gbCheckv(library != nullptr, false, "No valid 'gbLibrary' provided.");
+    gbLibraryScan* scan = library->scan;
+    gbCheckv(scan != nullptr, false, "No scan of this library is in progress.");
+    gbCheckv(index < scan->count, false,
+        "Library scan job #%zu is out of range (%zu jobs).", index, scan->count);
+
+    gbLibraryEntry* entry = &scan->entries[index];
+    bool result = gbStatLibraryFile(entry->path, &entry->modifiedTime,
+        &entry->fileSize);
+
+    // - Keep the entry of a file which has not changed since it was indexed;
+    //   the library's entries are left alone until the scan ends, so they
+    //   can be searched from every job at once.
+    const gbLibraryEntry* known = nullptr;
+    if (
+        result == true && (scan->flags & GB_LS_RESCAN) == 0 &&
+        library->entryCount > 0
+    )
+    {
+        known = bsearch(entry, library->entries, library->entryCount,
+            sizeof(gbLibraryEntry), gbCompareLibraryEntries);
+    }
+
+    if (
+        known != nullptr &&
+        known->modifiedTime == entry->modifiedTime &&
+        known->fileSize == entry->fileSize &&
+        (known->verified == true || (scan->flags & GB_LS_VERIFY) == 0)
+    )
+    {
+        const char* path = entry->path;
+        *entry = *known;
+        entry->path = path;
+    }
+    else if (result == true)
+    {
+        result = gbScanLibraryFile(entry, scan->flags);
+        atomic_fetch_add(&scan->scannedCount, 1);
+    }
+
+    scan->failed[index] = !result;
+    atomic_fetch_add(&library->progressDone, 1);
+    return result;
+}
+
+bool gbEndLibraryScan (gbLibrary* library)
+{
+    gbCheckv(library != nullptr, false, "No valid 'gbLibrary' provided.");
+    gbLibraryScan* scan = library->scan;
+    gbCheckv(scan != nullptr, false, "No scan of this library is in progress.");
+
+    // - Drop the files which could not be read, then replace the entries.
+    size_t kept = 0;
+    for (size_t i = 0; i < scan->count; ++i)
+    {
+        if (scan->failed[i] == true)
+        {
+            char* path = (char*) scan->entries[i].path;
+            gbLogWarn("Could not read ROM file '%s'.", path);
+            gbDestroy(path);
+            continue;
+        }
+
+        scan->entries[kept++] = scan->entries[i];
+    }
+
+    gbFreeLibraryEntries(library->entries, library->entryCount);
+    library->entries = scan->entries;
+    library->entryCount = kept;
+    library->scannedCount = atomic_load(&scan->scannedCount);
+    library->scan = nullptr;
+
+    gbDestroy(scan->failed);
+    gbDestroy(scan);
+    return true;
+}
+
+void gbGetLibraryProgress (const gbLibrary* library, size_t* outDone,
+    size_t* outTotal)
+{
+    gbLibrary* mutableLibrary = (gbLibrary*) library;
+    if (outDone != nullptr)
+    {
+        *outDone = (library != nullptr) ?
+            atomic_load(&mutableLibrary->progressDone) : 0;
+    }
+
+    if (outTotal != nullptr)
+    {
+        *outTotal = (library != nullptr) ?
+            atomic_load(&mutableLibrary->progressTotal) : 0;
+    }
+}
+
+size_t gbGetLibraryScannedCount (const gbLibrary* library)
+{
+    gbCheckqv(library, 0);
+    return library->scannedCount;
+}
+
+/* Public Function Definitions - Entries **************************************/
+
+size_t gbGetLibraryEntryCount (const gbLibrary* library)
+{
+    gbCheckqv(library, 0);
+    return library->entryCount;
+}
+
+const gbLibraryEntry* gbGetLibraryEntry (const gbLibrary* library,
+    size_t index)
+{
+    gbCheckqv(library != nullptr && index < library->entryCount, nullptr);
+    return &library->entries[index];
+}
+
+/* Public Function Definitions - Files ****************************************/
+
+bool gbLoadLibraryIndex (gbLibrary* library, const char* filepath)
+{
+    gbCheckv(library != nullptr, false, "No valid 'gbLibrary' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+
+    FILE* fp = fopen(filepath, "rb");
+    gbCheckpv(fp != nullptr, false, "Failed to open library index '%s' for reading",
+        filepath);
+
+    uint8_t header[GB_LIBRARY_FILE_HEADER_SIZE];
+    if (
+        fread(header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header, GB_LIBRARY_MAGIC, 4) != 0 ||
+        gbLoadLibraryU16(header + 4) != GB_LIBRARY_VERSION
+    )
+    {
+        gbLogError("File '%s' is not a supported library index.", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    // - Each entry takes at least its record and one byte of path, so an
+    //   entry count the rest of the file cannot hold is corrupt; checking it
+    //   keeps a bad header from driving the allocations below.
+    uint64_t entryCount = gbLoadLibraryU64(header + 8);
+    long headerEnd = ftell(fp);
+    long fileEnd = (fseek(fp, 0, SEEK_END) == 0) ? ftell(fp) : -1;
+    if (
+        headerEnd < 0 || fileEnd < headerEnd ||
+        fseek(fp, headerEnd, SEEK_SET) != 0 ||
+        entryCount > (uint64_t) (fileEnd - headerEnd) /
+            (GB_LIBRARY_RECORD_SIZE + 1)
+    )
+    {
+        gbLogError("Library index '%s' is truncated or corrupt.", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    gbLibraryEntry* entries = nullptr;
+    size_t capacity = 0;
+    size_t count = 0;
+    bool result = true;
+    for (; count < entryCount; ++count)
+    {
+        uint8_t record[GB_LIBRARY_RECORD_SIZE];
+        gbLibraryEntry entry;
+        uint16_t pathLength = 0;
+        if (fread(record, sizeof(record), 1, fp) != 1)
+        {
+            result = false;
+            break;
+        }
+
+        gbDecodeLibraryRecord(record, &entry, &pathLength);
+        if (pathLength == 0 || pathLength > GB_LIBRARY_MAX_PATH)
+        {
+            result = false;
+            break;
+        }
+
+        // - Grow the entries as records are read, rather than trusting the
+        //   header's count up front.
+        if (count == capacity)
+        {
+            size_t newCapacity = (capacity == 0) ? 256 : capacity * 2;
+            gbLibraryEntry* newEntries = gbResize(entries, newCapacity,
+                gbLibraryEntry);
+            if (newEntries == nullptr)
+            {
+                gbLogErrno("Error allocating memory for library entries");
+                result = false;
+                break;
+            }
+
+            entries = newEntries;
+            capacity = newCapacity;
+        }
+
+        char* path = gbCreate(pathLength + 1, char);
+        if (path == nullptr || fread(path, 1, pathLength, fp) != pathLength)
+        {
+            gbDestroy(path);
+            result = false;
+            break;
+        }
+
+        path[pathLength] = '\0';
+        entry.path = path;
+        entries[count] = entry;
+    }
+
+    fclose(fp);
+    if (result == false)
+    {
+        gbLogError("Library index '%s' is truncated or corrupt.", filepath);
+        gbFreeLibraryEntries(entries, count);
+        return false;
+    }
+
+    // - Entries are stored sorted, but sort them anyway, in case the file was
+    //   written on a machine which orders paths differently.
+    if (count > 1)
+    {
+        qsort(entries, count, sizeof(gbLibraryEntry), gbCompareLibraryEntries);
+    }
+
+    gbFreeLibraryEntries(library->entries, library->entryCount);
+    library->entries = entries;
+    library->entryCount = count;
+    library->scannedCount = 0;
+    return true;
+}
+
+bool gbSaveLibraryIndex (const gbLibrary* library, const char* filepath)
+{
+    gbCheckv(library != nullptr, false, "No valid 'gbLibrary' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+
+    // - Write the whole index to a temporary file beside it first, so that a
+    //   crash or a full disk leaves the old index whole.
+    size_t length = strlen(filepath);
+    char* tempPath = gbCreate(length + 5, char);
+    gbCheckpv(tempPath != nullptr, false,
+        "Error allocating memory for the path of library index '%s'", filepath);
+    snprintf(tempPath, length + 5, "%s.tmp", filepath);
+
+    FILE* fp = fopen(tempPath, "wb");
+    if (fp == nullptr)
+    {
+        gbLogErrno("Failed to open library index '%s' for writing", tempPath);
+        gbDestroy(tempPath);
+        return false;
+    }
+
+    uint64_t entryCount = 0;
+    for (size_t i = 0; i < library->entryCount; ++i)
+    {
+        entryCount += (strlen(library->entries[i].path) <= GB_LIBRARY_MAX_PATH);
+    }
+
+    uint8_t header[GB_LIBRARY_FILE_HEADER_SIZE] = { 0 };
+    memcpy(header, GB_LIBRARY_MAGIC, 4);
+    gbStoreLibraryU16(header + 4, GB_LIBRARY_VERSION);
+    gbStoreLibraryU64(header + 8, entryCount);
+
+    bool result = fwrite(header, sizeof(header), 1, fp) == 1;
+    for (size_t i = 0; i < library->entryCount && result == true; ++i)
+    {
+        const gbLibraryEntry* entry = &library->entries[i];
+        size_t pathLength = strlen(entry->path);
+        if (pathLength > GB_LIBRARY_MAX_PATH)
+        {
+            continue;
+        }
+
+        uint8_t record[GB_LIBRARY_RECORD_SIZE];
+        gbEncodeLibraryRecord(entry, (uint16_t) pathLength, record);
+        result =
+            fwrite(record, sizeof(record), 1, fp) == 1 &&
+            fwrite(entry->path, 1, pathLength, fp) == pathLength;
+    }
+
+    // - Flush it all the way to the disk before it replaces the index.
+    result = result && fflush(fp) == 0 &&
+#if defined(GB_WINDOWS)
+        _commit(_fileno(fp)) == 0;
+#else
+        fsync(fileno(fp)) == 0;
+#endif
+
+    if (result == false)
+    {
+        gbLogErrno("Error writing library index '%s'", tempPath);
+    }
+
+    fclose(fp);
+    result = result && gbReplaceLibraryIndex(tempPath, filepath);
+    if (result == false)
+    {
+        remove(tempPath);
+    }
+
+    gbDestroy(tempPath);
+    return result;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file    GB/Library.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's ROM library
+ *          indexer, which reads the headers of ROM files on its caller's
+ *          worker threads, and keeps what it learns in an index file.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Common.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Defines the four-character magic string found at the start of a
+ *          library index file.
+ */
+#define GB_LIBRARY_MAGIC "GBLI"
+
+/**
+ * @brief   Defines the version number of the library index file format.
+ */
+#define GB_LIBRARY_VERSION 2
+
+/**
+ * @brief   Enumerates flags which change how @a `gbBeginLibraryScan` scans
+ *          files.
+ */
+typedef enum gbLibraryScanFlags : uint8_t
+{
+    GB_LS_NONE      = 0x00, /** @brief Read only the header of each file. */
+    GB_LS_VERIFY    = 0x01, /** @brief Also read the whole of each file, to check its global checksum and hash it. */
+    GB_LS_RESCAN    = 0x02  /** @brief Scan every file again, even those whose index entries are current. */
+} gbLibraryScanFlags;
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure representing one ROM file in a library.
+ */
+typedef struct gbLibraryEntry
+{
+    const char*     path;               /** @brief Path of the ROM file; owned by the library. */
+    uint64_t        modifiedTime;       /** @brief Last modification time of the file, in seconds since the epoch. */
+    uint64_t        fileSize;           /** @brief Size of the file, in bytes. */
+    uint64_t        hash;               /** @brief @a `gbHash64` of the whole file, if `verified`; else `0`. */
+    char            title[17];          /** @brief Title from the header, null-terminated. */
+    uint8_t         cgbFlag;            /** @brief `$0143` - CGB Flag */
+    uint8_t         cartridgeType;      /** @brief `$0147` - Cartridge Type (see @a `gbCartridgeType`) */
+    uint8_t         romSizeByte;        /** @brief `$0148` - ROM Size Indicator */
+    uint8_t         ramSizeByte;        /** @brief `$0149` - RAM Size Indicator */
+    uint8_t         headerChecksum;     /** @brief `$014D` - Header Checksum */
+    uint16_t        globalChecksum;     /** @brief `$014E` - Global Checksum, as stored big-endian in the header. */
+    bool            hasHeader;          /** @brief Whether the file is large enough to have a header at all. */
+    bool            headerValid;        /** @brief Whether the header checksum matches. */
+    bool            verified;           /** @brief Whether the whole file was read; see @a `GB_LS_VERIFY`. */
+    bool            globalValid;        /** @brief Whether the global checksum matches, if `verified`. */
+} gbLibraryEntry;
+
+/**
+ * @brief   Defines a structure representing the header of a library index
+ *          file.
+ *
+ * The header is stored in 16 bytes: its fields in order, without padding. It
+ * is followed by `entryCount` records of 52 bytes each, then each record's
+ * path, `pathLength` bytes long, without a null terminator. A record holds,
+ * at these offsets: `modifiedTime` (0), `fileSize` (8) and `hash` (16), eight
+ * bytes each; `title` (24), 16 bytes; `globalChecksum` (40) and `pathLength`
+ * (42), two bytes each; then one byte each of `cgbFlag`, `cartridgeType`,
+ * `romSizeByte`, `ramSizeByte`, `headerChecksum` and flags (44 - 49), and two
+ * reserved bytes. Entries are stored sorted by path.
+ *
+ * @note    All fields are stored little-endian, whatever the byte order of
+ *          the machine which wrote the index file.
+ */
+typedef struct gbLibraryFileHeader
+{
+    char        magic[4];       /** @brief Magic string; see @a `GB_LIBRARY_MAGIC`. */
+    uint16_t    version;        /** @brief File format version; see @a `GB_LIBRARY_VERSION`. */
+    uint16_t    reserved;       /** @brief Reserved; always zero. */
+    uint64_t    entryCount;     /** @brief Number of entries which follow. */
+} gbLibraryFileHeader;
+
+/* Public Types and Forward Declarations **************************************/
+
+/**
+ * @brief   Defines an opaque structure representing a library of ROM files.
+ */
+typedef struct gbLibrary gbLibrary;
+
+/* Public Function Declarations - Lifecycle ***********************************/
+
+/**
+ * @brief   Allocates and creates a new, empty ROM library.
+ *
+ * @return  If successful, returns a pointer to the new @a `gbLibrary`.
+ *          If memory allocation fails, returns `nullptr`.
+ */
+GB_API gbLibrary* gbCreateLibrary ();
+
+/**
+ * @brief   Destroys and deallocates the given ROM library.
+ *
+ * @param   library     A pointer to the @a `gbLibrary` to be destroyed.
+ *
+ * @return  If successful, returns `true`.
+ *          If the library pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbDestroyLibrary (gbLibrary* library);
+
+/* Public Function Declarations - Scanning ************************************/
+
+/**
+ * @brief   Begins a scan of the given ROM files, which will replace the given
+ *          library's entries once @a `gbEndLibraryScan` is called.
+ *
+ * The caller lists the files, and runs the scan's jobs, one per file, with
+ * @a `gbRunLibraryScanJob`, on as many threads as it likes. Each job reads
+ * one header, with a positioned read of `$0100` - `$014F`. A file whose entry
+ * is already in the library, with the same size and modification time, is
+ * not opened at all; so a scan after @a `gbLoadLibraryIndex` only reads files
+ * which are new or changed.
+ *
+ * @param   library     A pointer to the @a `gbLibrary` to be scanned into.
+ * @param   paths       The paths of the ROM files to be scanned. They are
+ *                      copied, so need not outlive this call.
+ * @param   pathCount   The number of paths, and of jobs.
+ * @param   flags       Any of @a `gbLibraryScanFlags`.
+ *
+ * @return  If successful, returns `true`.
+ *          If a scan of the library is already in progress, or allocation
+ *          fails, returns `false`, and the library is left as it was.
+ */
+GB_API bool gbBeginLibraryScan (gbLibrary* library, const char* const* paths,
+    size_t pathCount, uint8_t flags);
+
+/**
+ * @brief   Runs one job of the scan in progress on the given library: reads
+ *          the header of one file, or keeps its current entry.
+ *
+ * Different jobs may run at once, on different threads; the library must not
+ * otherwise be used until @a `gbEndLibraryScan` is called.
+ *
+ * @param   library     A pointer to the @a `gbLibrary` being scanned.
+ * @param   index       The index of the job, less than the number of paths
+ *                      given to @a `gbBeginLibraryScan`.
+ *
+ * @return  If the file was read, or its entry kept, returns `true`.
+ *          If the file cannot be read, returns `false`; it is left out of the
+ *          library, and does not fail the scan.
+ */
+GB_API bool gbRunLibraryScanJob (gbLibrary* library, size_t index);
+
+/**
+ * @brief   Ends the scan in progress on the given library, replacing its
+ *          entries with those of the files which were read or kept. Files
+ *          whose jobs failed, or never ran, are left out.
+ *
+ * @param   library     A pointer to the @a `gbLibrary` being scanned.
+ *
+ * @return  If successful, returns `true`.
+ *          If no scan of the library is in progress, returns `false`.
+ */
+GB_API bool gbEndLibraryScan (gbLibrary* library);
+
+/**
+ * @brief   Retrieves the progress of a scan running on other threads.
+ *
+ * @param   library     A pointer to the @a `gbLibrary` being scanned.
+ * @param   outDone     If not `nullptr`, receives the number of jobs run.
+ * @param   outTotal    If not `nullptr`, receives the number of jobs in the
+ *                      scan.
+ */
+GB_API void gbGetLibraryProgress (const gbLibrary* library, size_t* outDone,
+    size_t* outTotal);
+
+/**
+ * @brief   Retrieves the number of files the last scan of the given library
+ *          actually read, rather than taking from its existing entries.
+ */
+GB_API size_t gbGetLibraryScannedCount (const gbLibrary* library);
+
+/* Public Function Declarations - Entries *************************************/
+
+/**
+ * @brief   Retrieves the number of entries in the given library.
+ */
+GB_API size_t gbGetLibraryEntryCount (const gbLibrary* library);
+
+/**
+ * @brief   Retrieves one entry of the given library. Entries are sorted by
+ *          path.
+ *
+ * @param   library     A pointer to the @a `gbLibrary` to be inspected.
+ * @param   index       The index of the entry.
+ *
+ * @return  A pointer to the entry, valid until the library is next scanned,
+ *          loaded or destroyed; or `nullptr` if the index is out of range.
+ */
+GB_API const gbLibraryEntry* gbGetLibraryEntry (const gbLibrary* library,
+    size_t index);
+
+/* Public Function Declarations - Files ***************************************/
+
+/**
+ * @brief   Replaces the given library's entries with those of an index file.
+ *
+ * @param   library     A pointer to the @a `gbLibrary` to be loaded into.
+ * @param   filepath    The path of the index file.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be read or is not an index file, returns
+ *          `false`, and the library is left as it was.
+ */
+GB_API bool gbLoadLibraryIndex (gbLibrary* library, const char* filepath);
+
+/**
+ * @brief   Writes the given library's entries to an index file; see
+ *          @a `gbLibraryFileHeader`.
+ *
+ * The index is written to a temporary file beside it, flushed to the disk,
+ * then renamed over it, so that a failed write leaves the old index whole.
+ *
+ * @param   library     A pointer to the @a `gbLibrary` to be saved.
+ * @param   filepath    The path of the index file.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be written, returns `false`.
+ */
+GB_API bool gbSaveLibraryIndex (const gbLibrary* library, const char* filepath);
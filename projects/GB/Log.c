@@ -0,0 +1,508 @@
+/**
+ * @file    GB/Log.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's log queue and
+ *          log sink.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <threads.h>
+#include <GB/Log.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The number of messages the log queue holds; a power of two. A
+ *          message logged while the queue is full is dropped, and counted.
+ */
+#define GB_LOG_QUEUE_SIZE       1024
+
+/**
+ * @brief   The longest message, including its `[function] [LEVEL]` prefix;
+ *          longer messages are truncated.
+ */
+#define GB_LOG_MESSAGE_SIZE     256
+
+/**
+ * @brief   The number of call sites whose message rates are tracked; a power
+ *          of two. A call site which finds no free slot is not rate-limited.
+ */
+#define GB_LOG_SITE_COUNT       256
+#define GB_LOG_SITE_PROBES      8
+
+/**
+ * @brief   The number of messages each call site may log per second.
+ */
+#define GB_LOG_SITE_BURST       16
+
+/**
+ * @brief   The longest the log thread sleeps while the queue stays empty.
+ */
+#define GB_LOG_MAX_IDLE_MILLISECONDS    50
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines one slot of the log queue.
+ *
+ * A slot's `sequence` equals its position while it is free for the producer
+ * which claims that position, and the position plus one once its message is
+ * published.
+ */
+typedef struct gbLogEntry
+{
+    atomic_size_t   sequence;
+    gbLogLevel      level;
+    char            message[GB_LOG_MESSAGE_SIZE];
+} gbLogEntry;
+
+/**
+ * @brief   Defines the message rate of one call site.
+ */
+typedef struct gbLogSite
+{
+    atomic_uint_fast64_t    key;        // Hash of function and line; `0` if free.
+    atomic_uint_fast64_t    window;     // Second, in the high 32 bits; count, in the low 32.
+    atomic_uint_fast32_t    suppressed; // Messages dropped, not yet reported.
+    _Atomic(const char*)    function;   // Set as messages are suppressed, for their report.
+    atomic_int              level;      // Likewise.
+} gbLogSite;
+
+/* Private Static Variables ***************************************************/
+
+static once_flag s_logOnce = ONCE_FLAG_INIT;
+static gbLogEntry s_logQueue[GB_LOG_QUEUE_SIZE];
+static atomic_size_t s_logHead;                 // Next position to be claimed.
+static size_t s_logTail;                        // Next position to be drained; under `s_logLock`.
+static gbLogSite s_logSites[GB_LOG_SITE_COUNT];
+static atomic_uint_fast64_t s_logDropped;       // Queue full, or rate-limited.
+static atomic_uint_fast64_t s_logOverflowed;    // Queue full, only.
+static atomic_uint_fast64_t s_logSuppressed;    // Rate-limited, not yet reported.
+static uint64_t s_logOverflowReported;          // Under `s_logLock`.
+
+// - One thread at a time drains the queue: the log thread, a flush, or, once
+//   the thread has stopped (or never started), the logging thread. It holds
+//   `s_logLock` to take each message, but not while the sink runs, so that a
+//   sink may itself log; those messages are drained by the same loop.
+static mtx_t s_logLock;
+static cnd_t s_logDrained;                      // Signalled when a drain ends.
+static bool s_logDraining = false;              // Under `s_logLock`.
+static thrd_t s_logDrainer;                     // Under `s_logLock`.
+static gbLogSink s_logSink = nullptr;           // Under `s_logLock`.
+static void* s_logUserdata = nullptr;           // Under `s_logLock`.
+static thrd_t s_logThread;
+static atomic_bool s_logThreaded;
+static atomic_bool s_logStopping;
+
+/* Private Function Declarations **********************************************/
+
+static void gbWriteDefaultLog (gbLogLevel level, const char* message,
+    void* userdata);
+static void gbInitializeLog ();
+static void gbStopLog ();
+static bool gbAdmitLog (gbLogLevel level, const char* function, int line);
+static void gbPushLog (gbLogLevel level, const char* message);
+static bool gbWaitForLogDrain ();
+static bool gbTakeLog (bool flushing, gbLogLevel* outLevel, char* outMessage);
+static size_t gbDrainLog (bool flushing);
+static int gbLogWorker (void* argument);
+
+/* Private Function Definitions ***********************************************/
+
+void gbWriteDefaultLog (gbLogLevel level, const char* message,
+    void* userdata)
+{
+    (void) userdata;
+
+    FILE* stream = (level == GB_LL_INFO) ? stdout : stderr;
+    fputs(message, stream);
+    fputc('\n', stream);
+}
+
+void gbInitializeLog ()
+{
+    for (size_t i = 0; i < GB_LOG_QUEUE_SIZE; ++i)
+    {
+        atomic_init(&s_logQueue[i].sequence, i);
+    }
+
+    mtx_init(&s_logLock, mtx_plain);
+    cnd_init(&s_logDrained);
+
+    // - Without a log thread, each message is written as it is logged, as
+    //   it always was.
+    atomic_store(&s_logThreaded,
+        thrd_create(&s_logThread, gbLogWorker, nullptr) == thrd_success);
+    atexit(gbStopLog);
+}
+
+void gbStopLog ()
+{
+    if (atomic_exchange(&s_logThreaded, false) == true)
+    {
+        atomic_store(&s_logStopping, true);
+        thrd_join(s_logThread, nullptr);
+    }
+
+    gbDrainLog(true);
+}
+
+bool gbAdmitLog (gbLogLevel level, const char* function, int line)
+{
+    uint64_t key = ((uint64_t) (uintptr_t) function * 0x9E3779B97F4A7C15ull) ^
+        (uint64_t) line;
+    key += (key == 0);
+
+    gbLogSite* site = nullptr;
+    for (size_t probe = 0; probe < GB_LOG_SITE_PROBES && site == nullptr; ++probe)
+    {
+        gbLogSite* candidate =
+            &s_logSites[(key + probe) & (GB_LOG_SITE_COUNT - 1)];
+        uint_fast64_t expected = 0;
+        if (atomic_load(&candidate->key) == key ||
+            atomic_compare_exchange_strong(&candidate->key, &expected, key) ||
+            expected == key)
+        {
+            site = candidate;
+        }
+    }
+
+    if (site == nullptr)
+    {
+        return true;
+    }
+
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    uint64_t second = (uint64_t) now.tv_sec & 0xFFFFFFFF;
+
+    uint_fast64_t window = atomic_load(&site->window);
+    while (true)
+    {
+        if ((window >> 32) != second)
+        {
+            // - The first message of a new second reports what the last ones
+            //   suppressed.
+            if (atomic_compare_exchange_weak(&site->window, &window,
+                (second << 32) | 1) == true)
+            {
+                uint_fast32_t suppressed = atomic_exchange(&site->suppressed, 0);
+                if (suppressed > 0)
+                {
+                    atomic_fetch_sub(&s_logSuppressed, suppressed);
+                    char message[GB_LOG_MESSAGE_SIZE];
+                    snprintf(message, sizeof(message),
+                        "[%s] [%s] %u similar messages suppressed.", function,
+                        gbStringifyLogLevel(level), (unsigned) suppressed);
+                    gbPushLog(level, message);
+                }
+
+                return true;
+            }
+        }
+        else if ((window & 0xFFFFFFFF) < GB_LOG_SITE_BURST)
+        {
+            if (atomic_compare_exchange_weak(&site->window, &window,
+                window + 1) == true)
+            {
+                return true;
+            }
+        }
+        else
+        {
+            atomic_store(&site->function, function);
+            atomic_store(&site->level, (int) level);
+            atomic_fetch_add(&site->suppressed, 1);
+            atomic_fetch_add(&s_logSuppressed, 1);
+            atomic_fetch_add(&s_logDropped, 1);
+            return false;
+        }
+    }
+}
+
+void gbPushLog (gbLogLevel level, const char* message)
+{
+    size_t position = atomic_load_explicit(&s_logHead, memory_order_relaxed);
+    gbLogEntry* entry = nullptr;
+    while (true)
+    {
+        entry = &s_logQueue[position & (GB_LOG_QUEUE_SIZE - 1)];
+        size_t sequence =
+            atomic_load_explicit(&entry->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t) sequence - (intptr_t) position;
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&s_logHead, &position,
+                position + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            atomic_fetch_add(&s_logDropped, 1);
+            atomic_fetch_add(&s_logOverflowed, 1);
+            return;
+        }
+        else
+        {
+            position = atomic_load_explicit(&s_logHead, memory_order_relaxed);
+        }
+    }
+
+    entry->level = level;
+    strncpy(entry->message, message, GB_LOG_MESSAGE_SIZE - 1);
+    entry->message[GB_LOG_MESSAGE_SIZE - 1] = '\0';
+    atomic_store_explicit(&entry->sequence, position + 1, memory_order_release);
+}
+
+bool gbWaitForLogDrain ()
+{
+    // - Called under `s_logLock`. A sink which logs, flushes or sets the sink
+    //   is already draining; it must not wait for itself.
+    while (s_logDraining == true)
+    {
+        if (thrd_equal(s_logDrainer, thrd_current()) != 0)
+        {
+            return false;
+        }
+
+        cnd_wait(&s_logDrained, &s_logLock);
+    }
+
+    return true;
+}
+
+bool gbTakeLog (bool flushing, gbLogLevel* outLevel, char* outMessage)
+{
+    // - Called under `s_logLock`. Queued messages come first, copied out so
+    //   that their slot is free before the sink sees them.
+    gbLogEntry* entry = &s_logQueue[s_logTail & (GB_LOG_QUEUE_SIZE - 1)];
+    if (
+        atomic_load_explicit(&entry->sequence, memory_order_acquire) ==
+        s_logTail + 1
+    )
+    {
+        *outLevel = entry->level;
+        memcpy(outMessage, entry->message, GB_LOG_MESSAGE_SIZE);
+        atomic_store_explicit(&entry->sequence, s_logTail + GB_LOG_QUEUE_SIZE,
+            memory_order_release);
+        s_logTail++;
+        return true;
+    }
+
+    uint64_t overflowed = atomic_load(&s_logOverflowed);
+    if (overflowed != s_logOverflowReported)
+    {
+        *outLevel = GB_LL_WARN;
+        snprintf(outMessage, GB_LOG_MESSAGE_SIZE,
+            "[%s] [WARN] Log queue full; %llu messages dropped.", __FUNCTION__,
+            (unsigned long long) (overflowed - s_logOverflowReported));
+        s_logOverflowReported = overflowed;
+        return true;
+    }
+
+    // - Report what a call site suppressed once its second is over, rather
+    //   than waiting for it to log again, which it may never do. A flush
+    //   reports everything still pending.
+    if (atomic_load(&s_logSuppressed) == 0)
+    {
+        return false;
+    }
+
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    uint64_t second = (uint64_t) now.tv_sec & 0xFFFFFFFF;
+    for (size_t i = 0; i < GB_LOG_SITE_COUNT; ++i)
+    {
+        gbLogSite* site = &s_logSites[i];
+        if (
+            atomic_load(&site->suppressed) == 0 ||
+            (flushing == false && (atomic_load(&site->window) >> 32) == second)
+        )
+        {
+            continue;
+        }
+
+        uint_fast32_t suppressed = atomic_exchange(&site->suppressed, 0);
+        if (suppressed > 0)
+        {
+            atomic_fetch_sub(&s_logSuppressed, suppressed);
+            *outLevel = (gbLogLevel) atomic_load(&site->level);
+            snprintf(outMessage, GB_LOG_MESSAGE_SIZE,
+                "[%s] [%s] %u similar messages suppressed.",
+                atomic_load(&site->function), gbStringifyLogLevel(*outLevel),
+                (unsigned) suppressed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+size_t gbDrainLog (bool flushing)
+{
+    mtx_lock(&s_logLock);
+    if (gbWaitForLogDrain() == false)
+    {
+        mtx_unlock(&s_logLock);
+        return 0;
+    }
+
+    s_logDraining = true;
+    s_logDrainer = thrd_current();
+
+    // - Take each message under the lock, then release it while the sink runs.
+    size_t count = 0;
+    bool wroteDefault = false;
+    gbLogLevel level = GB_LL_INFO;
+    char message[GB_LOG_MESSAGE_SIZE];
+    while (gbTakeLog(flushing, &level, message) == true)
+    {
+        gbLogSink sink = (s_logSink != nullptr) ? s_logSink : gbWriteDefaultLog;
+        void* userdata = s_logUserdata;
+        mtx_unlock(&s_logLock);
+
+        sink(level, message, userdata);
+        wroteDefault |= (sink == gbWriteDefaultLog);
+        count++;
+
+        mtx_lock(&s_logLock);
+    }
+
+    s_logDraining = false;
+    cnd_broadcast(&s_logDrained);
+    mtx_unlock(&s_logLock);
+
+    // - The default sink flushes once per batch, not once per message.
+    if (wroteDefault == true)
+    {
+        fflush(stdout);
+        fflush(stderr);
+    }
+
+    return count;
+}
+
+int gbLogWorker (void* argument)
+{
+    (void) argument;
+
+    // - Sleep longer each time the queue is found empty, and drain it again
+    //   without sleeping while messages keep arriving.
+    uint32_t idleMilliseconds = 1;
+    while (atomic_load(&s_logStopping) == false)
+    {
+        size_t count = gbDrainLog(false);
+        if (count > 0)
+        {
+            idleMilliseconds = 1;
+            continue;
+        }
+
+        struct timespec duration =
+        {
+            .tv_sec = 0,
+            .tv_nsec = (long) idleMilliseconds * 1000000L
+        };
+        thrd_sleep(&duration, nullptr);
+
+        idleMilliseconds *= 2;
+        if (idleMilliseconds > GB_LOG_MAX_IDLE_MILLISECONDS)
+        {
+            idleMilliseconds = GB_LOG_MAX_IDLE_MILLISECONDS;
+        }
+    }
+
+    return 0;
+}
+
+/* Public Function Definitions ************************************************/
+
+void gbWriteLog (gbLogLevel level, const char* function, int line,
+    int error, const char* format, ...)
+{
+    // - Logging must not disturb `errno` for the caller.
+    int savedErrno = errno;
+    call_once(&s_logOnce, gbInitializeLog);
+
+    // - A call site over its rate is turned away before its message is
+    //   formatted, so a flood of errors costs little more than a counter.
+    if (gbAdmitLog(level, function, line) == true)
+    {
+        char message[GB_LOG_MESSAGE_SIZE];
+        int length = snprintf(message, sizeof(message), "[%s] [%s] ",
+            function, gbStringifyLogLevel(level));
+        if (length >= 0 && (size_t) length < sizeof(message))
+        {
+            va_list args;
+            va_start(args, format);
+            int written = vsnprintf(message + length, sizeof(message) - length,
+                format, args);
+            va_end(args);
+
+            if (written > 0)
+            {
+                length += written;
+            }
+        }
+
+        if (error != 0 && length >= 0 && (size_t) length < sizeof(message))
+        {
+            snprintf(message + length, sizeof(message) - length, ": '%s'",
+                strerror(error));
+        }
+
+        gbPushLog(level, message);
+        if (atomic_load(&s_logThreaded) == false)
+        {
+            gbDrainLog(false);
+        }
+    }
+
+    errno = savedErrno;
+}
+
+bool gbSetLogSink (gbLogSink sink, void* userdata)
+{
+    call_once(&s_logOnce, gbInitializeLog);
+
+    gbDrainLog(true);
+
+    mtx_lock(&s_logLock);
+    gbWaitForLogDrain();
+    s_logSink = sink;
+    s_logUserdata = userdata;
+    mtx_unlock(&s_logLock);
+
+    return true;
+}
+
+bool gbFlushLog ()
+{
+    call_once(&s_logOnce, gbInitializeLog);
+    gbDrainLog(true);
+
+    return true;
+}
+
+uint64_t gbGetDroppedLogCount ()
+{
+    return atomic_load(&s_logDropped);
+}
+
+const char* gbStringifyLogLevel (gbLogLevel level)
+{
+    switch (level)
+    {
+        case GB_LL_INFO:    return "INFO";
+        case GB_LL_WARN:    return "WARN";
+        case GB_LL_ERROR:   return "ERROR";
+        default:            return "UNKNOWN";
+    }
+}
@@ -0,0 +1,76 @@
+/**
+ * @file    GB/Log.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's log sink,
+ *          which receives the messages logged with @a `gbLogInfo` and its
+ *          siblings.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Common.h>
+
+/* Public Types and Forward Declarations **************************************/
+
+/**
+ * @brief   Defines a function which receives the core's log messages.
+ *
+ * Messages are delivered in order, one at a time, from the core's log
+ * thread; the sink need not be thread-safe, but must not block for long. The
+ * sink may itself log; its messages are delivered after the one it is given.
+ *
+ * @param   level       The level of the message.
+ * @param   message     The message, formatted as `[function] [LEVEL] text`,
+ *                      without a trailing newline.
+ * @param   userdata    The pointer given to @a `gbSetLogSink`.
+ */
+typedef void (*gbLogSink) (gbLogLevel level, const char* message,
+    void* userdata);
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Sets the function which receives the core's log messages. Messages
+ *          already queued are delivered to the old sink first.
+ *
+ * @param   sink        The new sink. Pass `nullptr` to restore the default,
+ *                      which writes info messages to `stdout` and the rest to
+ *                      `stderr`.
+ * @param   userdata    A pointer to be passed to the sink.
+ *
+ * @return  Returns `true`.
+ */
+GB_API bool gbSetLogSink (gbLogSink sink, void* userdata);
+
+/**
+ * @brief   Waits until every message logged so far has been delivered to the
+ *          sink, along with a count of any messages suppressed for logging
+ *          too often.
+ *
+ * @return  Returns `true`.
+ */
+GB_API bool gbFlushLog ();
+
+/**
+ * @brief   Retrieves the number of messages which were dropped, not queued,
+ *          because the log queue was full or their call site was logging too
+ *          often.
+ *
+ * @return  The number of messages dropped since the program started.
+ */
+GB_API uint64_t gbGetDroppedLogCount ();
+
+/**
+ * @brief   Retrieves a string naming the given log level, as it appears in
+ *          log messages.
+ *
+ * @param   level       The log level to be named.
+ *
+ * @return  A pointer to a static string naming the level (e.g., `"INFO"`), or
+ *          `"UNKNOWN"` if @a `level` is not a valid log level.
+ */
+GB_API const char* gbStringifyLogLevel (gbLogLevel level);
@@ -9,6 +9,7 @@
 
 /* Private Includes ***********************************************************/
 
+#include <GB/Hash.h>
 #include <GB/Memory.h>
 
 /* Private Constants and Enumerations *****************************************/
@@ -33,12 +34,28 @@ struct gbMemory
     // Memory
     uint8_t    wram[GB_WRAM_TOTAL_SIZE];
     uint8_t    hram[GB_HRAM_SIZE];
+    uint8_t*   wramBank;    // The switchable bank `SVBK` selects; updated on each write to it.
 
     // Hardware Registers
     gbRegisterSVBK  svbk;
 
 };
 
+/* Private Function Declarations - Helper Functions ***************************/
+
+static void gbSelectWorkRAMBank (gbMemory* memory, uint8_t bank);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+void gbSelectWorkRAMBank (gbMemory* memory, uint8_t bank)
+{
+    gbAssert(memory != nullptr);
+
+    // - Bank `0` cannot be selected into `$D000` - `$DFFF`; it maps to `1`.
+    if (bank == 0) { bank = 1; }
+    memory->wramBank = memory->wram + (bank * GB_WRAM_BANK_SIZE);
+}
+
 /* Public Function Definitions ************************************************/
 
 gbMemory* gbCreateMemory (gbContext* parentContext)
@@ -49,6 +66,7 @@ gbMemory* gbCreateMemory (gbContext* parentContext)
     gbCheckpv(memory != nullptr, nullptr, "Error allocating memory for 'gbMemory'");
 
     memory->parent = parentContext;
+    gbSelectWorkRAMBank(memory, 1);
     return memory;
 }
 
@@ -70,6 +88,7 @@ bool gbInitializeMemory (gbMemory* memory)
 
     // Initialize Hardware Registers
     memory->svbk.raw = 1;
+    gbSelectWorkRAMBank(memory, 1);
 
     return true;
 }
@@ -86,28 +105,13 @@ bool gbReadWorkRAM (const gbMemory* memory, uint16_t relativeAddress,
     gbCheckv(outValue != nullptr, false,
         "Output value pointer is null");
         
-    // - Check for CGB Mode and Engine Mode
-    bool isCGBMode = false, isEngineMode = false;
-    gbCheckCGBMode(memory->parent, &isCGBMode);
-    gbCheckEngineMode(memory->parent, &isEngineMode);
-
-    // - Determine active WRAM bank.
-    //   - In Engine Mode, use all 8 bits of the SVBK register, mapping `0` to `1`.
-    //   - In CGB Mode, use only bits 0-2 of the SVBK register, mapping `0` to `1`.
-    //   - In non-CGB Mode, always use bank `1`.
-    uint8_t wramBank = 1;
-    if (isEngineMode)
-        { wramBank = memory->svbk.raw; }
-    else if (isCGBMode)
-        { wramBank = memory->svbk.wramBank; }
-    if (wramBank == 0) { wramBank = 1; }
-
-    // - Calculate absolute address within WRAM.
-    size_t absoluteAddress = (wramBank * GB_WRAM_BANK_SIZE) +
-        (relativeAddress % GB_WRAM_BANK_SIZE);
+    // - Bank `0` is fixed at `$C000`; the bank `SVBK` selects, cached when it
+    //   is written, is at `$D000`.
+    const uint8_t* bank = (relativeAddress < GB_WRAM_BANK_SIZE) ?
+        memory->wram : memory->wramBank;
 
     // - Read value from WRAM.
-    *outValue = memory->wram[absoluteAddress];
+    *outValue = bank[relativeAddress & (GB_WRAM_BANK_SIZE - 1)];
     return true;
 }
 
@@ -136,28 +140,13 @@ bool gbWriteWorkRAM (gbMemory* memory, uint16_t relativeAddress,
     gbCheckv(outActual != nullptr, false,
         "Output actual value pointer is null");
 
-    // - Check for CGB Mode and Engine Mode
-    bool isCGBMode = false, isEngineMode = false;
-    gbCheckCGBMode(memory->parent, &isCGBMode);
-    gbCheckEngineMode(memory->parent, &isEngineMode);
-    
-    // - Determine active WRAM bank.
-    //   - In Engine Mode, use all 8 bits of the SVBK register, mapping `0` to `1`.
-    //   - In CGB Mode, use only bits 0-2 of the SVBK register, mapping `0` to `1`.
-    //   - In non-CGB Mode, always use bank `1`.
-    uint8_t wramBank = 1;
-    if (isEngineMode)
-        { wramBank = memory->svbk.raw; }
-    else if (isCGBMode)
-        { wramBank = memory->svbk.wramBank; }
-    if (wramBank == 0) { wramBank = 1; }
-
-    // - Calculate absolute address within WRAM.
-    size_t absoluteAddress = (wramBank * GB_WRAM_BANK_SIZE) +
-        (relativeAddress % GB_WRAM_BANK_SIZE);
+    // - Bank `0` is fixed at `$C000`; the bank `SVBK` selects, cached when it
+    //   is written, is at `$D000`.
+    uint8_t* bank = (relativeAddress < GB_WRAM_BANK_SIZE) ?
+        memory->wram : memory->wramBank;
 
     // - Write value to WRAM.
-    memory->wram[absoluteAddress] = value;
+    bank[relativeAddress & (GB_WRAM_BANK_SIZE - 1)] = value;
     *outActual = value;
     return true;
 }
@@ -178,6 +167,51 @@ bool gbWriteHighRAM (gbMemory* memory, uint16_t relativeAddress,
     return true;
 }
 
+bool gbHashMemory (const gbMemory* memory, uint64_t seed, uint64_t* outHash)
+{
+    gbFallback(memory, gbGetMemory(nullptr));
+    gbCheckqv(memory, false);
+    gbCheckv(outHash != nullptr, false, "No valid output pointer provided for hash.");
+
+    seed = gbHash64(memory->wram, sizeof(memory->wram), seed);
+    seed = gbHash64(memory->hram, sizeof(memory->hram), seed);
+    *outHash = gbHash64(&memory->svbk.raw, 1, seed);
+    return true;
+}
+
+bool gbCopyWorkRAM (const gbMemory* memory, uint8_t* image, size_t imageSize)
+{
+    gbFallback(memory, gbGetMemory(nullptr));
+    gbCheckqv(memory, false);
+    gbCheckv(image != nullptr, false, "No valid image buffer provided.");
+    gbCheckv(imageSize <= sizeof(memory->wram), false,
+        "Cannot copy %zu bytes; WRAM is %zu bytes.", imageSize,
+        sizeof(memory->wram));
+
+    memcpy(image, memory->wram, imageSize);
+    return true;
+}
+
+bool gbCopyHighRAM (const gbMemory* memory, uint8_t* image)
+{
+    gbFallback(memory, gbGetMemory(nullptr));
+    gbCheckqv(memory, false);
+    gbCheckv(image != nullptr, false, "No valid image buffer provided.");
+
+    memcpy(image, memory->hram, sizeof(memory->hram));
+    return true;
+}
+
+uint8_t* gbGetWorkRAMWindow (gbMemory* memory, uint16_t relativeAddress)
+{
+    gbFallback(memory, gbGetMemory(nullptr));
+    gbCheckqv(memory, nullptr);
+    gbCheckqv(relativeAddress < GB_WRAM_SIZE, nullptr);
+
+    return (relativeAddress < GB_WRAM_BANK_SIZE) ?
+        memory->wram : memory->wramBank;
+}
+
 /* Public Function Definitions - Hardware Register Access *********************/
 
 bool gbReadSVBK (const gbMemory* memory, uint8_t* outValue,
@@ -242,10 +276,14 @@ bool gbWriteSVBK (gbMemory* memory, uint8_t value, uint8_t* outActual,
     //   - Bits 0-2 are writable.
     // - In non-CGB Mode:
     //   - This register is not available and writes are ignored.
+    //
+    // - The bank selected is cached here, so that WRAM accesses need not
+    //   check the mode or decode `SVBK` again.
     if (isEngineMode)
     {
         memory->svbk.raw = value;
         *outActual = value;
+        gbSelectWorkRAMBank(memory, memory->svbk.raw);
     }
     else if (isCGBMode)
     {
@@ -253,6 +291,7 @@ bool gbWriteSVBK (gbMemory* memory, uint8_t value, uint8_t* outActual,
             (0b11111000) |                      // Bits 3-7 are unused; write as `1`
             (value & 0b00000111);               // Bits 0-2 are writable as-is
         *outActual = memory->svbk.raw;
+        gbSelectWorkRAMBank(memory, memory->svbk.wramBank);
     }
     else
     {
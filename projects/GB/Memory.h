@@ -177,6 +177,75 @@ GB_API bool gbWriteWorkRAM (gbMemory* memory, uint16_t relativeAddress,
 GB_API bool gbWriteHighRAM (gbMemory* memory, uint16_t relativeAddress, 
     uint8_t value, uint8_t* outActual, const gbCheckRules* rules);
 
+/**
+ * @brief   Computes a 64-bit hash of every WRAM bank, HRAM and the `SVBK`
+ *          register of the given memory component, for comparing the states of
+ *          two contexts cheaply.
+ * 
+ * @param   memory      A pointer to the @a `gbMemory` structure to be hashed.
+ *                      Pass `nullptr` to use the current context's memory.
+ * @param   seed        The seed value, or the hash of preceding state.
+ * @param   outHash     A pointer to a variable where the hash will be stored.
+ *                      Must not be `nullptr`.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no memory component is provided (i.e., `nullptr`) and no current
+ *          context exists, returns `false`.
+ */
+GB_API bool gbHashMemory (const gbMemory* memory, uint64_t seed,
+    uint64_t* outHash);
+
+/**
+ * @brief   Copies the given memory component's WRAM banks, from bank `0`
+ *          onward, regardless of which bank `SVBK` selects.
+ * 
+ * @param   memory      A pointer to the @a `gbMemory` structure to be copied.
+ *                      Pass `nullptr` to use the current context's memory.
+ * @param   image       A pointer to the buffer to be filled. Must not be
+ *                      `nullptr`.
+ * @param   imageSize   The number of bytes to copy; at most the size of all
+ *                      WRAM banks together.
+ * 
+ * @return  If successful, returns `true`.
+ *          If invalid parameters are provided, returns `false`.
+ */
+GB_API bool gbCopyWorkRAM (const gbMemory* memory, uint8_t* image,
+    size_t imageSize);
+
+/**
+ * @brief   Copies the given memory component's HRAM, from `$FF80` through
+ *          `$FFFE`.
+ * 
+ * @param   memory      A pointer to the @a `gbMemory` structure to be copied.
+ *                      Pass `nullptr` to use the current context's memory.
+ * @param   image       A pointer to the buffer to be filled, which must hold at
+ *                      least `GB_HRAM_SIZE` bytes. Must not be `nullptr`.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no memory component is provided (i.e., `nullptr`) and no current
+ *          context exists, or if @a `image` is `nullptr`, returns `false`.
+ */
+GB_API bool gbCopyHighRAM (const gbMemory* memory, uint8_t* image);
+
+/**
+ * @brief   Retrieves the host memory behind the 4 KiB WRAM bank mapped at the
+ *          given address: bank `0` below `$1000`, and the bank `SVBK` selects
+ *          from there up to `$1FFF`.
+ *
+ * The pointer to the selected bank changes only when `SVBK` is written, so a
+ * caller which maps WRAM straight to host memory need only fetch it again
+ * after such a write.
+ *
+ * @param   memory          A pointer to the @a `gbMemory` structure to be
+ *                          inspected. Pass `nullptr` to use the current
+ *                          context's memory.
+ * @param   relativeAddress The address, relative to `$C000`.
+ *
+ * @return  If successful, returns a pointer to the start of the bank.
+ *          If invalid parameters are provided, returns `nullptr`.
+ */
+GB_API uint8_t* gbGetWorkRAMWindow (gbMemory* memory, uint16_t relativeAddress);
+
 /* Public Function Declarations - Hardware Register Access ********************/
 
 /**
@@ -0,0 +1,498 @@
+/**
+ * @file    GB/Patch.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's ROM patcher.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Patch.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The largest image a patch may produce; larger than any cartridge,
+ *          so that a corrupt size cannot exhaust memory.
+ */
+#define GB_PATCH_MAX_IMAGE_SIZE 0x2000000
+
+/**
+ * @brief   The CRC-32 of each nibble value, for the reflected polynomial
+ *          `0xEDB88320`.
+ */
+static const uint32_t GB_CRC32_NIBBLES[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a read cursor over a patch.
+ */
+typedef struct gbPatchReader
+{
+    const uint8_t*  data;
+    size_t          size;           // Readable size; excludes any footer.
+    size_t          offset;
+    bool            overrun;        // Set once a read passes `size`.
+} gbPatchReader;
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static uint8_t gbReadPatchByte (gbPatchReader* reader);
+static uint64_t gbReadPatchNumber (gbPatchReader* reader);
+static uint32_t gbReadPatchCRC (const uint8_t* data);
+static bool gbCheckPatchFooter (const char* name, const uint8_t* patch,
+    size_t patchSize, const uint8_t* source, size_t sourceSize,
+    uint64_t expectedSourceSize);
+static bool gbMovePatchOffset (uint64_t* ioOffset, uint64_t delta,
+    uint64_t limit);
+static bool gbApplyIPS (const uint8_t* patch, size_t patchSize,
+    uint8_t** ioData, size_t* ioSize);
+static bool gbApplyUPS (const uint8_t* patch, size_t patchSize,
+    uint8_t** ioData, size_t* ioSize);
+static bool gbApplyBPS (const uint8_t* patch, size_t patchSize,
+    uint8_t** ioData, size_t* ioSize);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+uint8_t gbReadPatchByte (gbPatchReader* reader)
+{
+    gbAssert(reader != nullptr);
+
+    if (reader->offset >= reader->size)
+    {
+        reader->overrun = true;
+        return 0;
+    }
+
+    return reader->data[reader->offset++];
+}
+
+uint64_t gbReadPatchNumber (gbPatchReader* reader)
+{
+    gbAssert(reader != nullptr);
+
+    // - UPS and BPS encode numbers seven bits at a time, least significant
+    //   first, with each continuation adding one so no value has two forms.
+    uint64_t value = 0, shift = 1;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        uint8_t byte = gbReadPatchByte(reader);
+        value += (byte & 0x7F) * shift;
+        if ((byte & 0x80) != 0 || reader->overrun == true)
+        {
+            return value;
+        }
+
+        shift <<= 7;
+        value += shift;
+    }
+
+    reader->overrun = true;
+    return 0;
+}
+
+uint32_t gbReadPatchCRC (const uint8_t* data)
+{
+    return
+        ((uint32_t) data[0]      ) | ((uint32_t) data[1] <<  8) |
+        ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+bool gbCheckPatchFooter (const char* name, const uint8_t* patch,
+    size_t patchSize, const uint8_t* source, size_t sourceSize,
+    uint64_t expectedSourceSize)
+{
+    // - The footer holds the CRC-32s of the source, the target, and the patch
+    //   up to its own last four bytes.
+    const uint8_t* footer = patch + patchSize - 12;
+    if (gbComputeCRC32(patch, patchSize - 4, 0) != gbReadPatchCRC(footer + 8))
+    {
+        gbLogError("The %s patch is corrupt: its checksum does not match.", name);
+        return false;
+    }
+
+    if (
+        sourceSize != expectedSourceSize ||
+        gbComputeCRC32(source, sourceSize, 0) != gbReadPatchCRC(footer)
+    )
+    {
+        gbLogError("The %s patch was made for a different ROM.", name);
+        return false;
+    }
+
+    return true;
+}
+
+bool gbMovePatchOffset (uint64_t* ioOffset, uint64_t delta, uint64_t limit)
+{
+    gbAssert(ioOffset != nullptr);
+
+    // - BPS encodes a relative move as its magnitude, shifted left, with the
+    //   sign in bit 0. Offsets are unsigned, so a move below `0` or past the
+    //   limit is refused before it can wrap around.
+    uint64_t magnitude = delta >> 1;
+    if ((delta & 1) != 0)
+    {
+        if (magnitude > *ioOffset) { return false; }
+        *ioOffset -= magnitude;
+    }
+    else
+    {
+        if (*ioOffset > limit || magnitude > limit - *ioOffset) { return false; }
+        *ioOffset += magnitude;
+    }
+
+    return true;
+}
+
+bool gbApplyIPS (const uint8_t* patch, size_t patchSize, uint8_t** ioData,
+    size_t* ioSize)
+{
+    // - The first pass only checks the records, and finds how far they reach;
+    //   the second applies them. So a truncated patch leaves the image as it
+    //   was, and the image is grown at most once.
+    size_t extent = *ioSize, truncated = SIZE_MAX;
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        gbPatchReader reader = { .data = patch, .size = patchSize, .offset = 5 };
+        bool ended = false;
+        while (true)
+        {
+            size_t offset =
+                ((size_t) gbReadPatchByte(&reader) << 16) |
+                ((size_t) gbReadPatchByte(&reader) << 8) |
+                gbReadPatchByte(&reader);
+            if (reader.overrun == true)
+            {
+                break;
+            }
+
+            // - `EOF` ends the records; it may be followed by a size to
+            //   truncate the image to.
+            if (offset == 0x454F46)
+            {
+                if (reader.size - reader.offset >= 3)
+                {
+                    truncated =
+                        ((size_t) patch[reader.offset] << 16) |
+                        ((size_t) patch[reader.offset + 1] << 8) |
+                        patch[reader.offset + 2];
+                }
+
+                ended = true;
+                break;
+            }
+
+            size_t length = ((size_t) gbReadPatchByte(&reader) << 8) |
+                gbReadPatchByte(&reader);
+            bool runLength = (length == 0);
+            uint8_t fill = 0;
+            if (runLength == true)
+            {
+                length = ((size_t) gbReadPatchByte(&reader) << 8) |
+                    gbReadPatchByte(&reader);
+                fill = gbReadPatchByte(&reader);
+            }
+
+            if (
+                reader.overrun == true ||
+                (runLength == false && reader.size - reader.offset < length)
+            )
+            {
+                break;
+            }
+
+            if (pass == 0 && offset + length > extent)
+            {
+                extent = offset + length;
+            }
+            else if (pass == 1 && runLength == true)
+            {
+                memset(*ioData + offset, fill, length);
+            }
+            else if (pass == 1)
+            {
+                memcpy(*ioData + offset, patch + reader.offset, length);
+            }
+
+            reader.offset += (runLength == true) ? 0 : length;
+        }
+
+        if (ended == false)
+        {
+            gbLogError("The IPS patch is truncated.");
+            return false;
+        }
+
+        // - A record may write past the end of the image, growing it.
+        if (pass == 0 && extent > *ioSize)
+        {
+            uint8_t* grown = gbResize(*ioData, extent, uint8_t);
+            gbCheckpv(grown != nullptr, false,
+                "Error allocating memory for the patched ROM image");
+
+            memset(grown + *ioSize, 0, extent - *ioSize);
+            *ioData = grown;
+        }
+    }
+
+    *ioSize = (truncated < extent) ? truncated : extent;
+    return true;
+}
+
+bool gbApplyUPS (const uint8_t* patch, size_t patchSize, uint8_t** ioData,
+    size_t* ioSize)
+{
+    if (patchSize < 4 + 12)
+    {
+        gbLogError("The UPS patch is truncated.");
+        return false;
+    }
+
+    gbPatchReader reader = { .data = patch, .size = patchSize - 12, .offset = 4 };
+    uint64_t sourceSize = gbReadPatchNumber(&reader);
+    uint64_t targetSize = gbReadPatchNumber(&reader);
+    if (reader.overrun == true || targetSize > GB_PATCH_MAX_IMAGE_SIZE)
+    {
+        gbLogError("The UPS patch has an invalid header.");
+        return false;
+    }
+
+    if (gbCheckPatchFooter("UPS", patch, patchSize, *ioData, *ioSize,
+        sourceSize) == false)
+    {
+        return false;
+    }
+
+    // - The target starts as the source, and each hunk XORs a run of bytes
+    //   some distance past the last one. Bytes past the source read as zero.
+    uint8_t* target = gbCreateZero(targetSize + 1, uint8_t);
+    gbCheckpv(target != nullptr, false,
+        "Error allocating memory for the patched ROM image");
+
+    memcpy(target, *ioData, (*ioSize < targetSize) ? *ioSize : (size_t) targetSize);
+    uint64_t position = 0;
+    while (reader.offset < reader.size && reader.overrun == false)
+    {
+        position += gbReadPatchNumber(&reader);
+        while (reader.overrun == false)
+        {
+            uint8_t delta = gbReadPatchByte(&reader);
+            if (position < targetSize)
+            {
+                target[position] ^= delta;
+            }
+
+            position++;
+            if (delta == 0)
+            {
+                break;
+            }
+        }
+    }
+
+    if (
+        reader.overrun == true ||
+        gbComputeCRC32(target, targetSize, 0) != gbReadPatchCRC(patch + patchSize - 8)
+    )
+    {
+        gbLogError("The UPS patch did not produce the image it describes.");
+        gbDestroy(target);
+        return false;
+    }
+
+    gbDestroy(*ioData);
+    *ioData = target;
+    *ioSize = (size_t) targetSize;
+    return true;
+}
+
+bool gbApplyBPS (const uint8_t* patch, size_t patchSize, uint8_t** ioData,
+    size_t* ioSize)
+{
+    if (patchSize < 4 + 12)
+    {
+        gbLogError("The BPS patch is truncated.");
+        return false;
+    }
+
+    gbPatchReader reader = { .data = patch, .size = patchSize - 12, .offset = 4 };
+    uint64_t sourceSize = gbReadPatchNumber(&reader);
+    uint64_t targetSize = gbReadPatchNumber(&reader);
+    uint64_t metadataSize = gbReadPatchNumber(&reader);
+    if (
+        reader.overrun == true || targetSize > GB_PATCH_MAX_IMAGE_SIZE ||
+        metadataSize > reader.size - reader.offset
+    )
+    {
+        gbLogError("The BPS patch has an invalid header.");
+        return false;
+    }
+
+    reader.offset += (size_t) metadataSize;
+    if (gbCheckPatchFooter("BPS", patch, patchSize, *ioData, *ioSize,
+        sourceSize) == false)
+    {
+        return false;
+    }
+
+    uint8_t* target = gbCreateZero(targetSize + 1, uint8_t);
+    gbCheckpv(target != nullptr, false,
+        "Error allocating memory for the patched ROM image");
+
+    // - Each action fills the next run of the target from the source at the
+    //   same position, from the patch, or from a relative position in the
+    //   source or in the target written so far.
+    const uint8_t* source = *ioData;
+    uint64_t output = 0, sourceRelative = 0, targetRelative = 0;
+    bool valid = true;
+    while (valid == true && reader.offset < reader.size)
+    {
+        uint64_t action = gbReadPatchNumber(&reader);
+        uint64_t length = (action >> 2) + 1;
+        if (reader.overrun == true || length > targetSize - output)
+        {
+            valid = false;
+            break;
+        }
+
+        switch (action & 3)
+        {
+            case 0: // Source Read
+                if (output > sourceSize || length > sourceSize - output) { valid = false; break; }
+                memcpy(target + output, source + output, (size_t) length);
+                break;
+
+            case 1: // Target Read
+                if (length > reader.size - reader.offset) { valid = false; break; }
+                memcpy(target + output, patch + reader.offset, (size_t) length);
+                reader.offset += (size_t) length;
+                break;
+
+            case 2: // Source Copy
+            {
+                uint64_t delta = gbReadPatchNumber(&reader);
+                if (
+                    reader.overrun == true ||
+                    gbMovePatchOffset(&sourceRelative, delta, sourceSize) == false ||
+                    sourceRelative > sourceSize ||
+                    length > sourceSize - sourceRelative
+                )
+                {
+                    valid = false;
+                    break;
+                }
+
+                memcpy(target + output, source + sourceRelative, (size_t) length);
+                sourceRelative += length;
+                break;
+            }
+
+            case 3: // Target Copy; may overlap the bytes it writes.
+            {
+                uint64_t delta = gbReadPatchNumber(&reader);
+                if (
+                    reader.overrun == true ||
+                    gbMovePatchOffset(&targetRelative, delta, output) == false ||
+                    targetRelative >= output
+                )
+                {
+                    valid = false;
+                    break;
+                }
+
+                for (uint64_t i = 0; i < length; ++i)
+                {
+                    target[output + i] = target[targetRelative++];
+                }
+
+                break;
+            }
+        }
+
+        output += length;
+    }
+
+    if (valid == false)
+    {
+        gbLogError("The BPS patch reads or copies outside of its buffers.");
+        gbDestroy(target);
+        return false;
+    }
+    else if (
+        output != targetSize ||
+        gbComputeCRC32(target, targetSize, 0) != gbReadPatchCRC(patch + patchSize - 8)
+    )
+    {
+        gbLogError("The BPS patch did not produce the image it describes.");
+        gbDestroy(target);
+        return false;
+    }
+
+    gbDestroy(*ioData);
+    *ioData = target;
+    *ioSize = (size_t) targetSize;
+    return true;
+}
+
+/* Public Function Definitions ************************************************/
+
+gbPatchFormat gbDetectPatchFormat (const uint8_t* patch, size_t patchSize)
+{
+    gbCheckqv(patch, GB_PF_UNKNOWN);
+
+    if (patchSize >= 5 && memcmp(patch, "PATCH", 5) == 0) { return GB_PF_IPS; }
+    if (patchSize >= 4 && memcmp(patch, "UPS1", 4) == 0) { return GB_PF_UPS; }
+    if (patchSize >= 4 && memcmp(patch, "BPS1", 4) == 0) { return GB_PF_BPS; }
+    return GB_PF_UNKNOWN;
+}
+
+const char* gbStringifyPatchFormat (gbPatchFormat format)
+{
+    switch (format)
+    {
+        case GB_PF_IPS: return "IPS";
+        case GB_PF_UPS: return "UPS";
+        case GB_PF_BPS: return "BPS";
+        default:        return "Unknown";
+    }
+}
+
+bool gbApplyPatch (const uint8_t* patch, size_t patchSize, uint8_t** ioData,
+    size_t* ioSize)
+{
+    gbCheckv(patch != nullptr, false, "Patch data pointer is null.");
+    gbCheckv(ioData != nullptr && *ioData != nullptr, false,
+        "ROM image pointer is null.");
+    gbCheckv(ioSize != nullptr, false, "ROM image size pointer is null.");
+
+    switch (gbDetectPatchFormat(patch, patchSize))
+    {
+        case GB_PF_IPS: return gbApplyIPS(patch, patchSize, ioData, ioSize);
+        case GB_PF_UPS: return gbApplyUPS(patch, patchSize, ioData, ioSize);
+        case GB_PF_BPS: return gbApplyBPS(patch, patchSize, ioData, ioSize);
+        default:
+            gbLogError("Patch is not in a supported format (IPS, UPS or BPS).");
+            return false;
+    }
+}
+
+uint32_t gbComputeCRC32 (const uint8_t* data, size_t size, uint32_t crc)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ GB_CRC32_NIBBLES[crc & 0x0F];
+        crc = (crc >> 4) ^ GB_CRC32_NIBBLES[crc & 0x0F];
+    }
+
+    return ~crc;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file    GB/Patch.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's ROM patcher,
+ *          which applies IPS, UPS and BPS patches to ROM images.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Common.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Enumerates the ROM patch formats which the core can apply.
+ */
+typedef enum gbPatchFormat : uint8_t
+{
+    GB_PF_UNKNOWN   = 0x00, /** @brief Not a patch in any supported format. */
+    GB_PF_IPS       = 0x01, /** @brief International Patching System; starts with `PATCH`. */
+    GB_PF_UPS       = 0x02, /** @brief Universal Patching System; starts with `UPS1`. */
+    GB_PF_BPS       = 0x03  /** @brief Beat Patching System; starts with `BPS1`. */
+} gbPatchFormat;
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Determines the format of a patch from its magic string.
+ *
+ * @param   patch       A pointer to the patch data.
+ * @param   patchSize   The size of the patch data, in bytes.
+ *
+ * @return  The format of the patch, or @a `GB_PF_UNKNOWN`.
+ */
+GB_API gbPatchFormat gbDetectPatchFormat (const uint8_t* patch,
+    size_t patchSize);
+
+/**
+ * @brief   Retrieves a string naming the given patch format.
+ */
+GB_API const char* gbStringifyPatchFormat (gbPatchFormat format);
+
+/**
+ * @brief   Applies a patch to a ROM image, in one pass over the patch.
+ *
+ * IPS patches are applied in place, growing the image if a record writes
+ * past its end. UPS and BPS patches build a new image of the size they
+ * declare, and check the CRC-32s of the source image, the result and the
+ * patch itself; a patch made for another ROM fails rather than corrupting
+ * this one.
+ *
+ * @param   patch       A pointer to the patch data.
+ * @param   patchSize   The size of the patch data, in bytes.
+ * @param   ioData      A pointer to the image, allocated with @a `gbCreate`.
+ *                      On success it may be replaced with a new image, and
+ *                      the old one freed.
+ * @param   ioSize      A pointer to the size of the image, in bytes. On
+ *                      success, it receives the size of the patched image.
+ *
+ * @return  If successful, returns `true`.
+ *          If the patch is malformed, does not match the image, or memory
+ *          allocation fails, returns `false`, and the image is left as it
+ *          was.
+ */
+GB_API bool gbApplyPatch (const uint8_t* patch, size_t patchSize,
+    uint8_t** ioData, size_t* ioSize);
+
+/**
+ * @brief   Computes the CRC-32 (ISO-HDLC, as used by zip, UPS and BPS) of the
+ *          given data.
+ *
+ * @param   data    A pointer to the data. May be `nullptr` if `size` is zero.
+ * @param   size    The size of the data, in bytes.
+ * @param   crc     The CRC-32 of any data before this; `0` to start afresh.
+ *
+ * @return  The CRC-32 of everything so far.
+ */
+GB_API uint32_t gbComputeCRC32 (const uint8_t* data, size_t size, uint32_t crc);
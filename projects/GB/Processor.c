@@ -9,9 +9,16 @@
 
 /* Private Includes ***********************************************************/
 
+#include <GB/Cartridge.h>
 #include <GB/Processor.h>
+#include <GB/Internal.h>
 #include <GB/Instructions.h>
 #include <GB/Timer.h>
+#include <GB/Serial.h>
+#include <GB/Trace.h>
+#include <GB/Stats.h>
+#include <GB/Profiler.h>
+#include <GB/Coverage.h>
 
 /* Private Constants and Enumerations *****************************************/
 
@@ -26,6 +33,20 @@ static const uint8_t GB_INTERRUPT_COUNT = 5;
  */
 static const uint8_t GB_INTERRUPT_COUNT_ENGINE = 8;
 
+/**
+ * @brief   Enumerates the processor's own hooks: the attachments and components
+ *          it would otherwise have to ask its context about on every
+ *          instruction or cycle. They share a mask with the `GB_HE_*` events,
+ *          above their bits.
+ */
+typedef enum gbProcessorHook : uint16_t
+{
+    GB_PH_TRACE     = 0x0100,   /** @brief A trace buffer is attached. */
+    GB_PH_COVERAGE  = 0x0200,   /** @brief A coverage bitmap is attached. */
+    GB_PH_PROFILER  = 0x0400,   /** @brief A profiler is attached. */
+    GB_PH_SERIAL    = 0x0800,   /** @brief A serial transfer is being clocked. */
+} gbProcessorHook;
+
 /**
  * @brief   Defines a lookup table mapping `gbRegisterType` values to their
  *          corresponding human-readable register names.
@@ -76,6 +97,15 @@ struct gbProcessor
     gbInstructionExecuteCallback    instructionExecuteCallback;
     gbInterruptServiceCallback      interruptServiceCallback;
     gbRestartVectorCallback         restartVectorCallback;
+    uint16_t                        hooks;              // `GB_HE_*` bits of the callbacks set above, and `GB_PH_*` bits of the pointers below.
+    gbAddressFilter                 instructionFilter;
+
+    // Attachments and Components
+    gbTrace*                        trace;              // Mirror the context's; see `gbSetProcessorAttachments`.
+    gbCoverage*                     coverage;
+    gbProfiler*                     profiler;
+    gbSerial*                       serial;             // Set only while a transfer is clocked; see `gbSetProcessorSerialTransfer`.
+    const uint16_t*                 romBanks;           // The parent's; see `gbGetROMBankMap`.
 
     // Register File and Hardware Registers
     gbProcessorRegisterFile         registers;
@@ -106,6 +136,7 @@ struct gbProcessor
 
 /* Private Function Declarations - Data Fetching ******************************/
 
+static GB_INLINE uint16_t gbGetFetchedBank (const gbProcessor* processor);
 static bool gbFetchOpcode (gbProcessor* processor);
 static bool gbFetchIMM8 (gbProcessor* processor);
 static bool gbFetchIMM16 (gbProcessor* processor);
@@ -118,6 +149,14 @@ static bool gbExecuteInstructionFD (gbProcessor* cpu, uint8_t opcode);
 
 /* Private Function Definitions - Data Fetching *******************************/
 
+uint16_t gbGetFetchedBank (const gbProcessor* processor)
+{
+    // - The ROM bank the opcode was fetched from, as the context last mapped
+    //   it; code outside of ROM has no bank.
+    uint16_t address = processor->fetchedOpcodeAddress;
+    return (address <= GB_ROMX_END) ? processor->romBanks[address >> 14] : 0;
+}
+
 bool gbFetchOpcode (gbProcessor* processor)
 {
     gbAssert(processor);
@@ -126,6 +165,13 @@ bool gbFetchOpcode (gbProcessor* processor)
     // - Store the address of the opcode being fetched.
     processor->fetchedOpcodeAddress = processor->registers.programCounter;
 
+    // - If a coverage bitmap is attached, mark the opcode's address.
+    if ((processor->hooks & GB_PH_COVERAGE) != 0)
+    {
+        gbMarkCoverage(processor->coverage, gbGetFetchedBank(processor),
+            processor->fetchedOpcodeAddress);
+    }
+
     // - Fetch a byte from memory at the current `PC` address.
     // - Consume one M-cycle for Memory Read.
     uint8_t opcode = 0x00;
@@ -559,6 +605,7 @@ gbProcessor* gbCreateProcessor (gbContext* parentContext)
         "Error allocating memory for 'gbProcessor'");
 
     processor->parent = parentContext;
+    processor->romBanks = gbGetROMBankMap(parentContext);
     return processor;
 }
 
@@ -701,6 +748,8 @@ bool gbSetInstructionFetchCallback (gbProcessor* processor, gbInstructionFetchCa
         "The 'gbProcessor' has no valid parent 'gbContext'.");
 
     processor->instructionFetchCallback = callback;
+    processor->hooks = (processor->hooks & ~GB_HE_INSTRUCTION_FETCH) |
+        ((callback != nullptr) ? GB_HE_INSTRUCTION_FETCH : GB_HE_NONE);
     return true;
 }
 
@@ -713,6 +762,8 @@ bool gbSetInstructionExecuteCallback (gbProcessor* processor, gbInstructionExecu
         "The 'gbProcessor' has no valid parent 'gbContext'.");
 
     processor->instructionExecuteCallback = callback;
+    processor->hooks = (processor->hooks & ~GB_HE_INSTRUCTION_EXECUTE) |
+        ((callback != nullptr) ? GB_HE_INSTRUCTION_EXECUTE : GB_HE_NONE);
     return true;
 }
 
@@ -725,6 +776,8 @@ bool gbSetInterruptServiceCallback (gbProcessor* processor, gbInterruptServiceCa
         "The 'gbProcessor' has no valid parent 'gbContext'.");
 
     processor->interruptServiceCallback = callback;
+    processor->hooks = (processor->hooks & ~GB_HE_INTERRUPT_SERVICE) |
+        ((callback != nullptr) ? GB_HE_INTERRUPT_SERVICE : GB_HE_NONE);
     return true;
 }
 
@@ -737,6 +790,20 @@ bool gbSetRestartVectorCallback (gbProcessor* processor, gbRestartVectorCallback
         "The 'gbProcessor' has no valid parent 'gbContext'.");
 
     processor->restartVectorCallback = callback;
+    processor->hooks = (processor->hooks & ~GB_HE_RESTART_VECTOR) |
+        ((callback != nullptr) ? GB_HE_RESTART_VECTOR : GB_HE_NONE);
+    return true;
+}
+
+bool gbSetInstructionCallbackFilter (gbProcessor* processor,
+    const gbAddressFilter* filter)
+{
+    gbFallback(processor, gbGetProcessor(nullptr));
+    gbCheckv(processor != nullptr, false,
+        "No valid 'gbProcessor' provided, and no current processor is set.");
+
+    processor->instructionFilter =
+        (filter != nullptr) ? *filter : (gbAddressFilter) { 0 };
     return true;
 }
 
@@ -748,7 +815,7 @@ bool gbInvokeRestartVectorCallback (gbProcessor* processor, uint16_t restartVect
     gbCheckv(processor->parent != nullptr, false,
         "The 'gbProcessor' has no valid parent 'gbContext'.");
 
-    if (processor->restartVectorCallback != nullptr)
+    if ((processor->hooks & GB_HE_RESTART_VECTOR) != 0)
     {
         processor->restartVectorCallback(processor->parent, restartVector);
     }
@@ -756,6 +823,57 @@ bool gbInvokeRestartVectorCallback (gbProcessor* processor, uint16_t restartVect
     return true;
 }
 
+/* Internal Function Definitions **********************************************/
+
+void gbSetProcessorHooks (gbProcessor* processor, const gbHooks* hooks)
+{
+    gbAssert(processor != nullptr && hooks != nullptr);
+
+    uint8_t events = hooks->events;
+    processor->instructionFetchCallback = (events & GB_HE_INSTRUCTION_FETCH) ?
+        hooks->instructionFetch : nullptr;
+    processor->instructionExecuteCallback = (events & GB_HE_INSTRUCTION_EXECUTE) ?
+        hooks->instructionExecute : nullptr;
+    processor->interruptServiceCallback = (events & GB_HE_INTERRUPT_SERVICE) ?
+        hooks->interruptService : nullptr;
+    processor->restartVectorCallback = (events & GB_HE_RESTART_VECTOR) ?
+        hooks->restartVector : nullptr;
+    processor->instructionFilter = hooks->instructionFilter;
+
+    // - Mask in the events left with a callback, as their own setters would.
+    processor->hooks = (processor->hooks & ~(GB_HE_INSTRUCTION_FETCH |
+        GB_HE_INSTRUCTION_EXECUTE | GB_HE_INTERRUPT_SERVICE |
+        GB_HE_RESTART_VECTOR)) |
+        ((processor->instructionFetchCallback != nullptr) ? GB_HE_INSTRUCTION_FETCH : GB_HE_NONE) |
+        ((processor->instructionExecuteCallback != nullptr) ? GB_HE_INSTRUCTION_EXECUTE : GB_HE_NONE) |
+        ((processor->interruptServiceCallback != nullptr) ? GB_HE_INTERRUPT_SERVICE : GB_HE_NONE) |
+        ((processor->restartVectorCallback != nullptr) ? GB_HE_RESTART_VECTOR : GB_HE_NONE);
+}
+
+void gbSetProcessorAttachments (gbProcessor* processor, gbTrace* trace,
+    gbCoverage* coverage, gbProfiler* profiler)
+{
+    gbAssert(processor != nullptr);
+
+    processor->trace = trace;
+    processor->coverage = coverage;
+    processor->profiler = profiler;
+    processor->hooks =
+        (processor->hooks & ~(GB_PH_TRACE | GB_PH_COVERAGE | GB_PH_PROFILER)) |
+        ((trace != nullptr) ? GB_PH_TRACE : 0) |
+        ((coverage != nullptr) ? GB_PH_COVERAGE : 0) |
+        ((profiler != nullptr) ? GB_PH_PROFILER : 0);
+}
+
+void gbSetProcessorSerialTransfer (gbProcessor* processor, gbSerial* serial)
+{
+    gbAssert(processor != nullptr);
+
+    processor->serial = serial;
+    processor->hooks = (processor->hooks & ~GB_PH_SERIAL) |
+        ((serial != nullptr) ? GB_PH_SERIAL : 0);
+}
+
 /* Public Function Definitions - Ticking and Timing ***************************/
 
 bool gbTickProcessor (gbProcessor* processor)
@@ -787,16 +905,42 @@ bool gbTickProcessor (gbProcessor* processor)
         else
         {
             // - Stay in HALT, consume 1 M-cycle
+            gbCountStat(processor->parent, haltedCycles,
+                (processor->key1.speedMode == true) ? 2 : 4);
+            if ((processor->hooks & GB_PH_PROFILER) != 0)
+            {
+                gbRecordProfilerHalt(processor->profiler,
+                    (processor->key1.speedMode == true) ? 2 : 4);
+            }
+
             return gbConsumeMachineCycles(processor, 1);
         }
     }
 
-    // - Service a pending interrupt, if any.
+    // - Service a pending interrupt, if any. If profiling, its dispatch is
+    //   counted against the first instruction of its handler.
+    size_t startCycles = processor->tickCyclesConsumed;
     if (gbServiceInterrupt(processor) == false)
     {
         return false;
     }
 
+    // - If a trace buffer is attached, snapshot the state the instruction
+    //   starts from; the record is completed and pushed once the opcode has
+    //   been fetched.
+    bool tracing = (processor->hooks & GB_PH_TRACE) != 0;
+    gbTraceRecord traceRecord = { 0 };
+    if (tracing == true)
+    {
+        traceRecord = (gbTraceRecord) {
+            .cycle          = processor->tickCyclesConsumed,
+            .stackPointer   = processor->registers.stackPointer,
+            .accumulator    = processor->registers.accumulator,
+            .flags          = processor->registers.flags.raw & 0xF0,
+            .type           = GB_TRT_INSTRUCTION
+        };
+    }
+
     // - Prepare the fetch state for the next instruction.
     processor->fetchedOpcodeAddress = 0x0000;
     processor->fetchedOpcode        = 0x0000;
@@ -811,9 +955,38 @@ bool gbTickProcessor (gbProcessor* processor)
         return false;
     }
 
+    // - Complete and push the trace record, if tracing.
+    if (tracing == true)
+    {
+        traceRecord.address = processor->fetchedOpcodeAddress;
+        traceRecord.opcode = processor->fetchedOpcode;
+        if (traceRecord.address <= GB_ROMX_END)
+        {
+            traceRecord.bank = processor->romBanks[traceRecord.address >> 14];
+        }
+
+        gbAppendTraceRecord(processor->trace, &traceRecord);
+    }
+
+    // - Check the hooks once: which instruction callbacks are set, and whether
+    //   this opcode's address passes their filter.
+    uint8_t hooks = processor->hooks &
+        (GB_HE_INSTRUCTION_FETCH | GB_HE_INSTRUCTION_EXECUTE);
+    if (
+        hooks != 0 &&
+        processor->instructionFilter.enabled == true &&
+        (
+            processor->fetchedOpcodeAddress < processor->instructionFilter.first ||
+            processor->fetchedOpcodeAddress > processor->instructionFilter.last
+        )
+    )
+    {
+        hooks = GB_HE_NONE;
+    }
+
     // - Invoke the instruction fetch callback, if set.
     bool allowExecution = true;
-    if (processor->instructionFetchCallback != nullptr)
+    if ((hooks & GB_HE_INSTRUCTION_FETCH) != 0)
     {
         allowExecution = processor->instructionFetchCallback(
             processor->parent,
@@ -843,7 +1016,7 @@ bool gbTickProcessor (gbProcessor* processor)
         }
 
         // - Invoke the instruction execute callback, if set.
-        if (processor->instructionExecuteCallback != nullptr)
+        if ((hooks & GB_HE_INSTRUCTION_EXECUTE) != 0)
         {
             processor->instructionExecuteCallback(
                 processor->parent,
@@ -857,6 +1030,17 @@ bool gbTickProcessor (gbProcessor* processor)
         {
             return false;
         }
+
+        gbCountStat(processor->parent, instructions, 1);
+    }
+
+    // - If a profiler is attached, count this instruction's cycles against its
+    //   address.
+    if ((processor->hooks & GB_PH_PROFILER) != 0)
+    {
+        gbRecordProfilerCycles(processor->profiler, gbGetFetchedBank(processor),
+            processor->fetchedOpcodeAddress,
+            processor->tickCyclesConsumed - startCycles);
     }
 
     // - If the `IME` is pending activation, enable it now.
@@ -877,12 +1061,17 @@ bool gbConsumeTickCycles (gbProcessor* processor, size_t tickCycles)
     gbCheckv(processor->parent != nullptr, false,
         "The 'gbProcessor' has no valid parent 'gbContext'.");
 
+    // - The serial port only needs clocking while a transfer is running; it
+    //   sets and clears its hook itself, possibly partway through a batch.
     gbTimer* timer = gbGetTimer(processor->parent);
-
     for (size_t i = 0; i < tickCycles; ++i)
     {
         if (
-            gbTickTimer(timer) == false
+            gbTickTimer(timer) == false ||
+            (
+                (processor->hooks & GB_PH_SERIAL) != 0 &&
+                gbTickSerial(processor->serial) == false
+            )
         )
         {
             return false;
@@ -891,6 +1080,7 @@ bool gbConsumeTickCycles (gbProcessor* processor, size_t tickCycles)
         processor->tickCyclesConsumed++;
     }
 
+    gbCountStat(processor->parent, tickCycles, tickCycles);
     return true;
 }
 
@@ -925,6 +1115,15 @@ bool gbConsumeFetchCycles (gbProcessor* processor, size_t fetchCycles)
     );
 }
 
+uint64_t gbGetTickCyclesConsumed (const gbProcessor* processor)
+{
+    gbFallback(processor, gbGetProcessor(nullptr));
+    gbCheckv(processor != nullptr, 0,
+        "No valid 'gbProcessor' provided, and no current processor is set.");
+
+    return processor->tickCyclesConsumed;
+}
+
 /* Public Function Definitions - Processor Registers and Flags ****************/
 
 const gbProcessorRegisterFile* gbGetRegisterFile (const gbProcessor* processor)
@@ -1355,10 +1554,14 @@ bool gbServiceInterrupt (gbProcessor* processor)
                 gbLogError("Error servicing interrupt '%s'.",
                     GB_INTERRUPT_NAMES[interrupt]);
             }
-            else if (processor->interruptServiceCallback != nullptr)
+            else
             {
-                processor->interruptServiceCallback(processor->parent, 
-                    (gbInterrupt) interrupt);
+                gbCountStat(processor->parent, interrupts[interrupt], 1);
+                if ((processor->hooks & GB_HE_INTERRUPT_SERVICE) != 0)
+                {
+                    processor->interruptServiceCallback(processor->parent, 
+                        (gbInterrupt) interrupt);
+                }
             }
 
             return ok;
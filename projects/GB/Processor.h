@@ -13,75 +13,6 @@
 
 #include <GB/Context.h>
 
-/* Public Types and Forward Declarations **************************************/
-
-/**
- * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
- *          CPU processor component when a new instruction is fetched from memory
- *          and is about to be executed.
- * 
- * @param   context         A pointer to the @a `gbContext` whose processor is
- *                          fetching the instruction.
- * @param   address         The 16-bit, absolute address from which the instruction's
- *                          opcode (and any prefix bytes) were fetched.
- * @param   opcode          A 16-bit value, the lower byte of which contains the
- *                          instruction's opcode. If the instruction is a prefixed
- *                          instruction (i.e., uses the `0xCB` prefix), the upper
- *                          byte contains the prefix byte (`0xCB`); otherwise, it
- *                          is `0x00`.
- * 
- * @return  The callback function can return `true` to allow the @a `gbProcessor`
- *          to proceed with executing the fetched instruction as normal, or `false`
- *          to skip execution of the instruction (effectively treating it as a
- *          `NOP` instruction). This can be useful for debugging, logging, or
- *          modifying the behavior of certain instructions at runtime.
- */
-typedef bool (*gbInstructionFetchCallback) (gbContext* context,
-    uint16_t address, uint16_t opcode);
-
-/**
- * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
- *          CPU processor component immediately after an instruction has been
- *          executed.
- *
- * @param   context         A pointer to the @a `gbContext` whose processor executed the
- *                          instruction.
- * @param   address         The 16-bit, absolute address from which the instruction's
- *                          opcode (and any prefix bytes) were fetched.
- * @param   opcode          A 16-bit value, the lower byte of which contains the
- *                          instruction's opcode. If the instruction is a prefixed
- *                          instruction (i.e., uses the `0xCB` prefix), the upper
- *                          byte contains the prefix byte (`0xCB`); otherwise, it
- *                          is `0x00`.
- * @param   success         A boolean value indicating whether the instruction
- *                          executed successfully, without errors.
- */
-typedef void (*gbInstructionExecuteCallback) (gbContext* context,
-    uint16_t address, uint16_t opcode, bool success);
-
-/**
- * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
- *          CPU processor component when it services an interrupt.
- * 
- * @param   context         A pointer to the @a `gbContext` whose processor is servicing
- *                          the interrupt.
- * @param   interrupt       The type of interrupt being serviced.
- */
-typedef void (*gbInterruptServiceCallback) (gbContext* context,
-    uint8_t interrupt);
-
-/**
- * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
- *          CPU processor component in response to executing one of the `RST`
- *          restart vector instructions.
- * 
- * @param   context         A pointer to the @a `gbContext` whose processor is invoking
- *                          the restart vector. 
- * @param   restartVector   The restart vector address being invoked.
- */
-typedef void (*gbRestartVectorCallback) (gbContext* context,
-    uint16_t restartVector);
-
 /* Public Constants and Enumerations ******************************************/
 
 /**
@@ -335,6 +266,7 @@ typedef struct gbProcessorRegisterFile
     uint16_t        programCounter; /** @brief `PC` - Program Counter Register */
 } gbProcessorRegisterFile;
 
+
 /* Public Function Declarations ***********************************************/
 
 /**
@@ -490,6 +422,23 @@ GB_API bool gbSetInterruptServiceCallback (gbProcessor* processor, gbInterruptSe
  */
 GB_API bool gbSetRestartVectorCallback (gbProcessor* processor, gbRestartVectorCallback callback);
 
+/**
+ * @brief   Limits the instruction fetch and execute callbacks of the given CPU
+ *          processor component to opcodes fetched from a range of addresses.
+ * 
+ * @param   processor   A pointer to the @a `gbProcessor` structure for which to
+ *                      set the filter. Pass `nullptr` to use the current
+ *                      context's processor.
+ * @param   filter      A pointer to the @a `gbAddressFilter` to be applied.
+ *                      Pass `nullptr` to pass every address.
+ * 
+ * @return  If successful, returns `true`.
+ *          If no processor is provided (i.e., `nullptr`) and no current processor
+ *          exists, returns `false`.
+ */
+GB_API bool gbSetInstructionCallbackFilter (gbProcessor* processor,
+    const gbAddressFilter* filter);
+
 /**
  * @brief   Invokes the restart vector callback function for the given CPU
  *          processor component, if one is set.
@@ -592,6 +541,22 @@ GB_API bool gbConsumeMachineCycles (gbProcessor* processor, size_t machineCycles
  */
 GB_API bool gbConsumeFetchCycles (gbProcessor* processor, size_t fetchCycles);
 
+/**
+ * @brief   Retrieves the total number of T-cycles consumed by the given CPU
+ *          processor component since it was last initialized.
+ * 
+ * T-cycles tick at a fixed 4 MiHz, whatever the CPU's speed mode; in
+ * double-speed mode, each machine cycle consumes two of them instead of four.
+ * 
+ * @param   processor   A pointer to the @a `gbProcessor` structure to be
+ *                      inspected. Pass `nullptr` to use the current context's
+ *                      processor.
+ * 
+ * @return  The number of T-cycles consumed, or `0` if no processor is provided
+ *          (i.e., `nullptr`) and no current processor exists.
+ */
+GB_API uint64_t gbGetTickCyclesConsumed (const gbProcessor* processor);
+
 /* Public Function Declarations - Processor Registers and Flags ***************/
 
 /**
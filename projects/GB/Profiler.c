@@ -0,0 +1,394 @@
+/**
+ * @file    GB/Profiler.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's guest code
+ *          profiler.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Profiler.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   Defines the number of counters allocated for each ROM bank: one per
+ *          byte of a 16 KiB bank.
+ */
+#define GB_PROFILER_BANK_SIZE 0x4000
+
+/**
+ * @brief   Defines the number of counters kept for code outside of ROM, at
+ *          `$8000` - `$FFFF`.
+ */
+#define GB_PROFILER_RAM_SIZE 0x8000
+
+/* Private Unions and Structures **********************************************/
+
+struct gbProfiler
+{
+    // Counters
+    uint64_t*           romBanks[GB_PROFILER_MAX_BANKS];    // Allocated on first use.
+    uint64_t*           ram;                                // Allocated on first use.
+    uint64_t            totalCycles;
+    uint64_t            haltedCycles;
+
+    // Sampling
+    uint32_t            samplePeriod;
+    uint32_t            sampleCountdown;
+
+    // Symbols
+    gbSymbolTable*      symbols;
+
+    // Report
+    gbProfilerEntry*    report;
+    size_t              reportCount;
+    size_t              reportCapacity;
+};
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static int gbCompareProfilerEntries (const void* a, const void* b);
+static bool gbAddProfilerEntry (gbProfiler* profiler, uint64_t cycles,
+    uint16_t bank, uint16_t address, const char* symbol);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+int gbCompareProfilerEntries (const void* a, const void* b)
+{
+    const gbProfilerEntry* left = a;
+    const gbProfilerEntry* right = b;
+    if (left->cycles != right->cycles)
+    {
+        return (left->cycles > right->cycles) ? -1 : 1;
+    }
+    else if (left->bank != right->bank)
+    {
+        return (left->bank < right->bank) ? -1 : 1;
+    }
+
+    return (left->address < right->address) ? -1 : (left->address > right->address);
+}
+
+bool gbAddProfilerEntry (gbProfiler* profiler, uint64_t cycles, uint16_t bank,
+    uint16_t address, const char* symbol)
+{
+    if (profiler->reportCount == profiler->reportCapacity)
+    {
+        size_t newCapacity =
+            (profiler->reportCapacity == 0) ? 256 : profiler->reportCapacity * 2;
+        gbProfilerEntry* newReport =
+            gbResize(profiler->report, newCapacity, gbProfilerEntry);
+        gbCheckpv(newReport != nullptr, false,
+            "Error allocating memory for profiler report");
+
+        profiler->report = newReport;
+        profiler->reportCapacity = newCapacity;
+    }
+
+    profiler->report[profiler->reportCount++] = (gbProfilerEntry) {
+        .cycles     = cycles,
+        .bank       = bank,
+        .address    = address,
+        .symbol     = symbol
+    };
+
+    return true;
+}
+
+/* Public Function Definitions - Lifecycle ************************************/
+
+gbProfiler* gbCreateProfiler (uint32_t samplePeriod)
+{
+    gbProfiler* profiler = gbCreateZero(1, gbProfiler);
+    gbCheckpv(profiler != nullptr, nullptr,
+        "Error allocating memory for 'gbProfiler'");
+
+    profiler->symbols = gbCreateSymbolTable();
+    if (profiler->symbols == nullptr)
+    {
+        gbDestroy(profiler);
+        return nullptr;
+    }
+
+    gbSetProfilerSamplePeriod(profiler, samplePeriod);
+    return profiler;
+}
+
+bool gbDestroyProfiler (gbProfiler* profiler)
+{
+    gbCheckqv(profiler, false);
+
+    for (size_t i = 0; i < GB_PROFILER_MAX_BANKS; ++i)
+    {
+        gbDestroy(profiler->romBanks[i]);
+    }
+
+    gbDestroy(profiler->ram);
+    gbDestroySymbolTable(profiler->symbols);
+    gbDestroy(profiler->report);
+    gbDestroy(profiler);
+    return true;
+}
+
+bool gbClearProfiler (gbProfiler* profiler)
+{
+    gbCheckv(profiler != nullptr, false, "No valid 'gbProfiler' provided.");
+
+    for (size_t i = 0; i < GB_PROFILER_MAX_BANKS; ++i)
+    {
+        if (profiler->romBanks[i] != nullptr)
+        {
+            memset(profiler->romBanks[i], 0,
+                GB_PROFILER_BANK_SIZE * sizeof(uint64_t));
+        }
+    }
+
+    if (profiler->ram != nullptr)
+    {
+        memset(profiler->ram, 0, GB_PROFILER_RAM_SIZE * sizeof(uint64_t));
+    }
+
+    profiler->totalCycles = 0;
+    profiler->haltedCycles = 0;
+    profiler->sampleCountdown = 0;
+    profiler->reportCount = 0;
+    return true;
+}
+
+bool gbSetProfilerSamplePeriod (gbProfiler* profiler, uint32_t samplePeriod)
+{
+    gbCheckv(profiler != nullptr, false, "No valid 'gbProfiler' provided.");
+
+    profiler->samplePeriod = (samplePeriod == 0) ? 1 : samplePeriod;
+    profiler->sampleCountdown = 0;
+    return true;
+}
+
+/* Public Function Definitions - Recording ************************************/
+
+bool gbRecordProfilerCycles (gbProfiler* profiler, uint16_t bank,
+    uint16_t address, uint64_t cycles)
+{
+    gbCheckqv(profiler != nullptr, false);
+
+    // - When sampling, skip all but every Nth instruction, and let that one
+    //   stand in for the others.
+    if (profiler->sampleCountdown > 0)
+    {
+        profiler->sampleCountdown--;
+        return true;
+    }
+
+    profiler->sampleCountdown = profiler->samplePeriod - 1;
+    cycles *= profiler->samplePeriod;
+    profiler->totalCycles += cycles;
+
+    // - Code outside of ROM shares one set of counters.
+    uint64_t** counters = &profiler->ram;
+    size_t count = GB_PROFILER_RAM_SIZE;
+    size_t index = address - GB_VRAM_START;
+    if (address <= GB_ROMX_END)
+    {
+        if (bank >= GB_PROFILER_MAX_BANKS)
+        {
+            bank = GB_PROFILER_MAX_BANKS - 1;
+        }
+
+        counters = &profiler->romBanks[bank];
+        count = GB_PROFILER_BANK_SIZE;
+        index = address & (GB_PROFILER_BANK_SIZE - 1);
+    }
+
+    if (*counters == nullptr)
+    {
+        *counters = gbCreateZero(count, uint64_t);
+        gbCheckpv(*counters != nullptr, false,
+            "Error allocating memory for profiler counters");
+    }
+
+    (*counters)[index] += cycles;
+    return true;
+}
+
+bool gbRecordProfilerHalt (gbProfiler* profiler, uint64_t cycles)
+{
+    gbCheckqv(profiler != nullptr, false);
+
+    profiler->totalCycles += cycles;
+    profiler->haltedCycles += cycles;
+    return true;
+}
+
+/* Public Function Definitions - Symbols **************************************/
+
+bool gbLoadProfilerSymbols (gbProfiler* profiler, const char* filepath)
+{
+    gbCheckv(profiler != nullptr, false, "No valid 'gbProfiler' provided.");
+
+    // - The report points at symbol names, so it goes with them.
+    profiler->reportCount = 0;
+    return gbLoadSymbolTable(profiler->symbols, filepath);
+}
+
+size_t gbGetProfilerSymbolCount (const gbProfiler* profiler)
+{
+    gbCheckqv(profiler, 0);
+    return gbGetSymbolCount(profiler->symbols);
+}
+
+const gbSymbolTable* gbGetProfilerSymbols (const gbProfiler* profiler)
+{
+    gbCheckqv(profiler, nullptr);
+    return profiler->symbols;
+}
+
+const char* gbLookupProfilerSymbol (const gbProfiler* profiler, uint16_t bank,
+    uint16_t address)
+{
+    gbCheckqv(profiler, nullptr);
+
+    size_t index = gbFindSymbol(profiler->symbols, bank, address);
+    return gbGetSymbol(profiler->symbols, index, nullptr, nullptr);
+}
+
+/* Public Function Definitions - Reporting ************************************/
+
+bool gbBuildProfilerReport (gbProfiler* profiler, bool groupBySymbol)
+{
+    gbCheckv(profiler != nullptr, false, "No valid 'gbProfiler' provided.");
+
+    profiler->reportCount = 0;
+
+    // - When grouping, total the cycles per symbol first; addresses with no
+    //   symbol become rows straight away.
+    size_t symbolCount = gbGetSymbolCount(profiler->symbols);
+    uint64_t* symbolCycles = nullptr;
+    if (groupBySymbol == true && symbolCount > 0)
+    {
+        symbolCycles = gbCreateZero(symbolCount, uint64_t);
+        gbCheckpv(symbolCycles != nullptr, false,
+            "Error allocating memory for profiler report");
+    }
+
+    bool result = true;
+    for (size_t bank = 0; bank <= GB_PROFILER_MAX_BANKS && result == true; ++bank)
+    {
+        // - The last pass covers the counters for code outside of ROM.
+        const uint64_t* counters = (bank < GB_PROFILER_MAX_BANKS) ?
+            profiler->romBanks[bank] : profiler->ram;
+        size_t count = (bank < GB_PROFILER_MAX_BANKS) ?
+            GB_PROFILER_BANK_SIZE : GB_PROFILER_RAM_SIZE;
+        if (counters == nullptr)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < count && result == true; ++i)
+        {
+            if (counters[i] == 0)
+            {
+                continue;
+            }
+
+            // - ROM bank 0 is reported at `$0000` - `$3FFF`, and every other
+            //   bank at `$4000` - `$7FFF`, where RGBDS places their labels.
+            uint16_t entryBank = (bank < GB_PROFILER_MAX_BANKS) ? (uint16_t) bank : 0;
+            uint16_t address = (bank == GB_PROFILER_MAX_BANKS) ?
+                (uint16_t) (GB_VRAM_START + i) :
+                (uint16_t) (((bank == 0) ? 0x0000 : GB_ROMX_START) + i);
+            size_t symbol = gbFindSymbol(profiler->symbols, entryBank, address);
+            if (symbolCycles != nullptr && symbol != GB_SYMBOL_NONE)
+            {
+                symbolCycles[symbol] += counters[i];
+                continue;
+            }
+
+            result = gbAddProfilerEntry(profiler, counters[i], entryBank, address,
+                gbGetSymbol(profiler->symbols, symbol, nullptr, nullptr));
+        }
+    }
+
+    for (size_t i = 0; symbolCycles != nullptr && i < symbolCount && result == true; ++i)
+    {
+        if (symbolCycles[i] > 0)
+        {
+            uint16_t bank = 0, address = 0;
+            const char* name = gbGetSymbol(profiler->symbols, i, &bank, &address);
+            result = gbAddProfilerEntry(profiler, symbolCycles[i], bank, address,
+                name);
+        }
+    }
+
+    gbDestroy(symbolCycles);
+    qsort(profiler->report, profiler->reportCount, sizeof(gbProfilerEntry),
+        gbCompareProfilerEntries);
+    return result;
+}
+
+const gbProfilerEntry* gbGetProfilerReport (const gbProfiler* profiler,
+    size_t* outCount)
+{
+    gbCheckqv(profiler != nullptr && outCount != nullptr, nullptr);
+
+    *outCount = profiler->reportCount;
+    return (profiler->reportCount > 0) ? profiler->report : nullptr;
+}
+
+uint64_t gbGetProfilerTotalCycles (const gbProfiler* profiler)
+{
+    gbCheckqv(profiler, 0);
+    return profiler->totalCycles;
+}
+
+uint64_t gbGetProfilerHaltedCycles (const gbProfiler* profiler)
+{
+    gbCheckqv(profiler, 0);
+    return profiler->haltedCycles;
+}
+
+bool gbSaveProfilerFoldedStacks (gbProfiler* profiler, const char* filepath)
+{
+    gbCheckv(profiler != nullptr, false, "No valid 'gbProfiler' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+
+    if (gbBuildProfilerReport(profiler, true) == false)
+    {
+        return false;
+    }
+
+    FILE* fp = fopen(filepath, "w");
+    gbCheckpv(fp != nullptr, false, "Failed to open folded stack file '%s' for writing",
+        filepath);
+
+    // - A local label's stack is its parent label, then itself.
+    for (size_t i = 0; i < profiler->reportCount; ++i)
+    {
+        const gbProfilerEntry* entry = &profiler->report[i];
+        if (entry->symbol == nullptr)
+        {
+            fprintf(fp, "$%02X:%04X %llu\n", entry->bank, entry->address,
+                (unsigned long long) entry->cycles);
+            continue;
+        }
+
+        const char* local = strchr(entry->symbol + 1, '.');
+        if (local != nullptr)
+        {
+            fprintf(fp, "%.*s;", (int) (local - entry->symbol), entry->symbol);
+        }
+
+        fprintf(fp, "%s %llu\n", entry->symbol, (unsigned long long) entry->cycles);
+    }
+
+    if (profiler->haltedCycles > 0)
+    {
+        fprintf(fp, "[halted] %llu\n", (unsigned long long) profiler->haltedCycles);
+    }
+
+    fclose(fp);
+    return true;
+}
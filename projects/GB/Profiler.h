@@ -0,0 +1,232 @@
+/**
+ * @file    GB/Profiler.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's guest code
+ *          profiler, which accumulates the T-cycles spent at each instruction
+ *          address and attributes them to RGBDS symbols.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Symbols.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Defines the number of cartridge ROM banks the profiler can keep
+ *          separate counters for. Code in higher banks is counted against the
+ *          last one.
+ */
+#define GB_PROFILER_MAX_BANKS 512
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure representing one row of a profiler report:
+ *          either a single instruction address, or every address attributed to
+ *          one symbol.
+ */
+typedef struct gbProfilerEntry
+{
+    uint64_t    cycles;         /** @brief The T-cycles counted against this row. */
+    uint16_t    bank;           /** @brief The ROM bank of @a `address`, or `0` outside of ROM. */
+    uint16_t    address;        /** @brief The instruction address, or the symbol's address. */
+    const char* symbol;         /** @brief The symbol containing @a `address`, or `nullptr` if none does. Owned by the profiler. */
+} gbProfilerEntry;
+
+/* Public Function Declarations - Lifecycle ***********************************/
+
+/**
+ * @brief   Allocates and creates a new profiler.
+ *
+ * Counters are allocated per ROM bank, the first time code in that bank is
+ * counted, so profiling a large ROM only costs memory for the banks it runs.
+ *
+ * @param   samplePeriod    Counts only every Nth instruction, scaling its
+ *                          cycles by N, to cut the profiler's overhead. Pass
+ *                          `1` (or `0`) to count every instruction exactly.
+ *
+ * @return  If successful, returns a pointer to the new @a `gbProfiler`.
+ *          If memory allocation fails, returns `nullptr`.
+ */
+GB_API gbProfiler* gbCreateProfiler (uint32_t samplePeriod);
+
+/**
+ * @brief   Destroys and deallocates the given profiler, along with its
+ *          counters, symbols and report.
+ *
+ * @param   profiler    A pointer to the @a `gbProfiler` to be destroyed.
+ *
+ * @return  If successful, returns `true`.
+ *          If the profiler pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbDestroyProfiler (gbProfiler* profiler);
+
+/**
+ * @brief   Resets every counter in the given profiler to zero. Loaded symbols
+ *          are kept.
+ *
+ * @param   profiler    A pointer to the @a `gbProfiler` to be cleared.
+ *
+ * @return  If successful, returns `true`.
+ *          If the profiler pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbClearProfiler (gbProfiler* profiler);
+
+/**
+ * @brief   Changes the sample period of the given profiler.
+ *
+ * @param   profiler        A pointer to the @a `gbProfiler` to be changed.
+ * @param   samplePeriod    Counts only every Nth instruction; see
+ *                          @a `gbCreateProfiler`.
+ *
+ * @return  If successful, returns `true`.
+ *          If the profiler pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbSetProfilerSamplePeriod (gbProfiler* profiler,
+    uint32_t samplePeriod);
+
+/* Public Function Declarations - Recording ***********************************/
+
+/**
+ * @brief   Counts the T-cycles taken by one instruction against its address.
+ *          This is called by the context's processor after each instruction
+ *          while the profiler is attached.
+ *
+ * @param   profiler    A pointer to the @a `gbProfiler` to be updated.
+ * @param   bank        The ROM bank mapped at @a `address`.
+ *                      Ignored outside of ROM.
+ * @param   address     The address of the instruction's opcode.
+ * @param   cycles      The T-cycles the instruction took, including any
+ *                      interrupt dispatch which preceded it.
+ *
+ * @return  If successful, returns `true`.
+ *          If the profiler pointer is `nullptr`, or if memory allocation
+ *          fails, returns `false`.
+ */
+GB_API bool gbRecordProfilerCycles (gbProfiler* profiler, uint16_t bank,
+    uint16_t address, uint64_t cycles);
+
+/**
+ * @brief   Counts T-cycles spent in the `HALT` state, which belong to no
+ *          instruction.
+ *
+ * @param   profiler    A pointer to the @a `gbProfiler` to be updated.
+ * @param   cycles      The T-cycles spent halted.
+ *
+ * @return  If successful, returns `true`.
+ *          If the profiler pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbRecordProfilerHalt (gbProfiler* profiler, uint64_t cycles);
+
+/* Public Function Declarations - Symbols *************************************/
+
+/**
+ * @brief   Loads the symbols from an RGBDS `.sym` file into the given
+ *          profiler, replacing any loaded before.
+ *
+ * Each line of such a file is either a comment, starting with `;`, or a
+ * `BANK:ADDRESS NAME` triple in hexadecimal. Local labels (`Parent.local`)
+ * are kept, and attributed to the instructions between them and the next
+ * label.
+ *
+ * @param   profiler    A pointer to the @a `gbProfiler` to be updated.
+ * @param   filepath    The path of the `.sym` file.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be read, or if memory allocation fails, returns
+ *          `false`.
+ */
+GB_API bool gbLoadProfilerSymbols (gbProfiler* profiler, const char* filepath);
+
+/**
+ * @brief   Retrieves the number of symbols loaded into the given profiler.
+ */
+GB_API size_t gbGetProfilerSymbolCount (const gbProfiler* profiler);
+
+/**
+ * @brief   Retrieves the symbol table loaded into the given profiler, so that
+ *          other tools can share it.
+ */
+GB_API const gbSymbolTable* gbGetProfilerSymbols (const gbProfiler* profiler);
+
+/**
+ * @brief   Looks up the symbol containing the given address: the nearest
+ *          symbol at or before it, in the same bank.
+ *
+ * @param   profiler    A pointer to the @a `gbProfiler` to be searched.
+ * @param   bank        The ROM bank of the address, or `0` outside of ROM.
+ * @param   address     The address to be looked up.
+ *
+ * @return  The symbol's name, or `nullptr` if no symbol contains the address.
+ */
+GB_API const char* gbLookupProfilerSymbol (const gbProfiler* profiler,
+    uint16_t bank, uint16_t address);
+
+/* Public Function Declarations - Reporting ***********************************/
+
+/**
+ * @brief   Rebuilds the given profiler's report from its counters, sorted by
+ *          T-cycles, from most to fewest.
+ *
+ * @param   profiler        A pointer to the @a `gbProfiler` to be reported.
+ * @param   groupBySymbol   If `true`, every address attributed to a symbol is
+ *                          folded into one row for that symbol; addresses with
+ *                          no symbol keep rows of their own.
+ *
+ * @return  If successful, returns `true`.
+ *          If the profiler pointer is `nullptr`, or if memory allocation
+ *          fails, returns `false`.
+ */
+GB_API bool gbBuildProfilerReport (gbProfiler* profiler, bool groupBySymbol);
+
+/**
+ * @brief   Retrieves the report most recently built by
+ *          @a `gbBuildProfilerReport`. It remains valid until the next report
+ *          is built, or the profiler is destroyed.
+ *
+ * @param   profiler    A pointer to the @a `gbProfiler` to be reported.
+ * @param   outCount    A pointer to a variable where the number of rows will
+ *                      be stored.
+ *
+ * @return  A pointer to the report's rows, or `nullptr` if it has none.
+ */
+GB_API const gbProfilerEntry* gbGetProfilerReport (const gbProfiler* profiler,
+    size_t* outCount);
+
+/**
+ * @brief   Retrieves the total T-cycles counted by the given profiler, both
+ *          against instructions and in the `HALT` state.
+ */
+GB_API uint64_t gbGetProfilerTotalCycles (const gbProfiler* profiler);
+
+/**
+ * @brief   Retrieves the T-cycles the given profiler counted in the `HALT`
+ *          state.
+ */
+GB_API uint64_t gbGetProfilerHaltedCycles (const gbProfiler* profiler);
+
+/**
+ * @brief   Writes the given profiler's counters to a file in the "folded
+ *          stacks" format read by flame graph tools: one `frame;frame cycles`
+ *          line per distinct stack.
+ *
+ * The profiler does not record call stacks, so each stack is the symbol's
+ * parent label followed by its local label, if any (`Main;Main.loop`). Cycles
+ * at addresses with no symbol are written under `$BB:AAAA` frames, and cycles
+ * spent halted under a `[halted]` frame. This rebuilds the profiler's report,
+ * grouped by symbol.
+ *
+ * @param   profiler    A pointer to the @a `gbProfiler` to be exported.
+ * @param   filepath    The path of the file to be written.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be written, or if memory allocation fails,
+ *          returns `false`.
+ */
+GB_API bool gbSaveProfilerFoldedStacks (gbProfiler* profiler,
+    const char* filepath);
@@ -0,0 +1,519 @@
+/**
+ * @file    GB/Search.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's RAM search.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Cartridge.h>
+#include <GB/Memory.h>
+#include <GB/Search.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The number of candidates held in each word of the candidate set.
+ */
+#define GB_RAM_SEARCH_LANES 64
+
+/**
+ * @brief   The number of WRAM banks searched in DMG mode, CGB mode and engine
+ *          mode, respectively.
+ */
+#define GB_RAM_SEARCH_DMG_WRAM_BANKS    2
+#define GB_RAM_SEARCH_CGB_WRAM_BANKS    8
+#define GB_RAM_SEARCH_ENGINE_WRAM_BANKS 0xFF
+
+/**
+ * @brief   Multiplying a word whose bytes are each `0` or `1` by this constant
+ *          gathers byte `k` into bit `56 + k` of the product, without carries.
+ */
+#define GB_RAM_SEARCH_PACK 0x0102040810204080ull
+
+/* Private Unions and Structures **********************************************/
+
+struct gbRAMSearch
+{
+    uint8_t*    current;        /** @brief The latest snapshot. */
+    uint8_t*    previous;       /** @brief The snapshot before it. */
+    uint64_t*   candidates;     /** @brief One bit per snapshot byte; set while the byte is a candidate. */
+    size_t      size;           /** @brief The size of each snapshot, in bytes. */
+    size_t      capacity;       /** @brief The size of each snapshot buffer; a whole number of words, plus one byte. */
+    size_t      sramSize;       /** @brief The bytes of cartridge RAM at the start of each snapshot. */
+    size_t      wramSize;       /** @brief The bytes of WRAM following them; HRAM follows these. */
+    size_t      candidateCount; /** @brief The number of bits set in `candidates`. */
+};
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static size_t gbCountCandidates (uint64_t word);
+static bool gbMeasureRAMSearch (const gbContext* context, size_t* outSRAMSize,
+    size_t* outWRAMSize);
+static bool gbTakeRAMSnapshot (const gbRAMSearch* search,
+    const gbContext* context, uint8_t* snapshot);
+static uint64_t gbPackMatches (const uint8_t* matches);
+static uint64_t gbMatchBytes (const uint8_t* current, const uint8_t* previous,
+    gbRAMSearchComparison comparison, uint8_t operand);
+static bool gbDecodeSearchValue (const uint8_t* bytes, gbRAMSearchValue value,
+    uint32_t* outValue);
+static bool gbCompareSearchValues (gbRAMSearchValue value,
+    gbRAMSearchComparison comparison, uint32_t current, uint32_t previous,
+    uint32_t operand);
+static uint64_t gbMatchValues (const uint8_t* current, const uint8_t* previous,
+    uint64_t live, gbRAMSearchValue value, gbRAMSearchComparison comparison,
+    uint32_t operand);
+static void gbDropCandidate (gbRAMSearch* search, size_t offset);
+static void gbLocateCandidate (const gbRAMSearch* search, size_t offset,
+    gbRAMSearchResult* outResult);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+size_t gbCountCandidates (uint64_t word)
+{
+    // - Count the set bits of the word in parallel: in pairs, nibbles, then
+    //   bytes, and sum the bytes with one multiply.
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (size_t) ((word * 0x0101010101010101ull) >> 56);
+}
+
+bool gbMeasureRAMSearch (const gbContext* context, size_t* outSRAMSize,
+    size_t* outWRAMSize)
+{
+    gbAssert(context != nullptr);
+    gbAssert(outSRAMSize != nullptr);
+    gbAssert(outWRAMSize != nullptr);
+
+    const gbCartridge* cartridge = gbGetCartridge(context);
+    *outSRAMSize = (cartridge != nullptr) ?
+        gbGetCartridgeRAMSize(gbGetCartridgeHeader(cartridge)) : 0;
+
+    bool isCGBMode = false, isEngineMode = false;
+    gbCheckCGBMode(context, &isCGBMode);
+    gbCheckEngineMode(context, &isEngineMode);
+    *outWRAMSize = GB_WRAM_BANK_SIZE * (
+        isEngineMode ? GB_RAM_SEARCH_ENGINE_WRAM_BANKS :
+        isCGBMode ? GB_RAM_SEARCH_CGB_WRAM_BANKS :
+        GB_RAM_SEARCH_DMG_WRAM_BANKS);
+
+    return true;
+}
+
+bool gbTakeRAMSnapshot (const gbRAMSearch* search, const gbContext* context,
+    uint8_t* snapshot)
+{
+    gbAssert(search != nullptr);
+    gbAssert(context != nullptr);
+    gbAssert(snapshot != nullptr);
+
+    if (search->sramSize > 0 &&
+        gbCopyCartridgeRAM(gbGetCartridge(context), snapshot,
+            search->sramSize) == false)
+    {
+        return false;
+    }
+
+    // - Work RAM is read through the bus where the bus shows all of it, as
+    //   on the DMG; the CGB's and engine mode's banks out of view are copied
+    //   from the memory component. High RAM is always read through the bus.
+    uint8_t* wram = snapshot + search->sramSize;
+    bool wramRead = (search->wramSize == GB_WRAM_SIZE) ?
+        gbReadBlock(context, GB_WRAM0_START, GB_WRAM_SIZE, wram, GB_BF_PEEK) :
+        gbCopyWorkRAM(gbGetMemory(context), wram, search->wramSize);
+
+    return wramRead == true &&
+        gbReadBlock(context, GB_HRAM_START, GB_HRAM_SIZE,
+            wram + search->wramSize, GB_BF_PEEK);
+}
+
+uint64_t gbPackMatches (const uint8_t* matches)
+{
+    gbAssert(matches != nullptr);
+
+    // - Each match is `0` or `1`; gather eight at a time into one byte of the
+    //   result.
+    uint64_t result = 0;
+    for (size_t i = 0; i < GB_RAM_SEARCH_LANES / 8; ++i)
+    {
+        uint64_t word = 0;
+        memcpy(&word, matches + (i * 8), sizeof(word));
+        result |= ((word * GB_RAM_SEARCH_PACK) >> 56) << (i * 8);
+    }
+
+    return result;
+}
+
+uint64_t gbMatchBytes (const uint8_t* current, const uint8_t* previous,
+    gbRAMSearchComparison comparison, uint8_t operand)
+{
+    gbAssert(current != nullptr);
+    gbAssert(previous != nullptr);
+
+    // - Every loop has a fixed trip count and no branches in its body, so the
+    //   compiler turns each into a handful of vector compares.
+    uint8_t matches[GB_RAM_SEARCH_LANES];
+    switch (comparison)
+    {
+        case GB_RSC_EQUAL_TO:
+            for (size_t i = 0; i < GB_RAM_SEARCH_LANES; ++i)
+                { matches[i] = current[i] == operand; }
+            break;
+        case GB_RSC_NOT_EQUAL_TO:
+            for (size_t i = 0; i < GB_RAM_SEARCH_LANES; ++i)
+                { matches[i] = current[i] != operand; }
+            break;
+        case GB_RSC_CHANGED:
+            for (size_t i = 0; i < GB_RAM_SEARCH_LANES; ++i)
+                { matches[i] = current[i] != previous[i]; }
+            break;
+        case GB_RSC_UNCHANGED:
+            for (size_t i = 0; i < GB_RAM_SEARCH_LANES; ++i)
+                { matches[i] = current[i] == previous[i]; }
+            break;
+        case GB_RSC_INCREASED:
+            for (size_t i = 0; i < GB_RAM_SEARCH_LANES; ++i)
+                { matches[i] = current[i] > previous[i]; }
+            break;
+        case GB_RSC_DECREASED:
+            for (size_t i = 0; i < GB_RAM_SEARCH_LANES; ++i)
+                { matches[i] = current[i] < previous[i]; }
+            break;
+        case GB_RSC_INCREASED_BY:
+            for (size_t i = 0; i < GB_RAM_SEARCH_LANES; ++i)
+                { matches[i] = (uint8_t) (current[i] - previous[i]) == operand; }
+            break;
+        case GB_RSC_DECREASED_BY:
+            for (size_t i = 0; i < GB_RAM_SEARCH_LANES; ++i)
+                { matches[i] = (uint8_t) (previous[i] - current[i]) == operand; }
+            break;
+        default:
+            return 0;
+    }
+
+    return gbPackMatches(matches);
+}
+
+bool gbDecodeSearchValue (const uint8_t* bytes, gbRAMSearchValue value,
+    uint32_t* outValue)
+{
+    gbAssert(bytes != nullptr);
+    gbAssert(outValue != nullptr);
+
+    uint32_t raw = bytes[0];
+    if (value == GB_RSV_U16 || value == GB_RSV_BCD16)
+    {
+        raw |= (uint32_t) bytes[1] << 8;
+    }
+
+    if (value == GB_RSV_U8 || value == GB_RSV_U16)
+    {
+        *outValue = raw;
+        return true;
+    }
+
+    // - Read the packed BCD digits, most significant first; a nibble above
+    //   `9` is not a BCD digit.
+    uint32_t result = 0;
+    for (int shift = (value == GB_RSV_BCD16) ? 12 : 4; shift >= 0; shift -= 4)
+    {
+        uint32_t digit = (raw >> shift) & 0x0F;
+        if (digit > 9)
+        {
+            return false;
+        }
+
+        result = (result * 10) + digit;
+    }
+
+    *outValue = result;
+    return true;
+}
+
+bool gbCompareSearchValues (gbRAMSearchValue value,
+    gbRAMSearchComparison comparison, uint32_t current, uint32_t previous,
+    uint32_t operand)
+{
+    // - Binary values wrap around on increase and decrease, as the game's own
+    //   arithmetic would; decimal values do not.
+    uint32_t mask = (value == GB_RSV_U16) ? 0xFFFF : 0xFF;
+    bool isBCD = (value == GB_RSV_BCD8 || value == GB_RSV_BCD16);
+
+    switch (comparison)
+    {
+        case GB_RSC_EQUAL_TO:       return current == operand;
+        case GB_RSC_NOT_EQUAL_TO:   return current != operand;
+        case GB_RSC_CHANGED:        return current != previous;
+        case GB_RSC_UNCHANGED:      return current == previous;
+        case GB_RSC_INCREASED:      return current > previous;
+        case GB_RSC_DECREASED:      return current < previous;
+        case GB_RSC_INCREASED_BY:
+            return isBCD ?
+                (current >= previous && current - previous == operand) :
+                ((current - previous) & mask) == (operand & mask);
+        case GB_RSC_DECREASED_BY:
+            return isBCD ?
+                (previous >= current && previous - current == operand) :
+                ((previous - current) & mask) == (operand & mask);
+        default:
+            return false;
+    }
+}
+
+uint64_t gbMatchValues (const uint8_t* current, const uint8_t* previous,
+    uint64_t live, gbRAMSearchValue value, gbRAMSearchComparison comparison,
+    uint32_t operand)
+{
+    gbAssert(current != nullptr);
+    gbAssert(previous != nullptr);
+
+    // - Wide and decimal values are decoded one live candidate at a time. The
+    //   lowest live lane is the count of the bits below it.
+    uint64_t result = 0;
+    for (uint64_t bits = live; bits != 0; bits &= bits - 1)
+    {
+        size_t lane = gbCountCandidates((bits & (0 - bits)) - 1);
+        uint32_t currentValue = 0, previousValue = 0;
+        if (
+            gbDecodeSearchValue(current + lane, value, &currentValue) &&
+            gbDecodeSearchValue(previous + lane, value, &previousValue) &&
+            gbCompareSearchValues(value, comparison, currentValue,
+                previousValue, operand)
+        )
+        {
+            result |= 1ull << lane;
+        }
+    }
+
+    return result;
+}
+
+void gbDropCandidate (gbRAMSearch* search, size_t offset)
+{
+    gbAssert(search != nullptr);
+    gbAssert(offset < search->size);
+
+    uint64_t bit = 1ull << (offset % GB_RAM_SEARCH_LANES);
+    uint64_t* word = &search->candidates[offset / GB_RAM_SEARCH_LANES];
+    if ((*word & bit) != 0)
+    {
+        *word &= ~bit;
+        search->candidateCount--;
+    }
+}
+
+void gbLocateCandidate (const gbRAMSearch* search, size_t offset,
+    gbRAMSearchResult* outResult)
+{
+    gbAssert(search != nullptr);
+    gbAssert(outResult != nullptr);
+
+    if (offset < search->sramSize)
+    {
+        outResult->region = GB_RSR_CARTRIDGE_RAM;
+        outResult->bank = (uint8_t) (offset / GB_EXTRAM_SIZE);
+        outResult->address = (uint16_t) (GB_EXTRAM_START + (offset % GB_EXTRAM_SIZE));
+        return;
+    }
+
+    offset -= search->sramSize;
+    if (offset < search->wramSize)
+    {
+        // - Bank `0` sits at `$C000`; every other bank is seen at `$D000`.
+        outResult->region = GB_RSR_WORK_RAM;
+        outResult->bank = (uint8_t) (offset / GB_WRAM_BANK_SIZE);
+        outResult->address = (uint16_t) (((outResult->bank == 0) ?
+            GB_WRAM0_START : GB_WRAMX_START) + (offset % GB_WRAM_BANK_SIZE));
+        return;
+    }
+
+    outResult->region = GB_RSR_HIGH_RAM;
+    outResult->bank = 0;
+    outResult->address = (uint16_t) (GB_HRAM_START + (offset - search->wramSize));
+}
+
+/* Public Function Definitions ************************************************/
+
+gbRAMSearch* gbCreateRAMSearch ()
+{
+    gbRAMSearch* search = gbCreateZero(1, gbRAMSearch);
+    gbCheckpv(search != nullptr, nullptr,
+        "Could not allocate memory for 'gbRAMSearch'");
+
+    return search;
+}
+
+bool gbDestroyRAMSearch (gbRAMSearch* search)
+{
+    gbCheckqv(search != nullptr, false);
+
+    gbDestroy(search->current);
+    gbDestroy(search->previous);
+    gbDestroy(search->candidates);
+    gbDestroy(search);
+    return true;
+}
+
+bool gbResetRAMSearch (gbRAMSearch* search, const gbContext* context)
+{
+    gbCheckv(search != nullptr, false, "No valid RAM search provided.");
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckqv(context, false);
+
+    size_t sramSize = 0, wramSize = 0;
+    gbMeasureRAMSearch(context, &sramSize, &wramSize);
+
+    // - Round the buffers up to whole words, so the last word of candidates
+    //   is compared like any other, plus one byte for the high half of a
+    //   two-byte value at the very end. The padding stays zero.
+    size_t size = sramSize + wramSize + GB_HRAM_SIZE;
+    size_t words = (size + GB_RAM_SEARCH_LANES - 1) / GB_RAM_SEARCH_LANES;
+    size_t capacity = (words * GB_RAM_SEARCH_LANES) + 1;
+    if (capacity != search->capacity)
+    {
+        gbDestroy(search->current);
+        gbDestroy(search->previous);
+        gbDestroy(search->candidates);
+        search->capacity = 0;
+
+        search->current = gbCreateZero(capacity, uint8_t);
+        search->previous = gbCreateZero(capacity, uint8_t);
+        search->candidates = gbCreateZero(words, uint64_t);
+        gbCheckpv(search->current != nullptr && search->previous != nullptr &&
+            search->candidates != nullptr, false,
+            "Could not allocate memory for RAM search snapshots");
+
+        search->capacity = capacity;
+    }
+
+    search->size = size;
+    search->sramSize = sramSize;
+    search->wramSize = wramSize;
+    gbCheckqv(gbTakeRAMSnapshot(search, context, search->current), false);
+    memcpy(search->previous, search->current, capacity);
+
+    // - Every byte is a candidate; the bits past the end of the snapshot are
+    //   not.
+    memset(search->candidates, 0xFF, words * sizeof(uint64_t));
+    if (size % GB_RAM_SEARCH_LANES != 0)
+    {
+        search->candidates[words - 1] =
+            (1ull << (size % GB_RAM_SEARCH_LANES)) - 1;
+    }
+
+    search->candidateCount = size;
+    return true;
+}
+
+bool gbFilterRAMSearch (gbRAMSearch* search, const gbContext* context,
+    gbRAMSearchValue value, gbRAMSearchComparison comparison, uint32_t operand)
+{
+    gbCheckv(search != nullptr, false, "No valid RAM search provided.");
+    gbCheckv(search->candidates != nullptr, false,
+        "RAM search has not been reset.");
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckqv(context, false);
+
+    size_t sramSize = 0, wramSize = 0;
+    gbMeasureRAMSearch(context, &sramSize, &wramSize);
+    gbCheckv(sramSize == search->sramSize && wramSize == search->wramSize,
+        false, "RAM has changed size since the search was reset.");
+
+    // - Take the new snapshot into the older buffer, so a failed copy leaves
+    //   the search as it was.
+    gbCheckqv(gbTakeRAMSnapshot(search, context, search->previous), false);
+    uint8_t* current = search->previous;
+    uint8_t* previous = search->current;
+
+    size_t words = (search->size + GB_RAM_SEARCH_LANES - 1) / GB_RAM_SEARCH_LANES;
+    size_t candidateCount = 0;
+    for (size_t i = 0; i < words; ++i)
+    {
+        uint64_t live = search->candidates[i];
+        if (live == 0)
+        {
+            continue;
+        }
+
+        size_t base = i * GB_RAM_SEARCH_LANES;
+        uint64_t matches = (value == GB_RSV_U8) ?
+            gbMatchBytes(current + base, previous + base, comparison,
+                (uint8_t) operand) :
+            gbMatchValues(current + base, previous + base, live, value,
+                comparison, operand);
+
+        search->candidates[i] = live & matches;
+        candidateCount += gbCountCandidates(live & matches);
+    }
+
+    search->current = current;
+    search->previous = previous;
+    search->candidateCount = candidateCount;
+
+    // - A two-byte value cannot start on the last byte of an area of RAM.
+    if (value == GB_RSV_U16 || value == GB_RSV_BCD16)
+    {
+        if (search->sramSize > 0)
+        {
+            gbDropCandidate(search, search->sramSize - 1);
+        }
+
+        gbDropCandidate(search, search->sramSize + search->wramSize - 1);
+        gbDropCandidate(search, search->size - 1);
+    }
+
+    return true;
+}
+
+size_t gbGetRAMSearchCandidateCount (const gbRAMSearch* search)
+{
+    gbCheckqv(search != nullptr, 0);
+    return search->candidateCount;
+}
+
+size_t gbGetRAMSearchResults (const gbRAMSearch* search,
+    gbRAMSearchValue value, size_t first, gbRAMSearchResult* outResults,
+    size_t maxResults)
+{
+    gbCheckqv(search != nullptr && search->candidates != nullptr, 0);
+    gbCheckv(outResults != nullptr || maxResults == 0, 0,
+        "No valid output array provided.");
+
+    // - Skip whole words of candidates until the first one wanted is reached.
+    size_t words = (search->size + GB_RAM_SEARCH_LANES - 1) / GB_RAM_SEARCH_LANES;
+    size_t count = 0;
+    for (size_t i = 0; i < words && count < maxResults; ++i)
+    {
+        uint64_t bits = search->candidates[i];
+        size_t population = gbCountCandidates(bits);
+        if (first >= population)
+        {
+            first -= population;
+            continue;
+        }
+
+        for (; bits != 0 && count < maxResults; bits &= bits - 1)
+        {
+            if (first > 0)
+            {
+                first--;
+                continue;
+            }
+
+            size_t offset = (i * GB_RAM_SEARCH_LANES) +
+                gbCountCandidates((bits & (0 - bits)) - 1);
+            gbRAMSearchResult* result = &outResults[count++];
+            gbLocateCandidate(search, offset, result);
+            result->valid =
+                gbDecodeSearchValue(search->current + offset, value,
+                    &result->value) &&
+                gbDecodeSearchValue(search->previous + offset, value,
+                    &result->previous);
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file    GB/Search.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's RAM search,
+ *          which narrows down the RAM addresses holding a value of interest
+ *          (lives, position, score, etc.) across successive snapshots.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Context.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Enumerates the areas of RAM which a search covers.
+ */
+typedef enum gbRAMSearchRegion : uint8_t
+{
+    GB_RSR_CARTRIDGE_RAM    = 0x00, /** @brief `$A000` - `$BFFF`, every bank. */
+    GB_RSR_WORK_RAM         = 0x01, /** @brief `$C000` - `$DFFF`, every bank present in the current mode. */
+    GB_RSR_HIGH_RAM         = 0x02  /** @brief `$FF80` - `$FFFE`. */
+} gbRAMSearchRegion;
+
+/**
+ * @brief   Enumerates the ways in which the bytes at a candidate address can be
+ *          read as a value.
+ */
+typedef enum gbRAMSearchValue : uint8_t
+{
+    GB_RSV_U8       = 0x00, /** @brief One unsigned byte. */
+    GB_RSV_U16      = 0x01, /** @brief Two bytes, little-endian, as the SM83 stores words. */
+    GB_RSV_BCD8     = 0x02, /** @brief One packed BCD byte, `0` - `99`. */
+    GB_RSV_BCD16    = 0x03  /** @brief Two packed BCD bytes, little-endian, `0` - `9999`. */
+} gbRAMSearchValue;
+
+/**
+ * @brief   Enumerates the comparisons by which a search is filtered. "Current"
+ *          is the new snapshot, "previous" is the one before it, and "N" is
+ *          the filter's operand.
+ */
+typedef enum gbRAMSearchComparison : uint8_t
+{
+    GB_RSC_EQUAL_TO         = 0x00, /** @brief Current equals N. */
+    GB_RSC_NOT_EQUAL_TO     = 0x01, /** @brief Current does not equal N. */
+    GB_RSC_CHANGED          = 0x02, /** @brief Current differs from previous. */
+    GB_RSC_UNCHANGED        = 0x03, /** @brief Current equals previous. */
+    GB_RSC_INCREASED        = 0x04, /** @brief Current is greater than previous. */
+    GB_RSC_DECREASED        = 0x05, /** @brief Current is less than previous. */
+    GB_RSC_INCREASED_BY     = 0x06, /** @brief Current is previous plus N; binary values wrap. */
+    GB_RSC_DECREASED_BY     = 0x07  /** @brief Current is previous minus N; binary values wrap. */
+} gbRAMSearchComparison;
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure describing one candidate of a RAM search.
+ */
+typedef struct gbRAMSearchResult
+{
+    gbRAMSearchRegion   region;     /** @brief The area of RAM holding the candidate. */
+    uint8_t             bank;       /** @brief The cartridge RAM or WRAM bank; `0` in HRAM. */
+    uint16_t            address;    /** @brief The absolute address of the candidate within its bank. */
+    bool                valid;      /** @brief Whether `value` and `previous` could be read; BCD values may not be. */
+    uint32_t            value;      /** @brief The value in the latest snapshot. */
+    uint32_t            previous;   /** @brief The value in the snapshot before it. */
+} gbRAMSearchResult;
+
+/* Public Types and Forward Declarations **************************************/
+
+/**
+ * @brief   Defines an opaque structure representing a RAM search.
+ *
+ * A search keeps two snapshots of cartridge RAM, WRAM and HRAM, laid end to
+ * end, and one candidate bit per byte. Each filter takes a new snapshot and
+ * compares it against the last, 64 candidates at a time; a word of the
+ * candidate set with no bits left is skipped without reading either snapshot.
+ */
+typedef struct gbRAMSearch gbRAMSearch;
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Allocates and creates a new, empty RAM search.
+ *
+ * @return  If successful, returns a pointer to the new @a `gbRAMSearch`.
+ *          If memory allocation fails, returns `nullptr`.
+ */
+GB_API gbRAMSearch* gbCreateRAMSearch ();
+
+/**
+ * @brief   Destroys and deallocates the given RAM search.
+ *
+ * @return  If successful, returns `true`.
+ *          If the search pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbDestroyRAMSearch (gbRAMSearch* search);
+
+/**
+ * @brief   Starts a new search: takes a snapshot of the given context's RAM,
+ *          and makes every address a candidate.
+ *
+ * @param   search      A pointer to the @a `gbRAMSearch` to be reset.
+ * @param   context     A pointer to the @a `gbContext` to be searched. Pass
+ *                      `nullptr` to use the current context.
+ *
+ * @return  If successful, returns `true`.
+ *          If no context is available, or memory allocation fails, returns
+ *          `false`.
+ */
+GB_API bool gbResetRAMSearch (gbRAMSearch* search, const gbContext* context);
+
+/**
+ * @brief   Takes a new snapshot of the given context's RAM, and drops every
+ *          candidate whose value does not pass the given comparison.
+ *
+ * For two-byte values, the candidate is the address of the low byte; an
+ * address whose next byte lies in another area of RAM never passes.
+ *
+ * @param   search      A pointer to the @a `gbRAMSearch` to be filtered.
+ * @param   context     A pointer to the @a `gbContext` being searched. Pass
+ *                      `nullptr` to use the current context.
+ * @param   value       How the bytes at each candidate are read.
+ * @param   comparison  The comparison each candidate must pass.
+ * @param   operand     The value N, for the comparisons which take one.
+ *
+ * @return  If successful, returns `true`.
+ *          If the search was never reset, or the context's RAM has changed
+ *          size since it was (e.g., another cartridge was attached), returns
+ *          `false`, and the search is left as it was.
+ */
+GB_API bool gbFilterRAMSearch (gbRAMSearch* search, const gbContext* context,
+    gbRAMSearchValue value, gbRAMSearchComparison comparison, uint32_t operand);
+
+/**
+ * @brief   Retrieves the number of candidates left in the given RAM search.
+ */
+GB_API size_t gbGetRAMSearchCandidateCount (const gbRAMSearch* search);
+
+/**
+ * @brief   Retrieves a run of the candidates left in the given RAM search, in
+ *          the order cartridge RAM, WRAM, HRAM.
+ *
+ * @param   search      A pointer to the @a `gbRAMSearch` to be inspected.
+ * @param   value       How the bytes at each candidate are read.
+ * @param   first       The index of the first candidate to be retrieved.
+ * @param   outResults  A pointer to an array to receive the candidates.
+ * @param   maxResults  The length of that array.
+ *
+ * @return  The number of candidates retrieved.
+ */
+GB_API size_t gbGetRAMSearchResults (const gbRAMSearch* search,
+    gbRAMSearchValue value, size_t first, gbRAMSearchResult* outResults,
+    size_t maxResults);
@@ -0,0 +1,239 @@
+/**
+ * @file    GB/Serial.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ * 
+ * @brief   Contains definitions for the Game Boy Emulator Core's serial
+ *          port component.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Serial.h>
+#include <GB/Processor.h>
+#include <GB/Internal.h>
+#include <GB/Timer.h>
+
+/* Private Unions and Structures **********************************************/
+
+struct gbSerial
+{
+    // Parent Context
+    gbContext*  parent;
+
+    // Callbacks
+    gbSerialTransferCallback transferCallback;
+
+    // Hardware Registers
+    uint8_t         sb;
+    gbRegisterSC    sc;
+
+    // Internal State
+    bool            isCGBMode;
+    uint8_t         outgoing;       // `SB` as of the start of the transfer.
+    uint8_t         bitsShifted;
+
+};
+
+/* Public Function Definitions ************************************************/
+
+gbSerial* gbCreateSerial (gbContext* context)
+{
+    gbCheckv(context, nullptr, "Parent context pointer is null");
+
+    gbSerial* serial = gbCreateZero(1, gbSerial);
+    gbCheckpv(serial, nullptr, "Error allocating memory for 'gbSerial'");
+
+    serial->parent = context;
+    return serial;
+}
+
+bool gbDestroySerial (gbSerial* serial)
+{
+    gbCheckqv(serial, false);
+    gbDestroy(serial);
+    return true;
+}
+
+bool gbInitializeSerial (gbSerial* serial)
+{
+    gbFallback(serial, gbGetSerial(nullptr));
+    gbCheckv(serial != nullptr, false,
+        "No valid 'gbSerial' provided, and no current context is set.");
+
+    // - Check CGB Mode
+    gbCheckCGBMode(serial->parent, &serial->isCGBMode);
+
+    // - Initialize Hardware Registers
+    serial->sb = 0x00;
+    serial->sc.raw = (serial->isCGBMode == true) ? 0x7F : 0x7E;
+
+    // - Initialize Internal State
+    serial->outgoing = 0x00;
+    serial->bitsShifted = 0;
+
+    gbSetProcessorSerialTransfer(gbGetProcessor(serial->parent), nullptr);
+    return true;
+}
+
+/* Public Function Definitions - Callbacks ************************************/
+
+bool gbSetSerialTransferCallback (gbSerial* serial,
+    gbSerialTransferCallback callback)
+{
+    gbFallback(serial, gbGetSerial(nullptr));
+    gbCheckv(serial != nullptr, false,
+        "No valid 'gbSerial' provided, and no current context is set.");
+
+    serial->transferCallback = callback;
+    return true;
+}
+
+/* Public Function Definitions - Ticking **************************************/
+
+bool gbTickSerial (gbSerial* serial)
+{
+    gbFallback(serial, gbGetSerial(nullptr));
+    gbCheckv(serial != nullptr, false,
+        "No valid 'gbSerial' provided, and no current context is set.");
+
+    // - Only transfers driven by the internal clock make progress; with an
+    //   external clock, the transfer waits for a link partner which is not
+    //   emulated.
+    if (serial->sc.enabled == false || serial->sc.clockSelect == false)
+    {
+        return true;
+    }
+
+    // - Check `STOP` and Speed Switch States.
+    // - If either is active, the divider is frozen; early out.
+    bool isStopped = false, isSwitchingSpeed = false;
+    gbProcessor* processor = gbGetProcessor(serial->parent);
+    gbCheckStopState(processor, &isStopped);
+    gbCheckSpeedSwitchState(processor, &isSwitchingSpeed);
+    if (isStopped == true || isSwitchingSpeed == true)
+    {
+        return true;
+    }
+
+    // - The serial clock is derived from the timer's divider: 8,192 Hz from
+    //   bit 8, or 262,144 Hz from bit 3 if the CGB fast clock is selected.
+    uint8_t dividerBit =
+        (serial->isCGBMode == true && serial->sc.clockSpeed == true) ? 3 : 8;
+    bool fallingEdge = false;
+    gbCheckTimerDividerFallingEdge(gbGetTimer(serial->parent), dividerBit,
+        &fallingEdge);
+    if (fallingEdge == false)
+    {
+        return true;
+    }
+
+    // - Shift one bit out of `SB`. With no link partner connected, the
+    //   incoming line is pulled high, so a `1` is shifted in.
+    serial->sb = (serial->sb << 1) | 0x01;
+    if (++serial->bitsShifted < 8)
+    {
+        return true;
+    }
+
+    // - Transfer Complete.
+    serial->sc.enabled = false;
+    serial->bitsShifted = 0;
+    gbSetProcessorSerialTransfer(processor, nullptr);
+
+    // - Request Serial Interrupt.
+    gbRequestInterrupt(processor, GB_INT_SERIAL);
+
+    // - Invoke Transfer Callback if Set.
+    if (serial->transferCallback != nullptr)
+    {
+        serial->transferCallback(serial->parent, serial->outgoing, serial->sb);
+    }
+
+    return true;
+}
+
+/* Private Function Definitions - Hardware Register Access ********************/
+
+bool gbReadSB (const gbSerial* serial, uint8_t* outValue, const gbCheckRules* checkRules)
+{
+    gbFallback(serial, gbGetSerial(nullptr));
+    gbCheckv(serial != nullptr, false,
+        "No valid 'gbSerial' provided, and no current context is set.");
+    gbCheckv(outValue != nullptr, false,
+        "No valid output pointer provided for SB register read.");
+
+    // - All 8 bits of `SB` are readable.
+    *outValue = serial->sb;
+
+    return true;
+}
+
+bool gbReadSC (const gbSerial* serial, uint8_t* outValue, const gbCheckRules* checkRules)
+{
+    gbFallback(serial, gbGetSerial(nullptr));
+    gbCheckv(serial != nullptr, false,
+        "No valid 'gbSerial' provided, and no current context is set.");
+    gbCheckv(outValue != nullptr, false,
+        "No valid output pointer provided for SC register read.");
+
+    // - Bits 2-6 are unused; read as `1`.
+    // - Bit 1 is only readable in CGB Mode; otherwise, it reads as `1`.
+    *outValue =
+        0b01111100 |                            // Bits 2-6 unused, read as `1`
+        (serial->sc.raw & 0b10000001) |         // Bits 0 and 7 readable
+        ((serial->isCGBMode == true) ?
+            (serial->sc.raw & 0b00000010) : 0b00000010);
+
+    return true;
+}
+
+bool gbWriteSB (gbSerial* serial, uint8_t value, uint8_t* outActual, const gbCheckRules* checkRules)
+{
+    gbFallback(serial, gbGetSerial(nullptr));
+    gbCheckv(serial != nullptr, false,
+        "No valid 'gbSerial' provided, and no current context is set.");
+
+    // - All 8 bits of `SB` are writable.
+    serial->sb = value;
+
+    if (outActual != nullptr)
+    {
+        *outActual = serial->sb;
+    }
+
+    return true;
+}
+
+bool gbWriteSC (gbSerial* serial, uint8_t value, uint8_t* outActual, const gbCheckRules* checkRules)
+{
+    gbFallback(serial, gbGetSerial(nullptr));
+    gbCheckv(serial != nullptr, false,
+        "No valid 'gbSerial' provided, and no current context is set.");
+
+    // - Bits 2-6 are unused; write as `1`.
+    // - Bits 0, 1 and 7 are writable.
+    serial->sc.raw =
+        0b01111100 |                            // Bits 2-6 unused, write as `1`
+        (value & 0b10000011);                   // Bits 0, 1 and 7 writable
+
+    // - Setting bit 7 starts a new transfer of the current contents of `SB`.
+    if (serial->sc.enabled == true)
+    {
+        serial->outgoing = serial->sb;
+        serial->bitsShifted = 0;
+    }
+
+    // - Only a transfer driven by the internal clock needs the processor to
+    //   clock it; see `gbTickSerial`.
+    gbSetProcessorSerialTransfer(gbGetProcessor(serial->parent),
+        (serial->sc.enabled == true && serial->sc.clockSelect == true) ?
+            serial : nullptr);
+
+    if (outActual != nullptr)
+    {
+        *outActual = serial->sc.raw;
+    }
+
+    return true;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file    GB/Serial.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ * 
+ * @brief   Contains declarations for the Game Boy Emulator Core's serial
+ *          port component.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Context.h>
+
+/* Public Types and Forward Declarations **************************************/
+
+/**
+ * @brief   Defines a pointer to a function called by the Game Boy Emulator Core's
+ *          serial port component when a serial transfer completes.
+ * 
+ * @param   context     A pointer to the @a `gbContext` structure whose serial
+ *                      port component completed the transfer.
+ * @param   sent        The byte which was shifted out of `SB` by the transfer.
+ * @param   received    The byte which was shifted into `SB` by the transfer.
+ */
+typedef void (*gbSerialTransferCallback) (gbContext* context, uint8_t sent,
+    uint8_t received);
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a bitfield union representing the Game Boy serial port's
+ *          `SC` hardware register, which controls serial transfers.
+ */
+typedef union gbRegisterSC
+{
+    struct
+    {
+        uint8_t clockSelect : 1;    /** @brief Bit 0: Clock source (`1` = Internal; `0` = External). */
+        uint8_t clockSpeed  : 1;    /** @brief Bit 1: CGB Mode only - Clock speed (`1` = Fast). */
+        uint8_t             : 5;
+        uint8_t enabled     : 1;    /** @brief Bit 7: Transfer requested or in progress. */
+    };
+
+    uint8_t raw;    /** @brief The raw, 8-bit value of the register. */
+} gbRegisterSC;
+
+/* Public Function Declarations ***********************************************/
+
+GB_API gbSerial* gbCreateSerial (gbContext* context);
+GB_API bool gbDestroySerial (gbSerial* serial);
+GB_API bool gbInitializeSerial (gbSerial* serial);
+
+/* Public Function Declarations - Callbacks ***********************************/
+
+GB_API bool gbSetSerialTransferCallback (gbSerial* serial,
+    gbSerialTransferCallback callback);
+
+/* Public Function Declarations - Ticking *************************************/
+
+GB_API bool gbTickSerial (gbSerial* serial);
+
+/* Public Function Declarations - Hardware Register Access ********************/
+
+GB_API bool gbReadSB (const gbSerial* serial, uint8_t* outValue, const gbCheckRules* rules);
+GB_API bool gbReadSC (const gbSerial* serial, uint8_t* outValue, const gbCheckRules* rules);
+
+GB_API bool gbWriteSB (gbSerial* serial, uint8_t value, uint8_t* outActual, const gbCheckRules* rules);
+GB_API bool gbWriteSC (gbSerial* serial, uint8_t value, uint8_t* outActual, const gbCheckRules* rules);
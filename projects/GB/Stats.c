@@ -0,0 +1,83 @@
+/**
+ * @file    GB/Stats.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's runtime
+ *          statistics counters.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Stats.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   Defines a lookup table mapping `gbBusRegion` values to their
+ *          corresponding human-readable region names.
+ */
+static const char* GB_BUS_REGION_NAMES[] = {
+    [GB_BR_ROM]     = "ROM",
+    [GB_BR_VRAM]    = "VRAM",
+    [GB_BR_SRAM]    = "SRAM",
+    [GB_BR_WRAM]    = "WRAM",
+    [GB_BR_OAM]     = "OAM",
+    [GB_BR_IO]      = "IO",
+    [GB_BR_HRAM]    = "HRAM",
+    [GB_BR_COUNT]   = "??"
+};
+
+/* Public Function Definitions ************************************************/
+
+bool gbGetStats (const gbContext* context, gbStats* outStats)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+    gbCheckv(outStats != nullptr, false,
+        "No valid output pointer provided for statistics.");
+
+#if defined(GB_ENABLE_STATS)
+    *outStats = *gbGetContextStats(context);
+    return true;
+#else
+    memset(outStats, 0, sizeof(*outStats));
+    return false;
+#endif
+}
+
+bool gbResetStats (gbContext* context)
+{
+    gbFallback(context, gbGetCurrentContext());
+    gbCheckv(context != nullptr, false,
+        "No valid 'gbContext' provided, and no current context is set.");
+
+#if defined(GB_ENABLE_STATS)
+    memset(gbGetContextStats(context), 0, sizeof(gbStats));
+    return true;
+#else
+    return false;
+#endif
+}
+
+gbBusRegion gbGetBusRegion (uint16_t address)
+{
+    if (address <= GB_ROMX_END)         { return GB_BR_ROM; }
+    else if (address <= GB_VRAM_END)    { return GB_BR_VRAM; }
+    else if (address <= GB_EXTRAM_END)  { return GB_BR_SRAM; }
+    else if (address <= GB_ECHO_END)    { return GB_BR_WRAM; }
+    else if (address <= GB_UNUSED_END)  { return GB_BR_OAM; }
+    else if (
+        address >= GB_HRAM_START &&
+        address <= GB_HRAM_END
+    )                                   { return GB_BR_HRAM; }
+    else                                { return GB_BR_IO; }
+}
+
+const char* gbStringifyBusRegion (gbBusRegion region)
+{
+    return (region < GB_BR_COUNT) ?
+        GB_BUS_REGION_NAMES[region] :
+        GB_BUS_REGION_NAMES[GB_BR_COUNT];
+}
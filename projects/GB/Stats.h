@@ -0,0 +1,145 @@
+/**
+ * @file    GB/Stats.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's runtime
+ *          statistics counters.
+ *
+ * Counters are only kept if the core is built with `GB_ENABLE_STATS` defined
+ * (see the `--enable-stats` build option). Otherwise, every counting site
+ * compiles to nothing, and @a `gbGetStats` reports that no statistics exist.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Context.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Defines the number of interrupt sources counted separately, enough
+ *          for every Engine Mode interrupt.
+ */
+#define GB_STATS_INTERRUPT_COUNT 8
+
+/**
+ * @brief   Enumerates the regions of the memory map which bus accesses are
+ *          counted against.
+ */
+typedef enum gbBusRegion : uint8_t
+{
+    GB_BR_ROM   = 0x00, /** @brief `$0000` - `$7FFF`: Cartridge ROM */
+    GB_BR_VRAM  = 0x01, /** @brief `$8000` - `$9FFF`: Video RAM */
+    GB_BR_SRAM  = 0x02, /** @brief `$A000` - `$BFFF`: Cartridge RAM */
+    GB_BR_WRAM  = 0x03, /** @brief `$C000` - `$FDFF`: Work RAM, and its echo */
+    GB_BR_OAM   = 0x04, /** @brief `$FE00` - `$FEFF`: OAM, and the unusable area after it */
+    GB_BR_IO    = 0x05, /** @brief `$FF00` - `$FF7F`, and `$FFFF`: Port registers */
+    GB_BR_HRAM  = 0x06, /** @brief `$FF80` - `$FFFE`: High RAM */
+    GB_BR_COUNT = 0x07
+} gbBusRegion;
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure holding a context's runtime statistics, counted
+ *          since the context was created or its statistics were last reset.
+ */
+typedef struct gbStats
+{
+    uint64_t    instructions;                           /** @brief Instructions executed. */
+    uint64_t    tickCycles;                             /** @brief T-cycles consumed. */
+    uint64_t    haltedCycles;                           /** @brief T-cycles consumed in the `HALT` state. */
+    uint64_t    busReads[GB_BR_COUNT];                  /** @brief Bus reads, per @a `gbBusRegion`. */
+    uint64_t    busWrites[GB_BR_COUNT];                 /** @brief Bus writes, per @a `gbBusRegion`. */
+    uint64_t    busCallbacks;                           /** @brief Bus read and write callbacks invoked. */
+    uint64_t    interrupts[GB_STATS_INTERRUPT_COUNT];   /** @brief Interrupts serviced, per @a `gbInterrupt`. */
+    uint64_t    mbcWrites;                              /** @brief Writes to the cartridge's MBC registers. */
+    uint64_t    bankSwitches;                           /** @brief MBC writes which changed the switchable ROM bank. */
+    uint64_t    runNanoseconds;                         /** @brief Host time spent in @a `gbRun`. */
+} gbStats;
+
+/* Public Function Macros *****************************************************/
+
+/**
+ * @brief   Adds to one of a context's statistics counters, if statistics are
+ *          enabled. Otherwise, neither argument is evaluated.
+ */
+#if defined(GB_ENABLE_STATS)
+    #define gbCountStat(context, counter, amount) \
+        (gbGetContextStats(context)->counter += (amount))
+#else
+    #define gbCountStat(context, counter, amount) ((void) 0)
+#endif
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Retrieves a copy of the given context's statistics counters.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure whose
+ *                      statistics are to be retrieved. Pass `nullptr` to use
+ *                      the current context.
+ * @param   outStats    A pointer to a @a `gbStats` structure where the
+ *                      statistics will be stored.
+ *
+ * @return  If successful, returns `true`.
+ *          If the core was built without `GB_ENABLE_STATS`, zeroes
+ *          @a `outStats` and quietly returns `false`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists; or if @a `outStats` is `nullptr`, returns `false`.
+ */
+GB_API bool gbGetStats (const gbContext* context, gbStats* outStats);
+
+/**
+ * @brief   Resets the given context's statistics counters to zero.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure whose
+ *                      statistics are to be reset. Pass `nullptr` to use the
+ *                      current context.
+ *
+ * @return  If successful, returns `true`.
+ *          If the core was built without `GB_ENABLE_STATS`, quietly returns
+ *          `false`.
+ *          If no context is provided (i.e., `nullptr`) and no current context
+ *          exists, returns `false`.
+ */
+GB_API bool gbResetStats (gbContext* context);
+
+/**
+ * @brief   Retrieves the region of the memory map containing the given
+ *          address.
+ *
+ * @param   address     The address to be classified.
+ *
+ * @return  The @a `gbBusRegion` containing the address.
+ */
+GB_API gbBusRegion gbGetBusRegion (uint16_t address);
+
+/**
+ * @brief   Retrieves a string representation of the given bus region.
+ *
+ * @param   region      The @a `gbBusRegion` to be stringified.
+ *
+ * @return  A pointer to a null-terminated string naming the region, or `"??"`
+ *          if the region is not recognized.
+ */
+GB_API const char* gbStringifyBusRegion (gbBusRegion region);
+
+#if defined(GB_ENABLE_STATS)
+
+/**
+ * @brief   Retrieves a writable pointer to the given context's statistics
+ *          counters. This is used by @a `gbCountStat`, which may be called from
+ *          the core's read-only paths, and is not meant for frontends.
+ *
+ * @param   context     A pointer to the @a `gbContext` structure. Must not be
+ *                      `nullptr`.
+ *
+ * @return  A pointer to the context's counters.
+ */
+GB_API gbStats* gbGetContextStats (const gbContext* context);
+
+#endif
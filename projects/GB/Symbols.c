@@ -0,0 +1,226 @@
+/**
+ * @file    GB/Symbols.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's symbol
+ *          table.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Symbols.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   Defines the maximum length of a line in an RGBDS `.sym` file.
+ */
+#define GB_SYMBOL_LINE_LENGTH 1024
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding one symbol loaded from a `.sym` file.
+ */
+typedef struct gbSymbol
+{
+    uint16_t    bank;
+    uint16_t    address;
+    char*       name;
+} gbSymbol;
+
+struct gbSymbolTable
+{
+    gbSymbol*   symbols;        // Sorted by bank, then address.
+    size_t      count;
+};
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static int gbCompareSymbols (const void* a, const void* b);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+int gbCompareSymbols (const void* a, const void* b)
+{
+    const gbSymbol* left = a;
+    const gbSymbol* right = b;
+    if (left->bank != right->bank)
+    {
+        return (left->bank < right->bank) ? -1 : 1;
+    }
+    else if (left->address != right->address)
+    {
+        return (left->address < right->address) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/* Public Function Definitions ************************************************/
+
+gbSymbolTable* gbCreateSymbolTable ()
+{
+    gbSymbolTable* symbols = gbCreateZero(1, gbSymbolTable);
+    gbCheckpv(symbols != nullptr, nullptr,
+        "Error allocating memory for 'gbSymbolTable'");
+
+    return symbols;
+}
+
+bool gbDestroySymbolTable (gbSymbolTable* symbols)
+{
+    gbCheckqv(symbols, false);
+
+    gbClearSymbolTable(symbols);
+    gbDestroy(symbols);
+    return true;
+}
+
+bool gbClearSymbolTable (gbSymbolTable* symbols)
+{
+    gbCheckv(symbols != nullptr, false, "No valid 'gbSymbolTable' provided.");
+
+    for (size_t i = 0; i < symbols->count; ++i)
+    {
+        gbDestroy(symbols->symbols[i].name);
+    }
+
+    gbDestroy(symbols->symbols);
+    symbols->count = 0;
+    return true;
+}
+
+bool gbLoadSymbolTable (gbSymbolTable* symbols, const char* filepath)
+{
+    gbCheckv(symbols != nullptr, false, "No valid 'gbSymbolTable' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+
+    FILE* fp = fopen(filepath, "r");
+    gbCheckpv(fp != nullptr, false, "Failed to open symbol file '%s'", filepath);
+
+    gbClearSymbolTable(symbols);
+
+    // - Read each `BANK:ADDRESS NAME` line, skipping comments and anything
+    //   which does not parse.
+    char line[GB_SYMBOL_LINE_LENGTH];
+    size_t capacity = 0;
+    bool result = true;
+    while (fgets(line, sizeof(line), fp) != nullptr)
+    {
+        unsigned int bank = 0, address = 0;
+        int nameOffset = 0;
+        if (
+            line[0] == ';' ||
+            sscanf(line, "%x:%x %n", &bank, &address, &nameOffset) != 2 ||
+            nameOffset == 0 || address > 0xFFFF || bank > 0xFFFF
+        )
+        {
+            continue;
+        }
+
+        char* name = line + nameOffset;
+        name[strcspn(name, " \t\r\n;")] = '\0';
+        if (name[0] == '\0')
+        {
+            continue;
+        }
+
+        if (symbols->count == capacity)
+        {
+            size_t newCapacity = (capacity == 0) ? 256 : capacity * 2;
+            gbSymbol* newSymbols = gbResize(symbols->symbols, newCapacity, gbSymbol);
+            if (newSymbols == nullptr)
+            {
+                gbLogErrno("Error allocating memory for symbols");
+                result = false;
+                break;
+            }
+
+            symbols->symbols = newSymbols;
+            capacity = newCapacity;
+        }
+
+        gbSymbol* symbol = &symbols->symbols[symbols->count];
+        symbol->bank = (address <= GB_ROMX_END) ? (uint16_t) bank : 0;
+        symbol->address = (uint16_t) address;
+        symbol->name = gbCreate(strlen(name) + 1, char);
+        if (symbol->name == nullptr)
+        {
+            gbLogErrno("Error allocating memory for symbol name");
+            result = false;
+            break;
+        }
+
+        strcpy(symbol->name, name);
+        symbols->count++;
+    }
+
+    fclose(fp);
+    if (result == false)
+    {
+        gbClearSymbolTable(symbols);
+        return false;
+    }
+
+    qsort(symbols->symbols, symbols->count, sizeof(gbSymbol), gbCompareSymbols);
+    return true;
+}
+
+size_t gbGetSymbolCount (const gbSymbolTable* symbols)
+{
+    gbCheckqv(symbols, 0);
+    return symbols->count;
+}
+
+const char* gbGetSymbol (const gbSymbolTable* symbols, size_t index,
+    uint16_t* outBank, uint16_t* outAddress)
+{
+    gbCheckqv(symbols != nullptr && index < symbols->count, nullptr);
+
+    const gbSymbol* symbol = &symbols->symbols[index];
+    if (outBank != nullptr) { *outBank = symbol->bank; }
+    if (outAddress != nullptr) { *outAddress = symbol->address; }
+    return symbol->name;
+}
+
+size_t gbFindSymbol (const gbSymbolTable* symbols, uint16_t bank,
+    uint16_t address)
+{
+    gbCheckqv(symbols, GB_SYMBOL_NONE);
+
+    // - Find the last symbol at or before the address, by binary search over
+    //   the symbols sorted by bank, then address.
+    size_t low = 0, high = symbols->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        const gbSymbol* symbol = &symbols->symbols[middle];
+        if (
+            symbol->bank < bank ||
+            (symbol->bank == bank && symbol->address <= address)
+        )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if (low == 0 || symbols->symbols[low - 1].bank != bank)
+    {
+        return GB_SYMBOL_NONE;
+    }
+
+    const gbSymbol* symbol = &symbols->symbols[low - 1];
+    if ((symbol->address <= GB_ROMX_END) != (address <= GB_ROMX_END))
+    {
+        return GB_SYMBOL_NONE;
+    }
+
+    return low - 1;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file    GB/Symbols.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's symbol
+ *          table, which resolves banked addresses to the labels in an RGBDS
+ *          `.sym` file.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Context.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Defines the index returned by @a `gbFindSymbol` when no symbol
+ *          contains the given address.
+ */
+#define GB_SYMBOL_NONE SIZE_MAX
+
+/* Public Types and Forward Declarations **************************************/
+
+/**
+ * @brief   Defines an opaque structure representing a table of symbols,
+ *          sorted by bank, then address.
+ */
+typedef struct gbSymbolTable gbSymbolTable;
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Allocates and creates a new, empty symbol table.
+ *
+ * @return  If successful, returns a pointer to the new @a `gbSymbolTable`.
+ *          If memory allocation fails, returns `nullptr`.
+ */
+GB_API gbSymbolTable* gbCreateSymbolTable ();
+
+/**
+ * @brief   Destroys and deallocates the given symbol table, along with the
+ *          names of its symbols.
+ *
+ * @param   symbols     A pointer to the @a `gbSymbolTable` to be destroyed.
+ *
+ * @return  If successful, returns `true`.
+ *          If the symbol table pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbDestroySymbolTable (gbSymbolTable* symbols);
+
+/**
+ * @brief   Removes every symbol from the given symbol table.
+ *
+ * @param   symbols     A pointer to the @a `gbSymbolTable` to be cleared.
+ *
+ * @return  If successful, returns `true`.
+ *          If the symbol table pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbClearSymbolTable (gbSymbolTable* symbols);
+
+/**
+ * @brief   Loads the symbols from an RGBDS `.sym` file into the given symbol
+ *          table, replacing any loaded before.
+ *
+ * Each line of such a file is either a comment, starting with `;`, or a
+ * `BANK:ADDRESS NAME` triple in hexadecimal. Local labels (`Parent.local`)
+ * are kept as symbols of their own. Only ROM addresses keep their bank; every
+ * other symbol is stored in bank `0`.
+ *
+ * @param   symbols     A pointer to the @a `gbSymbolTable` to be loaded.
+ * @param   filepath    The path of the `.sym` file.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be read, or if memory allocation fails, returns
+ *          `false`, and the table is left empty.
+ */
+GB_API bool gbLoadSymbolTable (gbSymbolTable* symbols, const char* filepath);
+
+/**
+ * @brief   Retrieves the number of symbols in the given symbol table.
+ */
+GB_API size_t gbGetSymbolCount (const gbSymbolTable* symbols);
+
+/**
+ * @brief   Retrieves the symbol at the given index of the given symbol table,
+ *          in order of bank, then address.
+ *
+ * @param   symbols     A pointer to the @a `gbSymbolTable` to be read.
+ * @param   index       The index of the symbol.
+ * @param   outBank     If not `nullptr`, receives the symbol's bank.
+ * @param   outAddress  If not `nullptr`, receives the symbol's address.
+ *
+ * @return  The symbol's name, or `nullptr` if the index is out of range.
+ */
+GB_API const char* gbGetSymbol (const gbSymbolTable* symbols, size_t index,
+    uint16_t* outBank, uint16_t* outAddress);
+
+/**
+ * @brief   Finds the symbol containing the given address: the nearest symbol
+ *          at or before it, in the same bank and the same region of the
+ *          memory map. A ROM label does not contain the RAM after it.
+ *
+ * @param   symbols     A pointer to the @a `gbSymbolTable` to be searched.
+ * @param   bank        The ROM bank of the address, or `0` outside of ROM.
+ * @param   address     The address to be looked up.
+ *
+ * @return  The index of the symbol, or @a `GB_SYMBOL_NONE` if no symbol
+ *          contains the address.
+ */
+GB_API size_t gbFindSymbol (const gbSymbolTable* symbols, uint16_t bank,
+    uint16_t address);
@@ -0,0 +1,270 @@
+/**
+ * @file    GB/Trace.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Core's binary
+ *          execution trace buffer.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GB/Trace.h>
+#include <GB/Internal.h>
+
+/* Private Function Declarations - Helper Functions ***************************/
+
+static size_t gbRoundUpToPowerOfTwo (size_t value);
+
+/* Private Function Definitions - Helper Functions ****************************/
+
+size_t gbRoundUpToPowerOfTwo (size_t value)
+{
+    // - Callers keep the value at or below `GB_TRACE_MAX_CAPACITY`, so the
+    //   result can neither overflow nor loop forever.
+    gbAssert(value <= GB_TRACE_MAX_CAPACITY);
+
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+/* Public Function Definitions ************************************************/
+
+gbTrace* gbCreateTrace (size_t capacity, uint8_t flags)
+{
+    gbCheckv(capacity > 0, nullptr, "Trace buffer capacity must not be zero.");
+    gbCheckv(capacity <= GB_TRACE_MAX_CAPACITY, nullptr,
+        "Trace buffer capacity %zu is greater than the maximum of %zu.",
+        capacity, GB_TRACE_MAX_CAPACITY);
+
+    gbTrace* trace = gbCreateZero(1, gbTrace);
+    gbCheckpv(trace != nullptr, nullptr, "Error allocating memory for 'gbTrace'");
+
+    // - Round the capacity up to a power of two, so that the write position
+    //   can be found with a mask instead of a division.
+    trace->capacity = gbRoundUpToPowerOfTwo(capacity);
+    trace->mask = trace->capacity - 1;
+    trace->flags = flags;
+
+    // - Preallocate the record storage up front; recording never allocates.
+    trace->records = gbCreateZero(trace->capacity, gbTraceRecord);
+    if (trace->records == nullptr)
+    {
+        gbLogErrno("Error allocating memory for %zu trace records",
+            trace->capacity);
+        gbDestroyTrace(trace);
+        return nullptr;
+    }
+
+    return trace;
+}
+
+gbTrace* gbLoadTrace (const char* filepath)
+{
+    gbCheckv(filepath != nullptr, nullptr, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', nullptr, "File path string is blank.");
+
+    // - Attempt to open the specified file.
+    FILE* fp = fopen(filepath, "rb");
+    gbCheckpv(fp != nullptr, nullptr, "Failed to open trace file '%s' for reading",
+        filepath);
+
+    // - Read and validate the file header.
+    gbTraceFileHeader header = { 0 };
+    if (fread(&header, sizeof(header), 1, fp) != 1)
+    {
+        gbLogError("Trace file '%s' is too small to contain a header.", filepath);
+        fclose(fp);
+        return nullptr;
+    }
+
+    if (
+        memcmp(header.magic, GB_TRACE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != GB_TRACE_VERSION ||
+        header.recordSize != sizeof(gbTraceRecord)
+    )
+    {
+        gbLogError("File '%s' is not a supported trace file.", filepath);
+        fclose(fp);
+        return nullptr;
+    }
+
+    // - Check the record count against what the file actually holds before
+    //   allocating storage for it.
+    long headerEnd = ftell(fp);
+    long fileEnd = (fseek(fp, 0, SEEK_END) == 0) ? ftell(fp) : -1;
+    if (headerEnd < 0 || fileEnd < headerEnd || fseek(fp, headerEnd, SEEK_SET) != 0)
+    {
+        gbLogErrno("Error finding the size of trace file '%s'", filepath);
+        fclose(fp);
+        return nullptr;
+    }
+
+    uint64_t recordsHeld = (uint64_t) (fileEnd - headerEnd) / sizeof(gbTraceRecord);
+    if (header.recordCount > recordsHeld)
+    {
+        gbLogError("Trace file '%s' is truncated: expected %llu records, got %llu.",
+            filepath, (unsigned long long) header.recordCount,
+            (unsigned long long) recordsHeld);
+        fclose(fp);
+        return nullptr;
+    }
+    else if (header.recordCount > GB_TRACE_MAX_CAPACITY)
+    {
+        gbLogError("Trace file '%s' holds %llu records; at most %zu can be loaded.",
+            filepath, (unsigned long long) header.recordCount,
+            GB_TRACE_MAX_CAPACITY);
+        fclose(fp);
+        return nullptr;
+    }
+
+    // - Create a trace buffer large enough to hold every record in the file.
+    gbTrace* trace = gbCreateTrace(
+        (header.recordCount > 0) ? (size_t) header.recordCount : 1,
+        header.flags);
+    if (trace == nullptr)
+    {
+        fclose(fp);
+        return nullptr;
+    }
+
+    // - Read the records, which are stored oldest-first, straight into place.
+    size_t recordsRead = fread(trace->records, sizeof(gbTraceRecord),
+        (size_t) header.recordCount, fp);
+    fclose(fp);
+    if (recordsRead != header.recordCount)
+    {
+        gbLogError("Trace file '%s' is truncated: expected %llu records, got %zu.",
+            filepath, (unsigned long long) header.recordCount, recordsRead);
+        gbDestroyTrace(trace);
+        return nullptr;
+    }
+
+    // - Carry over the number of records dropped before the dump was written,
+    //   so that the loaded trace reports the same figures as the saved one.
+    trace->totalPushed = header.recordCount;
+    trace->droppedBeforeLoad = header.droppedCount;
+
+    return trace;
+}
+
+bool gbDestroyTrace (gbTrace* trace)
+{
+    gbCheckqv(trace, false);
+    gbDestroy(trace->records);
+    gbDestroy(trace);
+    return true;
+}
+
+bool gbClearTrace (gbTrace* trace)
+{
+    gbCheckv(trace != nullptr, false, "No valid 'gbTrace' provided.");
+
+    trace->totalPushed = 0;
+    trace->droppedBeforeLoad = 0;
+    return true;
+}
+
+/* Public Function Definitions - Recording ************************************/
+
+bool gbCheckTraceFlag (const gbTrace* trace, gbTraceFlags flag)
+{
+    return (trace != nullptr) && ((trace->flags & flag) == flag);
+}
+
+bool gbPushTraceRecord (gbTrace* trace, const gbTraceRecord* record)
+{
+    gbCheckqv(trace != nullptr && record != nullptr, false);
+
+    gbAppendTraceRecord(trace, record);
+    return true;
+}
+
+/* Public Function Definitions - Inspection ***********************************/
+
+size_t gbGetTraceRecordCount (const gbTrace* trace)
+{
+    gbCheckqv(trace, 0);
+
+    return (trace->totalPushed < trace->capacity) ?
+        (size_t) trace->totalPushed : trace->capacity;
+}
+
+uint64_t gbGetTraceDroppedCount (const gbTrace* trace)
+{
+    gbCheckqv(trace, 0);
+
+    return trace->droppedBeforeLoad + ((trace->totalPushed > trace->capacity) ?
+        trace->totalPushed - trace->capacity : 0);
+}
+
+bool gbReadTraceRecord (const gbTrace* trace, size_t index,
+    gbTraceRecord* outRecord)
+{
+    gbCheckv(trace != nullptr, false, "No valid 'gbTrace' provided.");
+    gbCheckv(outRecord != nullptr, false, "No valid output pointer provided.");
+
+    size_t count = gbGetTraceRecordCount(trace);
+    gbCheckv(index < count, false,
+        "Trace record index %zu is out of range (%zu records).", index, count);
+
+    // - The oldest record lives right after the newest one, once the buffer
+    //   has wrapped around; before that, it lives in slot `0`.
+    uint64_t oldest = trace->totalPushed - count;
+    *outRecord = trace->records[(oldest + index) & trace->mask];
+    return true;
+}
+
+bool gbSaveTrace (const gbTrace* trace, const char* filepath)
+{
+    gbCheckv(trace != nullptr, false, "No valid 'gbTrace' provided.");
+    gbCheckv(filepath != nullptr, false, "File path string is null.");
+    gbCheckv(filepath[0] != '\0', false, "File path string is blank.");
+
+    // - Attempt to open the specified file.
+    FILE* fp = fopen(filepath, "wb");
+    gbCheckpv(fp != nullptr, false, "Failed to open trace file '%s' for writing",
+        filepath);
+
+    // - Write the file header.
+    size_t count = gbGetTraceRecordCount(trace);
+    gbTraceFileHeader header = { 0 };
+    memcpy(header.magic, GB_TRACE_MAGIC, sizeof(header.magic));
+    header.version = GB_TRACE_VERSION;
+    header.recordSize = sizeof(gbTraceRecord);
+    header.flags = trace->flags;
+    header.recordCount = count;
+    header.droppedCount = gbGetTraceDroppedCount(trace);
+    if (fwrite(&header, sizeof(header), 1, fp) != 1)
+    {
+        gbLogErrno("Error writing header to trace file '%s'", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    // - Write the records, oldest first. Once the buffer has wrapped around,
+    //   this takes two contiguous writes: from the oldest record to the end of
+    //   the storage, then from the start of the storage to the newest record.
+    size_t start = (size_t) ((trace->totalPushed - count) & trace->mask);
+    size_t firstSpan = (start + count > trace->capacity) ?
+        trace->capacity - start : count;
+    size_t secondSpan = count - firstSpan;
+    if (
+        fwrite(trace->records + start, sizeof(gbTraceRecord), firstSpan, fp) != firstSpan ||
+        fwrite(trace->records, sizeof(gbTraceRecord), secondSpan, fp) != secondSpan
+    )
+    {
+        gbLogErrno("Error writing records to trace file '%s'", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    // - Close the file.
+    fclose(fp);
+    return true;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file    GB/Trace.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the Game Boy Emulator Core's binary
+ *          execution trace buffer.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/Context.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Defines the four-character magic string found at the start of a
+ *          binary trace dump file.
+ */
+#define GB_TRACE_MAGIC "GBTR"
+
+/**
+ * @brief   Defines the version number of the binary trace dump file format.
+ */
+#define GB_TRACE_VERSION 1
+
+/**
+ * @brief   Defines the largest number of records a trace buffer can hold: 2^28,
+ *          or a few gigabytes of records.
+ */
+#define GB_TRACE_MAX_CAPACITY ((size_t) 1 << 28)
+
+/**
+ * @brief   Enumerates the kinds of records which can be stored in a trace
+ *          buffer.
+ */
+typedef enum gbTraceRecordType : uint8_t
+{
+    GB_TRT_INSTRUCTION  = 0x00, /** @brief An instruction was fetched and executed. */
+    GB_TRT_BUS_READ     = 0x01, /** @brief A byte was read from the address bus. */
+    GB_TRT_BUS_WRITE    = 0x02  /** @brief A byte was written to the address bus. */
+} gbTraceRecordType;
+
+/**
+ * @brief   Enumerates flags controlling which events are recorded into a
+ *          trace buffer.
+ */
+typedef enum gbTraceFlags : uint8_t
+{
+    GB_TF_NONE          = 0x00, /** @brief Record executed instructions only. */
+    GB_TF_BUS_ACCESSES  = 0x01  /** @brief Also record every bus read and write. */
+} gbTraceFlags;
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure representing a single, fixed-size record
+ *          stored in a trace buffer.
+ *
+ * The layout of this structure is also the on-disk layout of each record in a
+ * binary trace dump file, so its size must remain exactly 24 bytes.
+ */
+typedef struct gbTraceRecord
+{
+    uint64_t    cycle;          /** @brief T-cycles consumed by the processor when the event occurred. */
+    uint16_t    address;        /** @brief Instruction: the opcode's address. Bus access: the accessed address. */
+    uint16_t    opcode;         /** @brief Instruction: the (prefixed) opcode. Bus access: the byte read or written. */
+    uint16_t    bank;           /** @brief The cartridge ROM bank mapped at @a `address`, or `0` if not ROM. */
+    uint16_t    stackPointer;   /** @brief The `SP` register, as of the start of the instruction. */
+    uint8_t     accumulator;    /** @brief The `A` register, as of the start of the instruction. */
+    uint8_t     flags;          /** @brief The `F` register, as of the start of the instruction. */
+    uint8_t     type;           /** @brief The kind of record; see @a `gbTraceRecordType`. */
+    uint8_t     reserved[5];    /** @brief Reserved; always zero. */
+} gbTraceRecord;
+
+/**
+ * @brief   Defines a structure representing the header found at the start of
+ *          a binary trace dump file. The header is immediately followed by
+ *          @a `recordCount` @a `gbTraceRecord` structures, oldest first.
+ *
+ * @note    All fields are stored in the byte order of the machine which wrote
+ *          the dump file.
+ */
+typedef struct gbTraceFileHeader
+{
+    char        magic[4];       /** @brief Magic string; see @a `GB_TRACE_MAGIC`. */
+    uint16_t    version;        /** @brief File format version; see @a `GB_TRACE_VERSION`. */
+    uint16_t    recordSize;     /** @brief Size of each record, in bytes. */
+    uint8_t     flags;          /** @brief The @a `gbTraceFlags` the trace was recorded with. */
+    uint8_t     reserved[7];    /** @brief Reserved; always zero. */
+    uint64_t    recordCount;    /** @brief Number of records following this header. */
+    uint64_t    droppedCount;   /** @brief Number of older records overwritten before the dump. */
+} gbTraceFileHeader;
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Allocates and creates a new trace buffer.
+ *
+ * @param   capacity    The number of records the buffer can hold before it
+ *                      begins overwriting its oldest records. This number is
+ *                      rounded up to the next power of two. Must not be `0`,
+ *                      nor greater than @a `GB_TRACE_MAX_CAPACITY`.
+ * @param   flags       A bitwise combination of @a `gbTraceFlags` values
+ *                      controlling which events are recorded.
+ *
+ * @return  If successful, returns a pointer to the newly created @a `gbTrace`.
+ *          If allocation fails, or @a `capacity` is out of range, returns
+ *          `nullptr`.
+ */
+GB_API gbTrace* gbCreateTrace (size_t capacity, uint8_t flags);
+
+/**
+ * @brief   Loads a trace buffer from a binary trace dump file previously
+ *          written by @a `gbSaveTrace`.
+ *
+ * @param   filepath    A pointer to a null-terminated string containing the
+ *                      path to the dump file to be loaded. Must not be
+ *                      `nullptr`, and also must not be an empty string.
+ *
+ * @return  If successful, returns a pointer to a newly created @a `gbTrace`
+ *          containing the records found in the file.
+ *          If loading fails (e.g., file not found, invalid format, more records
+ *          than the file holds or a trace buffer can, allocation failure,
+ *          etc.), returns `nullptr`.
+ */
+GB_API gbTrace* gbLoadTrace (const char* filepath);
+
+/**
+ * @brief   Destroys and deallocates a trace buffer.
+ *
+ * @param   trace   A pointer to the @a `gbTrace` structure to be destroyed.
+ *                  Must not be `nullptr`, and should not be attached to any
+ *                  context.
+ *
+ * @return  If successful, returns `true`.
+ *          If no trace buffer is provided (i.e., `nullptr`), returns `false`.
+ */
+GB_API bool gbDestroyTrace (gbTrace* trace);
+
+/**
+ * @brief   Discards all records currently stored in a trace buffer.
+ *
+ * @param   trace   A pointer to the @a `gbTrace` structure to be cleared.
+ *                  Must not be `nullptr`.
+ *
+ * @return  If successful, returns `true`.
+ *          If no trace buffer is provided (i.e., `nullptr`), returns `false`.
+ */
+GB_API bool gbClearTrace (gbTrace* trace);
+
+/* Public Function Declarations - Recording ***********************************/
+
+/**
+ * @brief   Checks whether the given trace buffer records the given kind of
+ *          event.
+ *
+ * @param   trace       A pointer to the @a `gbTrace` structure to be checked.
+ * @param   flag        The @a `gbTraceFlags` value to check for.
+ *
+ * @return  If the trace buffer exists and was created with @a `flag`, returns
+ *          `true`. Otherwise, returns `false`.
+ */
+GB_API bool gbCheckTraceFlag (const gbTrace* trace, gbTraceFlags flag);
+
+/**
+ * @brief   Appends a record to the given trace buffer, overwriting its oldest
+ *          record if the buffer is full.
+ *
+ * This function is called by the core's components as they execute. External
+ * code may also call it to inject custom marker records into a trace.
+ *
+ * @param   trace       A pointer to the @a `gbTrace` structure to which to
+ *                      append the record. Must not be `nullptr`.
+ * @param   record      A pointer to the @a `gbTraceRecord` to be copied into
+ *                      the buffer. Must not be `nullptr`.
+ *
+ * @return  If successful, returns `true`.
+ *          If either pointer is `nullptr`, returns `false`.
+ */
+GB_API bool gbPushTraceRecord (gbTrace* trace, const gbTraceRecord* record);
+
+/* Public Function Declarations - Inspection **********************************/
+
+/**
+ * @brief   Retrieves the number of records currently stored in the given trace
+ *          buffer.
+ *
+ * @param   trace   A pointer to the @a `gbTrace` structure to be inspected.
+ *
+ * @return  The number of records currently stored, or `0` if no trace buffer
+ *          is provided (i.e., `nullptr`).
+ */
+GB_API size_t gbGetTraceRecordCount (const gbTrace* trace);
+
+/**
+ * @brief   Retrieves the number of records which were overwritten by newer
+ *          records since the given trace buffer was created or last cleared.
+ *
+ * @param   trace   A pointer to the @a `gbTrace` structure to be inspected.
+ *
+ * @return  The number of dropped records, or `0` if no trace buffer is
+ *          provided (i.e., `nullptr`).
+ */
+GB_API uint64_t gbGetTraceDroppedCount (const gbTrace* trace);
+
+/**
+ * @brief   Retrieves a record stored in the given trace buffer.
+ *
+ * @param   trace       A pointer to the @a `gbTrace` structure to be inspected.
+ *                      Must not be `nullptr`.
+ * @param   index       The index of the record to retrieve, where `0` is the
+ *                      oldest record still stored in the buffer. Must be less
+ *                      than the value returned by @a `gbGetTraceRecordCount`.
+ * @param   outRecord   A pointer to a @a `gbTraceRecord` structure where the
+ *                      record will be copied. Must not be `nullptr`.
+ *
+ * @return  If successful, returns `true`.
+ *          If the index is out of range, or either pointer is `nullptr`,
+ *          returns `false`.
+ */
+GB_API bool gbReadTraceRecord (const gbTrace* trace, size_t index,
+    gbTraceRecord* outRecord);
+
+/**
+ * @brief   Writes the records stored in the given trace buffer to a binary
+ *          trace dump file, oldest record first.
+ *
+ * @param   trace       A pointer to the @a `gbTrace` structure to be saved.
+ *                      Must not be `nullptr`.
+ * @param   filepath    A pointer to a null-terminated string containing the
+ *                      path to the dump file to be written. Must not be
+ *                      `nullptr`, and also must not be an empty string.
+ *
+ * @return  If successful, returns `true`.
+ *          If saving fails (e.g., file write error, null pointers, etc.),
+ *          returns `false`.
+ */
+GB_API bool gbSaveTrace (const gbTrace* trace, const char* filepath);
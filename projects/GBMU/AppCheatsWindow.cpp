@@ -0,0 +1,125 @@
+/**
+ * @file    GBMU/AppCheatsWindow.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Frontend application
+ *          class's cheat code window methods.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <imgui_stdlib.h>
+#include <GBMU/Application.hpp>
+
+/* Public Methods - ImGui Cheats Window ***************************************/
+
+namespace gbmu
+{
+
+    auto Application::showCheatsWindow () -> void
+    {
+        if (!m_showCheatsWindow)
+        {
+            return;
+        }
+
+        ImGui::Begin("Cheats", &m_showCheatsWindow);
+        {
+            // - Add a code by pressing Enter or the button.
+            ImGui::SetNextItemWidth(-ImGui::CalcTextSize("Add").x -
+                ImGui::GetStyle().ItemSpacing.x - ImGui::GetStyle().FramePadding.x * 2.0f);
+            bool add = ImGui::InputTextWithHint("##Code",
+                "Game Genie (ABC-DEF-GHI) or GameShark (01VVLLHH)", &m_cheatInput,
+                ImGuiInputTextFlags_EnterReturnsTrue);
+            ImGui::SameLine();
+            add |= ImGui::Button("Add");
+            if (add && !m_cheatInput.empty())
+            {
+                m_cheatError = !gbAddCheat(m_gb, m_cheatInput.c_str());
+                if (!m_cheatError)
+                {
+                    m_cheatInput.clear();
+                }
+            }
+
+            if (m_cheatError)
+            {
+                ImGui::TextColored(ImVec4 { 1.0f, 0.5f, 0.5f, 1.0f },
+                    "Not a valid Game Genie or GameShark code.");
+            }
+
+            // - List the codes, each with a checkbox to enable it and a button
+            //   to remove it.
+            std::size_t removeIndex = SIZE_MAX;
+            if (ImGui::BeginTable("##Cheats", 4,
+                ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+            {
+                ImGui::TableSetupColumn("On", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableSetupColumn("Code");
+                ImGui::TableSetupColumn("Effect");
+                ImGui::TableSetupColumn("##Remove", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableHeadersRow();
+
+                const auto count = gbGetCheatCount(m_gb);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const gbCheat* cheat = gbGetCheat(m_gb, i);
+                    ImGui::PushID(static_cast<int>(i));
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    bool enabled = cheat->enabled;
+                    if (ImGui::Checkbox("##Enabled", &enabled))
+                    {
+                        gbSetCheatEnabled(m_gb, i, enabled);
+                    }
+
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(cheat->code);
+
+                    ImGui::TableNextColumn();
+                    if (cheat->format == GB_CF_GAME_GENIE && cheat->hasCompare)
+                    {
+                        ImGui::Text("ROM $%04X: $%02X -> $%02X", cheat->address,
+                            cheat->compare, cheat->value);
+                    }
+                    else if (cheat->format == GB_CF_GAME_GENIE)
+                    {
+                        ImGui::Text("ROM $%04X -> $%02X", cheat->address,
+                            cheat->value);
+                    }
+                    else if (cheat->bank != 0)
+                    {
+                        ImGui::Text("RAM %u:$%04X = $%02X each frame", cheat->bank,
+                            cheat->address, cheat->value);
+                    }
+                    else
+                    {
+                        ImGui::Text("RAM $%04X = $%02X each frame", cheat->address,
+                            cheat->value);
+                    }
+
+                    ImGui::TableNextColumn();
+                    if (ImGui::SmallButton("Remove"))
+                    {
+                        removeIndex = i;
+                    }
+
+                    ImGui::PopID();
+                }
+
+                ImGui::EndTable();
+            }
+
+            if (removeIndex != SIZE_MAX)
+            {
+                gbRemoveCheat(m_gb, removeIndex);
+            }
+        }
+        ImGui::End();
+    }
+
+}
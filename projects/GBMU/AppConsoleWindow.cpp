@@ -9,6 +9,7 @@
 
 /* Private Includes ***********************************************************/
 
+#include <algorithm>
 #include <imgui.h>
 #include <imgui_internal.h>
 #include <GBMU/Application.hpp>
@@ -28,12 +29,37 @@ namespace gbmu
         // - Window Flags
         auto windowFlags = ImGuiWindowFlags_None;
 
-        // - Prepare Window
-        
-
         // - Begin Window
         ImGui::Begin("Console Output", &m_showConsoleWindow, windowFlags);
         {
+            // - Severity filters, and the log file.
+            ImGui::Checkbox("Info", &m_consoleSeverities[0]);
+            ImGui::SameLine();
+            ImGui::Checkbox("Warnings", &m_consoleSeverities[1]);
+            ImGui::SameLine();
+            ImGui::Checkbox("Errors", &m_consoleSeverities[2]);
+            ImGui::SameLine();
+            if (ImGui::Button("Clear"))
+            {
+                m_consoleFirst = m_console.getEnd();
+            }
+            ImGui::SameLine();
+            bool spill = m_consoleSpill.is_open();
+            if (ImGui::Checkbox("Write to Log File", &spill))
+            {
+                if (spill)
+                {
+                    // - Start with the lines the window still holds.
+                    m_consoleSpill.open(CONSOLE_LOG_PATH, std::ios::app);
+                    m_consoleSpilled = m_console.getFirst();
+                }
+                else
+                {
+                    m_consoleSpill.close();
+                }
+            }
+            ImGui::SetItemTooltip("%s", CONSOLE_LOG_PATH);
+
             // - Create scrollable region with horizontal scrollbar support.
             ImGui::BeginChild(
                 "ConsoleScrolling",
@@ -42,9 +68,61 @@ namespace gbmu
                 ImGuiWindowFlags_HorizontalScrollbar
             );
 
-            // - Display the console buffer contents.
-            std::string consoleText = m_consoleBuffer.str();
-            ImGui::TextUnformatted(consoleText.c_str());
+            // - Collect the lines which pass the filters; their severities are
+            //   all that is read of the lines out of view. With no filter,
+            //   lines are numbered straight from the log.
+            const auto end = m_console.getEnd();
+            const auto first = std::max(m_console.getFirst(), m_consoleFirst);
+            const bool filtered = !m_consoleSeverities[0] ||
+                !m_consoleSeverities[1] || !m_consoleSeverities[2];
+            m_consoleRows.clear();
+            for (auto sequence = first; filtered && sequence < end; ++sequence)
+            {
+                ConsoleSeverity severity = ConsoleSeverity::Info;
+                if (m_console.getSeverity(sequence, severity) &&
+                    m_consoleSeverities[static_cast<std::size_t>(severity)])
+                {
+                    m_consoleRows.push_back(sequence);
+                }
+            }
+
+            // - Only the visible lines are read and drawn.
+            const auto rowCount = filtered ?
+                m_consoleRows.size() : static_cast<std::size_t>(end - first);
+            std::string line;
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(rowCount));
+            while (clipper.Step())
+            {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+                {
+                    const auto sequence = filtered ?
+                        m_consoleRows[row] : first + static_cast<std::uint64_t>(row);
+                    ConsoleSeverity severity = ConsoleSeverity::Info;
+                    if (!m_console.getSeverity(sequence, severity) ||
+                        !m_console.read(sequence, line))
+                    {
+                        ImGui::NewLine();
+                        continue;
+                    }
+
+                    switch (severity)
+                    {
+                        case ConsoleSeverity::Warning:
+                            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4 { 1.0f, 0.85f, 0.4f, 1.0f });
+                            break;
+                        case ConsoleSeverity::Error:
+                            ImGui::PushStyleColor(ImGuiCol_Text, ImVec4 { 1.0f, 0.5f, 0.5f, 1.0f });
+                            break;
+                        default:
+                            ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_Text));
+                            break;
+                    }
+
+                    ImGui::TextUnformatted(line.data(), line.data() + line.size());
+                    ImGui::PopStyleColor();
+                }
+            }
 
             // - Auto-scroll to bottom when new content is added.
             if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
@@ -57,4 +135,33 @@ namespace gbmu
         ImGui::End();
     }
 
+    auto Application::spillConsoleLog () -> void
+    {
+        if (!m_consoleSpill.is_open())
+        {
+            return;
+        }
+
+        // - Lines overwritten before they could be written are counted, not
+        //   silently skipped. A line still being written waits for the next
+        //   frame.
+        const auto end = m_console.getEnd();
+        const auto first = m_console.getFirst();
+        if (m_consoleSpilled < first)
+        {
+            m_consoleSpill << "[GBMU] [WARN] " << (first - m_consoleSpilled)
+                << " console lines were lost before they could be written.\n";
+            m_consoleSpilled = first;
+        }
+
+        std::string line;
+        while (m_consoleSpilled < end && m_console.read(m_consoleSpilled, line))
+        {
+            m_consoleSpill << line << '\n';
+            m_consoleSpilled++;
+        }
+
+        m_consoleSpill.flush();
+    }
+
 }
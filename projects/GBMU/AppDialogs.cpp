@@ -34,4 +34,98 @@ namespace gbmu
         }
     }
 
+    auto Application::showOpenPatchedCartridgeDialog () -> void
+    {
+        auto romResult = pfd::open_file {
+            "Open Cartridge ROM",
+            std::filesystem::current_path().string(),
+            {
+                "Game Boy ROM Image Files (*.gb, *.gbc)", "*.gb *.gbc",
+                "All Files", "*"
+            }
+        }.result();
+
+        if (romResult.empty())
+        {
+            return;
+        }
+
+        // - The patches are applied in the order they are selected.
+        auto patchResult = pfd::open_file {
+            "Select Patches",
+            std::filesystem::path { romResult.front() }.parent_path().string(),
+            {
+                "ROM Patch Files (*.ips, *.ups, *.bps)", "*.ips *.ups *.bps",
+                "All Files", "*"
+            },
+            pfd::opt::multiselect
+        }.result();
+
+        if (!patchResult.empty())
+        {
+            loadCartridge(romResult.front(), patchResult);
+        }
+    }
+
+    auto Application::showLoadSymbolsDialog () -> void
+    {
+        auto result = pfd::open_file {
+            "Load RGBDS Symbols",
+            std::filesystem::current_path().string(),
+            {
+                "RGBDS Symbol Files (*.sym)", "*.sym",
+                "All Files", "*"
+            }
+        }.result();
+
+        if (!result.empty() && !gbLoadProfilerSymbols(m_profiler, result.front().c_str()))
+        {
+            pfd::message(
+                "Error Loading Symbols",
+                std::format("Could not load symbols from file '{}'.", result.front()),
+                pfd::choice::ok,
+                pfd::icon::error
+            );
+        }
+    }
+
+    auto Application::showExportFoldedStacksDialog () -> void
+    {
+        auto result = pfd::save_file {
+            "Export Folded Stacks",
+            std::filesystem::current_path().string(),
+            {
+                "Folded Stack Files (*.folded)", "*.folded",
+                "All Files", "*"
+            }
+        }.result();
+
+        if (!result.empty() && !gbSaveProfilerFoldedStacks(m_profiler, result.c_str()))
+        {
+            pfd::message(
+                "Error Exporting Profile",
+                std::format("Could not write folded stacks to file '{}'.", result),
+                pfd::choice::ok,
+                pfd::icon::error
+            );
+        }
+
+        // - Exporting rebuilds the report grouped by symbol.
+        m_profilerGroupBySymbol = true;
+    }
+
+    auto Application::showSelectLibraryFolderDialog () -> void
+    {
+        auto result = pfd::select_folder {
+            "Select ROM Library Folder",
+            m_libraryRoot.empty() ?
+                std::filesystem::current_path().string() : m_libraryRoot
+        }.result();
+
+        if (!result.empty())
+        {
+            startLibraryScan(result, false);
+        }
+    }
+
 }
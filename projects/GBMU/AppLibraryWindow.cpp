@@ -0,0 +1,295 @@
+/**
+ * @file    GBMU/AppLibraryWindow.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Frontend application
+ *          class's ROM library window methods.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <imgui_stdlib.h>
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <GBMU/Application.hpp>
+
+/* Private Functions **********************************************************/
+
+namespace gbmu
+{
+
+    /**
+     * @brief   Checks whether one string contains another, ignoring case.
+     */
+    static auto containsIgnoringCase (std::string_view text,
+        std::string_view search) -> bool
+    {
+        return std::search(text.begin(), text.end(), search.begin(), search.end(),
+            [] (char a, char b)
+            {
+                return std::tolower(static_cast<unsigned char>(a)) ==
+                    std::tolower(static_cast<unsigned char>(b));
+            }) != text.end();
+    }
+
+    /**
+     * @brief   Lists the ROM files (`.gb` and `.gbc`) beneath a directory,
+     *          recursively; or, if the path names a file, that file alone.
+     */
+    static auto listLibraryFiles (const std::string& rootPath)
+        -> std::vector<std::string>
+    {
+        namespace fs = std::filesystem;
+
+        std::vector<std::string> paths;
+        std::error_code error;
+        if (fs::is_regular_file(rootPath, error))
+        {
+            paths.push_back(rootPath);
+            return paths;
+        }
+
+        // - Unreadable directories are skipped, rather than ending the scan.
+        auto it = fs::recursive_directory_iterator { rootPath,
+            fs::directory_options::skip_permission_denied, error };
+        for (; !error && it != fs::recursive_directory_iterator {};
+            it.increment(error))
+        {
+            std::string extension = it->path().extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(),
+                [] (unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            if (
+                (extension == ".gb" || extension == ".gbc") &&
+                it->is_regular_file(error)
+            )
+            {
+                paths.push_back(it->path().string());
+            }
+        }
+
+        return paths;
+    }
+
+}
+
+/* Public Methods - ImGui Library Window **************************************/
+
+namespace gbmu
+{
+
+    auto Application::showLibraryWindow () -> void
+    {
+        // - Collect a finished scan even while the window is closed, so that
+        //   its index is saved.
+        if (!m_libraryScanning && m_libraryThread.joinable())
+        {
+            m_libraryThread.join();
+            gbSaveLibraryIndex(m_library, LIBRARY_INDEX_PATH);
+            filterLibrary();
+        }
+
+        if (!m_showLibraryWindow)
+        {
+            return;
+        }
+
+        ImGui::Begin("Library", &m_showLibraryWindow);
+        {
+            // - The library's entries are replaced when a scan ends, so they
+            //   are not shown until then.
+            if (m_libraryScanning)
+            {
+                std::size_t done = 0, total = 0;
+                gbGetLibraryProgress(m_library, &done, &total);
+                ImGui::Text("Scanning '%s'...", m_libraryRoot.c_str());
+                ImGui::ProgressBar(
+                    (total > 0) ? static_cast<float>(done) / total : 0.0f,
+                    ImVec2 { -1.0f, 0.0f },
+                    std::format("{} / {}", done, total).c_str());
+                ImGui::End();
+                return;
+            }
+
+            if (ImGui::Button("Scan Folder..."))
+            {
+                showSelectLibraryFolderDialog();
+            }
+
+            ImGui::SameLine();
+            ImGui::BeginDisabled(m_libraryRoot.empty());
+            if (ImGui::Button("Rescan"))
+            {
+                startLibraryScan(m_libraryRoot, false);
+            }
+
+            ImGui::SameLine();
+            if (ImGui::Button("Verify"))
+            {
+                startLibraryScan(m_libraryRoot, true);
+            }
+            ImGui::SetItemTooltip("Also reads each whole ROM, to check its global checksum.");
+            ImGui::EndDisabled();
+
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(-1.0f);
+            if (ImGui::InputTextWithHint("##Search", "Search titles and paths",
+                &m_librarySearch))
+            {
+                filterLibrary();
+            }
+
+            ImGui::Text("%zu of %zu ROMs.", m_libraryMatches.size(),
+                gbGetLibraryEntryCount(m_library));
+
+            // - Only the visible rows are drawn, so that a library of tens of
+            //   thousands of ROMs costs no more than a short one.
+            if (ImGui::BeginTable("LibraryEntries", 5,
+                ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable))
+            {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("Title");
+                ImGui::TableSetupColumn("CGB");
+                ImGui::TableSetupColumn("Type");
+                ImGui::TableSetupColumn("ROM");
+                ImGui::TableSetupColumn("Path", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableHeadersRow();
+
+                std::string openPath;
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(m_libraryMatches.size()));
+                while (clipper.Step())
+                {
+                    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+                    {
+                        const gbLibraryEntry* entry =
+                            gbGetLibraryEntry(m_library, m_libraryMatches[row]);
+                        gbCartridgeHeader header {};
+                        header.cartridgeType = entry->cartridgeType;
+
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::PushID(row);
+                        if (ImGui::Selectable(entry->title, false,
+                            ImGuiSelectableFlags_SpanAllColumns |
+                            ImGuiSelectableFlags_AllowDoubleClick) &&
+                            ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+                        {
+                            openPath = entry->path;
+                        }
+                        ImGui::PopID();
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(
+                            (entry->cgbFlag == 0xC0) ? "Only" :
+                            (entry->cgbFlag == 0x80) ? "Yes" : "");
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(entry->hasHeader ?
+                            gbStringifyCartridgeType(&header) : "");
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%llu KiB",
+                            static_cast<unsigned long long>(entry->fileSize / 1024));
+                        ImGui::TableNextColumn();
+                        if (entry->hasHeader && !entry->headerValid)
+                        {
+                            ImGui::TextColored(ImVec4 { 1.0f, 0.5f, 0.5f, 1.0f },
+                                "%s (bad header)", entry->path);
+                        }
+                        else
+                        {
+                            ImGui::TextUnformatted(entry->path);
+                        }
+                    }
+                }
+
+                ImGui::EndTable();
+
+                // - Double-click a row to open it.
+                if (!openPath.empty())
+                {
+                    loadCartridge(openPath);
+                }
+            }
+        }
+        ImGui::End();
+    }
+
+    auto Application::startLibraryScan (const std::string& rootPath,
+        bool verify) -> void
+    {
+        if (m_libraryScanning || m_libraryThread.joinable())
+        {
+            return;
+        }
+
+        // - The scan runs on its own thread, and its own pool beneath that, so
+        //   emulation carries on meanwhile.
+        m_libraryRoot = rootPath;
+        m_libraryScanning = true;
+        m_libraryThread = std::thread {
+            [this, verify]
+            {
+                const auto files = listLibraryFiles(m_libraryRoot);
+                std::vector<const char*> paths;
+                paths.reserve(files.size());
+                for (const auto& file : files)
+                {
+                    paths.push_back(file.c_str());
+                }
+
+                if (gbBeginLibraryScan(m_library, paths.data(), paths.size(),
+                    verify ? GB_LS_VERIFY : GB_LS_NONE))
+                {
+                    std::atomic<std::size_t> nextJob { 0 };
+                    std::vector<std::thread> workers;
+                    const unsigned workerCount =
+                        std::max(1u, std::thread::hardware_concurrency());
+                    for (unsigned i = 0; i < workerCount; ++i)
+                    {
+                        workers.emplace_back([this, &nextJob, &paths]
+                        {
+                            for (std::size_t job = nextJob++; job < paths.size();
+                                job = nextJob++)
+                            {
+                                gbRunLibraryScanJob(m_library, job);
+                            }
+                        });
+                    }
+
+                    for (auto& worker : workers)
+                    {
+                        worker.join();
+                    }
+
+                    gbEndLibraryScan(m_library);
+                }
+
+                m_libraryScanning = false;
+            }
+        };
+    }
+
+    auto Application::filterLibrary () -> void
+    {
+        m_libraryMatches.clear();
+
+        const std::size_t count = gbGetLibraryEntryCount(m_library);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const gbLibraryEntry* entry = gbGetLibraryEntry(m_library, i);
+            if (
+                m_librarySearch.empty() ||
+                containsIgnoringCase(entry->title, m_librarySearch) ||
+                containsIgnoringCase(entry->path, m_librarySearch)
+            )
+            {
+                m_libraryMatches.push_back(i);
+            }
+        }
+    }
+
+}
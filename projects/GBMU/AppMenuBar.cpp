@@ -40,6 +40,11 @@ namespace gbmu
                 showOpenCartridgeDialog();
             }
 
+            if (ImGui::MenuItem("Open Cartridge with Patches..."))
+            {
+                showOpenPatchedCartridgeDialog();
+            }
+
             if (ImGui::MenuItem("Detach Cartridge", "Ctrl+D", nullptr,
                 m_cart != nullptr))
             {
@@ -61,7 +66,29 @@ namespace gbmu
     {
         if (ImGui::BeginMenu("Emulation"))
         {
-            ImGui::MenuItem("Blargg Mode", nullptr, &m_blarggMode);
+            ImGui::MenuItem("Pause", nullptr, &m_paused, m_cart != nullptr);
+            ImGui::SetItemTooltip("Stops emulation; the window only redraws on input.");
+            ImGui::Separator();
+            if (ImGui::MenuItem("Blargg Mode", nullptr, &m_blarggMode))
+            {
+                updateHooks();
+            }
+            if (ImGui::MenuItem("Emulated RTC", nullptr, &m_emulatedRTC) &&
+                m_cart != nullptr)
+            {
+                gbSetCartridgeRTCClock(m_cart,
+                    m_emulatedRTC ? GB_RTC_EMULATED_CLOCK : GB_RTC_WALL_CLOCK);
+            }
+            ImGui::SetItemTooltip("Drives the cartridge clock from emulated time.");
+            ImGui::Separator();
+            ImGui::MenuItem("Map Save Files", nullptr, &m_mapSaveFiles);
+            ImGui::SetItemTooltip("Takes effect when the next cartridge is opened.");
+            if (ImGui::SliderInt("Autosave Interval", &m_autosaveSeconds, 1, 60,
+                "%d s") && m_autosave != nullptr)
+            {
+                gbSetAutosaveInterval(m_autosave,
+                    static_cast<std::uint32_t>(m_autosaveSeconds) * 1000);
+            }
             ImGui::EndMenu();
         }
     }
@@ -71,6 +98,11 @@ namespace gbmu
         if (ImGui::BeginMenu("View"))
         {
             ImGui::MenuItem("Console Window", nullptr, &m_showConsoleWindow);
+            ImGui::MenuItem("Statistics Window", nullptr, &m_showStatsWindow);
+            ImGui::MenuItem("Profiler Window", nullptr, &m_showProfilerWindow);
+            ImGui::MenuItem("Library Window", nullptr, &m_showLibraryWindow);
+            ImGui::MenuItem("Cheats Window", nullptr, &m_showCheatsWindow);
+            ImGui::MenuItem("RAM Search Window", nullptr, &m_showRAMSearchWindow);
             ImGui::Separator();
             ImGui::MenuItem("ImGui Demo Window", nullptr, &m_showDemoWindow);
             ImGui::EndMenu();
@@ -0,0 +1,134 @@
+/**
+ * @file    GBMU/AppProfilerWindow.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Frontend application
+ *          class's guest code profiler window methods.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <GBMU/Application.hpp>
+
+/* Private Constants **********************************************************/
+
+namespace gbmu
+{
+
+    /**
+     * @brief   The number of frames between rebuilds of the profiler report
+     *          while the window is open.
+     */
+    static constexpr std::uint32_t PROFILER_REFRESH_INTERVAL = 30;
+
+}
+
+/* Public Methods - ImGui Profiler Window *************************************/
+
+namespace gbmu
+{
+
+    auto Application::showProfilerWindow () -> void
+    {
+        if (!m_showProfilerWindow)
+        {
+            return;
+        }
+
+        ImGui::Begin("Profiler", &m_showProfilerWindow);
+        {
+            // - Controls. The profiler only costs time while it is attached.
+            bool rebuild = false;
+            if (ImGui::Checkbox("Enabled", &m_profilerEnabled))
+            {
+                gbAttachProfiler(m_gb, m_profilerEnabled ? m_profiler : nullptr);
+            }
+
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(100.0f);
+            if (ImGui::InputInt("Sample Period", &m_profilerSamplePeriod))
+            {
+                m_profilerSamplePeriod = std::max(m_profilerSamplePeriod, 1);
+                gbSetProfilerSamplePeriod(m_profiler,
+                    static_cast<std::uint32_t>(m_profilerSamplePeriod));
+            }
+
+            ImGui::SameLine();
+            rebuild |= ImGui::Checkbox("Group by Symbol", &m_profilerGroupBySymbol);
+
+            if (ImGui::Button("Load Symbols..."))
+            {
+                showLoadSymbolsDialog();
+                rebuild = true;
+            }
+
+            ImGui::SameLine();
+            if (ImGui::Button("Export Folded Stacks..."))
+            {
+                showExportFoldedStacksDialog();
+            }
+
+            ImGui::SameLine();
+            if (ImGui::Button("Reset"))
+            {
+                gbClearProfiler(m_profiler);
+                rebuild = true;
+            }
+
+            // - Rebuilding walks every counter, so only do it every so often.
+            if (rebuild || ++m_profilerRefreshFrames >= PROFILER_REFRESH_INTERVAL)
+            {
+                gbBuildProfilerReport(m_profiler, m_profilerGroupBySymbol);
+                m_profilerRefreshFrames = 0;
+            }
+
+            const auto total = gbGetProfilerTotalCycles(m_profiler);
+            const auto halted = gbGetProfilerHaltedCycles(m_profiler);
+            ImGui::Text("%zu symbols loaded; %llu T-cycles profiled, %.1f%% halted.",
+                gbGetProfilerSymbolCount(m_profiler),
+                static_cast<unsigned long long>(total),
+                (total > 0) ? 100.0 * halted / total : 0.0);
+
+            // - The report, sorted by cycles. Only the visible rows are drawn.
+            std::size_t count = 0;
+            const gbProfilerEntry* entries = gbGetProfilerReport(m_profiler, &count);
+            if (ImGui::BeginTable("ProfilerReport", 4,
+                ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable))
+            {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("T-cycles");
+                ImGui::TableSetupColumn("%");
+                ImGui::TableSetupColumn("Address");
+                ImGui::TableSetupColumn("Symbol", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableHeadersRow();
+
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(count));
+                while (clipper.Step())
+                {
+                    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+                    {
+                        const gbProfilerEntry& entry = entries[row];
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%llu", static_cast<unsigned long long>(entry.cycles));
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.2f", (total > 0) ? 100.0 * entry.cycles / total : 0.0);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("$%02X:%04X", entry.bank, entry.address);
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(entry.symbol != nullptr ? entry.symbol : "");
+                    }
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
+}
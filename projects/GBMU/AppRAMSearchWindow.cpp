@@ -0,0 +1,188 @@
+/**
+ * @file    GBMU/AppRAMSearchWindow.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Frontend application
+ *          class's RAM search window methods.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <algorithm>
+#include <climits>
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <GBMU/Application.hpp>
+
+/* Private Constants and Enumerations *****************************************/
+
+namespace gbmu
+{
+
+    static constexpr const char* RAM_SEARCH_VALUES[] =
+    {
+        "8-bit", "16-bit", "8-bit BCD", "16-bit BCD"
+    };
+
+    static constexpr const char* RAM_SEARCH_COMPARISONS[] =
+    {
+        "Equal to N", "Not equal to N", "Changed", "Unchanged", "Increased",
+        "Decreased", "Increased by N", "Decreased by N"
+    };
+
+    static constexpr const char* RAM_SEARCH_REGIONS[] =
+    {
+        "SRAM", "WRAM", "HRAM"
+    };
+
+}
+
+/* Public Methods - ImGui RAM Search Window ***********************************/
+
+namespace gbmu
+{
+
+    auto Application::showRAMSearchWindow () -> void
+    {
+        if (!m_showRAMSearchWindow)
+        {
+            return;
+        }
+
+        ImGui::Begin("RAM Search", &m_showRAMSearchWindow);
+        {
+            if (m_cart == nullptr)
+            {
+                ImGui::TextDisabled("Load a cartridge to search its RAM.");
+                ImGui::End();
+                return;
+            }
+
+            // - A new search starts from the RAM as it is now, with every
+            //   address a candidate.
+            if (ImGui::Button("New Search"))
+            {
+                if (m_ramSearch == nullptr)
+                {
+                    m_ramSearch = gbCreateRAMSearch();
+                }
+
+                gbResetRAMSearch(m_ramSearch, m_gb);
+            }
+
+            ImGui::BeginDisabled(m_ramSearch == nullptr);
+            {
+                ImGui::SetNextItemWidth(120.0f);
+                ImGui::Combo("Value", &m_ramSearchValue, RAM_SEARCH_VALUES,
+                    IM_ARRAYSIZE(RAM_SEARCH_VALUES));
+                ImGui::SameLine();
+                ImGui::SetNextItemWidth(140.0f);
+                ImGui::Combo("##Comparison", &m_ramSearchComparison,
+                    RAM_SEARCH_COMPARISONS, IM_ARRAYSIZE(RAM_SEARCH_COMPARISONS));
+
+                const bool hasOperand =
+                    m_ramSearchComparison == GB_RSC_EQUAL_TO ||
+                    m_ramSearchComparison == GB_RSC_NOT_EQUAL_TO ||
+                    m_ramSearchComparison == GB_RSC_INCREASED_BY ||
+                    m_ramSearchComparison == GB_RSC_DECREASED_BY;
+                ImGui::BeginDisabled(!hasOperand);
+                ImGui::SameLine();
+                ImGui::SetNextItemWidth(100.0f);
+                ImGui::InputInt("N", &m_ramSearchOperand, 1, 16,
+                    m_ramSearchHex ? ImGuiInputTextFlags_CharsHexadecimal : 0);
+                m_ramSearchOperand = std::max(m_ramSearchOperand, 0);
+                ImGui::EndDisabled();
+
+                ImGui::SameLine();
+                ImGui::Checkbox("Hex", &m_ramSearchHex);
+                ImGui::SameLine();
+                if (ImGui::Button("Filter"))
+                {
+                    gbFilterRAMSearch(m_ramSearch, m_gb,
+                        static_cast<gbRAMSearchValue>(m_ramSearchValue),
+                        static_cast<gbRAMSearchComparison>(m_ramSearchComparison),
+                        static_cast<std::uint32_t>(m_ramSearchOperand));
+                }
+            }
+            ImGui::EndDisabled();
+
+            if (m_ramSearch != nullptr)
+            {
+                showRAMSearchResults();
+            }
+        }
+        ImGui::End();
+    }
+
+    auto Application::showRAMSearchResults () -> void
+    {
+        const std::size_t count = gbGetRAMSearchCandidateCount(m_ramSearch);
+        ImGui::Text("%zu candidates.", count);
+
+        // - A fresh search has tens of thousands of candidates; only the
+        //   visible rows are fetched and drawn.
+        if (ImGui::BeginTable("RAMSearchResults", 4,
+            ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+            ImGuiTableFlags_ScrollY))
+        {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Address");
+            ImGui::TableSetupColumn("Region");
+            ImGui::TableSetupColumn("Value");
+            ImGui::TableSetupColumn("Previous");
+            ImGui::TableHeadersRow();
+
+            const auto value = static_cast<gbRAMSearchValue>(m_ramSearchValue);
+            // - Decimal values are shown in decimal either way.
+            const char* format =
+                (m_ramSearchHex && value == GB_RSV_U8) ? "$%02X" :
+                (m_ramSearchHex && value == GB_RSV_U16) ? "$%04X" : "%u";
+
+            std::vector<gbRAMSearchResult> results;
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(std::min<std::size_t>(count, INT_MAX)));
+            while (clipper.Step())
+            {
+                results.resize(static_cast<std::size_t>(
+                    clipper.DisplayEnd - clipper.DisplayStart));
+                results.resize(gbGetRAMSearchResults(m_ramSearch, value,
+                    static_cast<std::size_t>(clipper.DisplayStart),
+                    results.data(), results.size()));
+
+                for (const auto& result : results)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    if (result.region == GB_RSR_HIGH_RAM)
+                    {
+                        ImGui::Text("$%04X", result.address);
+                    }
+                    else
+                    {
+                        ImGui::Text("%02X:$%04X", result.bank, result.address);
+                    }
+
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(RAM_SEARCH_REGIONS[result.region]);
+
+                    ImGui::TableNextColumn();
+                    if (result.valid)
+                    {
+                        ImGui::Text(format, result.value);
+                        ImGui::TableNextColumn();
+                        ImGui::Text(format, result.previous);
+                    }
+                    else
+                    {
+                        ImGui::TextDisabled("(not BCD)");
+                        ImGui::TableNextColumn();
+                    }
+                }
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+}
@@ -0,0 +1,140 @@
+/**
+ * @file    GBMU/AppStatsWindow.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for the Game Boy Emulator Frontend application
+ *          class's statistics window methods.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <GBMU/Application.hpp>
+
+/* Public Methods - ImGui Statistics Window ***********************************/
+
+namespace gbmu
+{
+
+    auto Application::sampleStats (const sf::Time& deltaTime) -> void
+    {
+        // - Host frame time is always available; the core's counters only if
+        //   it was built with `GB_ENABLE_STATS`.
+        m_frameTimes[m_statsOffset] = deltaTime.asSeconds() * 1000.0f;
+
+        gbStats stats {};
+        m_statsEnabled = gbGetStats(m_gb, &stats);
+        if (m_statsEnabled)
+        {
+            const auto seconds = std::max(deltaTime.asSeconds(), 1.0e-6f);
+            m_instructionRates[m_statsOffset] = static_cast<float>(
+                stats.instructions - m_lastStats.instructions) / seconds / 1.0e6f;
+            m_lastStats = stats;
+        }
+
+        m_statsOffset = (m_statsOffset + 1) % m_frameTimes.size();
+    }
+
+    auto Application::showStatsWindow () -> void
+    {
+        if (!m_showStatsWindow)
+        {
+            return;
+        }
+
+        ImGui::Begin("Statistics", &m_showStatsWindow);
+        {
+            // - Frame-time graph, in milliseconds.
+            float total = 0.0f, worst = 0.0f;
+            for (const float frameTime : m_frameTimes)
+            {
+                total += frameTime;
+                worst = std::max(worst, frameTime);
+            }
+
+            const auto average = total / static_cast<float>(m_frameTimes.size());
+            const auto frameLabel = std::format("avg {:.2f} ms, worst {:.2f} ms",
+                average, worst);
+            ImGui::PlotLines("Frame Time", m_frameTimes.data(),
+                static_cast<int>(m_frameTimes.size()),
+                static_cast<int>(m_statsOffset), frameLabel.c_str(), 0.0f,
+                std::max(worst, 33.4f), ImVec2 { 0.0f, 60.0f });
+
+            if (!m_statsEnabled)
+            {
+                ImGui::TextDisabled(
+                    "Core statistics were not compiled in.\n"
+                    "Rebuild with '--enable-stats' to see them."
+                );
+                ImGui::End();
+                return;
+            }
+
+            // - Instruction-rate graph, in millions per second.
+            ImGui::PlotLines("MIPS", m_instructionRates.data(),
+                static_cast<int>(m_instructionRates.size()),
+                static_cast<int>(m_statsOffset), nullptr, 0.0f, FLT_MAX,
+                ImVec2 { 0.0f, 60.0f });
+
+            if (ImGui::Button("Reset Counters"))
+            {
+                gbResetStats(m_gb);
+                m_lastStats = {};
+            }
+
+            const gbStats& s = m_lastStats;
+            ImGui::SeparatorText("Processor");
+            ImGui::Text("Instructions:   %llu", static_cast<unsigned long long>(s.instructions));
+            ImGui::Text("T-cycles:       %llu", static_cast<unsigned long long>(s.tickCycles));
+            ImGui::Text("Halted T-cycles: %llu (%.1f%%)",
+                static_cast<unsigned long long>(s.haltedCycles),
+                (s.tickCycles > 0) ? 100.0 * s.haltedCycles / s.tickCycles : 0.0);
+            ImGui::Text("Time in gbRun:  %.3f s", s.runNanoseconds / 1.0e9);
+
+            ImGui::SeparatorText("Bus Accesses");
+            if (ImGui::BeginTable("BusAccesses", 3,
+                ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            {
+                ImGui::TableSetupColumn("Region");
+                ImGui::TableSetupColumn("Reads");
+                ImGui::TableSetupColumn("Writes");
+                ImGui::TableHeadersRow();
+                for (std::uint8_t region = 0; region < GB_BR_COUNT; ++region)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(gbStringifyBusRegion(
+                        static_cast<gbBusRegion>(region)));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(s.busReads[region]));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(s.busWrites[region]));
+                }
+
+                ImGui::EndTable();
+            }
+
+            ImGui::Text("Bus callbacks invoked: %llu",
+                static_cast<unsigned long long>(s.busCallbacks));
+
+            ImGui::SeparatorText("Interrupts Serviced");
+            static constexpr const char* INTERRUPT_NAMES[] = {
+                "VBlank", "LCD STAT", "Timer", "Serial", "Joypad"
+            };
+
+            for (std::size_t i = 0; i < std::size(INTERRUPT_NAMES); ++i)
+            {
+                ImGui::Text("%-9s %llu", INTERRUPT_NAMES[i],
+                    static_cast<unsigned long long>(s.interrupts[i]));
+            }
+
+            ImGui::SeparatorText("Cartridge");
+            ImGui::Text("MBC writes:     %llu", static_cast<unsigned long long>(s.mbcWrites));
+            ImGui::Text("Bank switches:  %llu", static_cast<unsigned long long>(s.bankSwitches));
+        }
+        ImGui::End();
+    }
+
+}
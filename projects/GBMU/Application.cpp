@@ -13,6 +13,7 @@
 #include <imgui_internal.h>
 #include <imgui_stdlib.h>
 #include <imgui-SFML.h>
+#include <filesystem>
 #include <GBMU/Application.hpp>
 
 /* Private Classes ************************************************************/
@@ -21,17 +22,20 @@ namespace gbmu
 {
 
     /**
-     * @brief Custom streambuf that writes to two destinations simultaneously.
+     * @brief Custom streambuf that tees its output to the console log.
      * 
-     * This class allows output to be "teed" to both the original stream
-     * (console) and a secondary buffer (for ImGui console window).
+     * This class passes output on to the original stream (terminal), and
+     * appends each whole line of it to the console log, for the ImGui console
+     * window.
      */
-    class TeeStreambuf final : public std::streambuf
+    class ConsoleStreambuf final : public std::streambuf
     {
     public:
-        TeeStreambuf (std::streambuf* sb1, std::streambuf* sb2) : 
-            m_sb1   { sb1 },
-            m_sb2   { sb2 }
+        ConsoleStreambuf (std::streambuf* sb, ConsoleLog& log,
+            ConsoleSeverity severity) : 
+            m_sb        { sb },
+            m_log       { log },
+            m_severity  { severity }
         {}
 
     protected:
@@ -42,21 +46,50 @@ namespace gbmu
                 return !EOF;
             }
 
-            const std::int32_t r1 = m_sb1->sputc(static_cast<char>(c));
-            const std::int32_t r2 = m_sb2->sputc(static_cast<char>(c));
-            return (r1 == EOF || r2 == EOF) ? EOF : c;
+            // - A line is logged once whole, or once it fills a log line.
+            if (c == '\n')
+            {
+                appendLine();
+            }
+            else
+            {
+                m_line.push_back(static_cast<char>(c));
+                if (m_line.size() >= ConsoleLog::LINE_LENGTH)
+                {
+                    appendLine();
+                }
+            }
+
+            return (m_sb->sputc(static_cast<char>(c)) == EOF) ? EOF : c;
         }
 
         auto sync () -> std::int32_t override
         {
-            const std::int32_t r1 = m_sb1->pubsync();
-            const std::int32_t r2 = m_sb2->pubsync();
-            return (r1 == 0 && r2 == 0) ? 0 : -1;
+            return m_sb->pubsync();
+        }
+
+    private:
+        auto appendLine () -> void
+        {
+            // - The core tags its log lines; anything else takes the severity
+            //   of the stream it was written to.
+            ConsoleSeverity severity = m_severity;
+            if (m_line.find("[ERROR]") != std::string::npos)
+                { severity = ConsoleSeverity::Error; }
+            else if (m_line.find("[WARN]") != std::string::npos)
+                { severity = ConsoleSeverity::Warning; }
+            else if (m_line.find("[INFO]") != std::string::npos)
+                { severity = ConsoleSeverity::Info; }
+
+            m_log.append(severity, m_line);
+            m_line.clear();
         }
 
     private:
-        std::streambuf* m_sb1 { nullptr };
-        std::streambuf* m_sb2 { nullptr };
+        std::streambuf*     m_sb { nullptr };
+        ConsoleLog&         m_log;
+        ConsoleSeverity     m_severity { ConsoleSeverity::Info };
+        std::string         m_line;
 
     };
 
@@ -67,19 +100,6 @@ namespace gbmu
 namespace gbmu
 {
 
-    static auto onBusReadStatic (const gbContext* context, uint16_t address,
-        uint8_t value) -> void
-    {
-        Application* app = reinterpret_cast<Application*>(
-            gbGetUserdata(context)
-        );
-
-        if (app != nullptr)
-        {
-            app->onBusRead(context, address, value);
-        }
-    }
-
     static auto onBusWriteStatic (gbContext* context, uint16_t address,
         uint8_t value, uint8_t actual) -> void
     {
@@ -93,31 +113,13 @@ namespace gbmu
         }
     }
 
-    static auto onInstructionFetchStatic (gbContext* context,
-        uint16_t address, uint16_t opcode) -> bool
-    {
-        Application* app = reinterpret_cast<Application*>(
-            gbGetUserdata(context)
-        );
-
-        if (app != nullptr)
-        {
-            return app->onInstructionFetch(context, address, opcode);
-        }
-
-        return true;
-    }
-
-    static auto onInstructionExecuteStatic (gbContext* context,
-        uint16_t address, uint16_t opcode, bool success) -> void
+    static auto onCoreLogStatic (gbLogLevel level, const char* message,
+        void* userdata) -> void
     {
-        Application* app = reinterpret_cast<Application*>(
-            gbGetUserdata(context)
-        );
-
+        Application* app = reinterpret_cast<Application*>(userdata);
         if (app != nullptr)
         {
-            app->onInstructionExecute(context, address, opcode, success);
+            app->onCoreLog(level, message);
         }
     }
 
@@ -143,19 +145,39 @@ namespace gbmu
         gbSetUserdata(m_gb, this);
 
         // - Set the context's callbacks.
-        gbProcessor* processor = gbGetProcessor(m_gb);
+        updateHooks();
+
+        // - Create the guest code profiler. It is only attached to the context
+        //   while enabled in the profiler window.
+        m_profiler = gbCreateProfiler(1);
+        if (m_profiler == nullptr)
+        {
+            throw std::runtime_error { "Error creating GB profiler!" };
+        }
+
+        // - Create the ROM library, from the index left by the last session if
+        //   there is one. It is only rescanned when asked to.
+        m_library = gbCreateLibrary();
+        if (m_library == nullptr)
+        {
+            throw std::runtime_error { "Error creating GB ROM library!" };
+        }
 
-        gbSetBusReadCallback(m_gb, onBusReadStatic);
-        gbSetBusWriteCallback(m_gb, onBusWriteStatic);
-        gbSetInstructionFetchCallback(processor, onInstructionFetchStatic);
-        gbSetInstructionExecuteCallback(processor, onInstructionExecuteStatic);
+        if (std::filesystem::exists(LIBRARY_INDEX_PATH))
+        {
+            gbLoadLibraryIndex(m_library, LIBRARY_INDEX_PATH);
+        }
+
+        filterLibrary();
 
         // - Initialize the SFML Render Window.
         m_window.create(
             sf::VideoMode { 1280, 720 },
             "GABLE Game Boy Emulator Frontend"
         );
-        m_window.setVerticalSyncEnabled(true);
+        // - Frames are paced by the emulator's own limiter, at the Game Boy's
+        //   59.73 Hz; vertical sync would fight it at the display's rate.
+        m_window.setVerticalSyncEnabled(false);
 
         // - Initialize ImGui-SFML.
         m_imguiInit = ImGui::SFML::Init(m_window);
@@ -164,15 +186,21 @@ namespace gbmu
         ImGuiIO& io = ImGui::GetIO();
         io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
 
-        // - Redirect stdout and stderr to console buffer while maintaining
+        // - Redirect stdout and stderr to the console log while maintaining
         //   terminal output.
         m_oldCoutBuf = std::cout.rdbuf();
         m_oldCerrBuf = std::cerr.rdbuf();
-        m_coutTee = std::make_unique<TeeStreambuf>(m_oldCoutBuf, m_consoleBuffer.rdbuf());
-        m_cerrTee = std::make_unique<TeeStreambuf>(m_oldCerrBuf, m_consoleBuffer.rdbuf());
+        m_coutTee = std::make_unique<ConsoleStreambuf>(m_oldCoutBuf, m_console,
+            ConsoleSeverity::Info);
+        m_cerrTee = std::make_unique<ConsoleStreambuf>(m_oldCerrBuf, m_console,
+            ConsoleSeverity::Error);
         std::cout.rdbuf(m_coutTee.get());
         std::cerr.rdbuf(m_cerrTee.get());
 
+        // - The core writes its log from its own thread, with C stdio, which
+        //   bypasses the streams above; take its messages directly instead.
+        gbSetLogSink(onCoreLogStatic, this);
+
         // - Parse command-line arguments.
         parseArguments(argc, argv);
     }
@@ -183,29 +211,54 @@ namespace gbmu
         std::cout.rdbuf(m_oldCoutBuf);
         std::cerr.rdbuf(m_oldCerrBuf);
 
+        // - Let any library scan finish, so that its work is kept.
+        if (m_libraryThread.joinable())
+        {
+            m_libraryThread.join();
+            gbSaveLibraryIndex(m_library, LIBRARY_INDEX_PATH);
+        }
+
+        gbDestroyLibrary(m_library);
+        gbDestroyRAMSearch(m_ramSearch);
+
         // - Shutdown ImGui-SFML.
         ImGui::SFML::Shutdown();
 
-        // - Destroy the Game Boy Emulator Core context.
+        // - Write out any unsaved battery RAM, then destroy the Game Boy
+        //   Emulator Core context.
+        gbDestroyAutosave(m_autosave, m_cart);
         gbDestroyContext(m_gb);
         gbDestroyCartridge(m_cart);
+        gbDestroyProfiler(m_profiler);
+
+        // - Deliver what the core logged while shutting down, then hand its
+        //   log back to the terminal.
+        gbSetLogSink(nullptr, nullptr);
     }
 
     auto Application::start () -> int32_t
     {
-        std::uint32_t ticks = 0;
         while (m_window.isOpen())
         {
-            if (m_cart != nullptr && gbTick(m_gb) == false)
+            // - With nothing to emulate, block until the user does something,
+            //   rather than spinning a host core to redraw an unchanged window.
+            if (isIdle() == true)
             {
-                m_window.close();
-                return 1;
+                waitForEvent();
+                onFrame(m_gb, nullptr, false);
+                continue;
             }
 
-            if ((++ticks % 70224) == 0)
+            // - Run one frame's worth of T-cycles. Cheats are applied at the
+            //   frame boundary by the core.
+            if (gbRun(m_gb, GB_CYCLES_PER_FRAME, nullptr) == false)
             {
-                onFrame(m_gb, nullptr, false);
+                m_window.close();
+                return 1;
             }
+
+            onFrame(m_gb, nullptr, false);
+            limitFrameRate();
         }
 
         return 0;
@@ -218,41 +271,37 @@ namespace gbmu
 namespace gbmu
 {
 
-    auto Application::onBusRead (const gbContext* context, uint16_t address,
-        uint8_t value) -> void
-    {
-    }
-
     auto Application::onBusWrite (gbContext* context, uint16_t address,
         uint8_t value, uint8_t actual) -> void
     {
-        if (m_blarggMode == true)
+        // - Only registered in Blargg mode, and only for writes to `SB`.
+        if (std::isspace(value) || std::isprint(value))
         {
-            if (address == GB_PR_SB)
-            {
-                if (std::isspace(value) || std::isprint(value))
-                {
-                    std::cout << static_cast<char>(value) << std::flush;
-                }
-            }
+            std::cout << static_cast<char>(value) << std::flush;
         }
     }
 
-    auto Application::onInstructionFetch (gbContext* context,
-        uint16_t address, uint16_t opcode) -> bool
-    {
-        return true;
-    }
-
-    auto Application::onInstructionExecute (gbContext* context,
-        uint16_t address, uint16_t opcode, bool success) -> void
+    auto Application::onCoreLog (gbLogLevel level, const char* message)
+        -> void
     {
+        // - Called on the core's log thread; stdio and the console log are
+        //   both safe to use from there.
+        std::FILE* stream = (level == GB_LL_INFO) ? stdout : stderr;
+        std::fputs(message, stream);
+        std::fputc('\n', stream);
+
+        m_console.append(
+            (level == GB_LL_ERROR) ? ConsoleSeverity::Error :
+            (level == GB_LL_WARN) ? ConsoleSeverity::Warning :
+                ConsoleSeverity::Info,
+            message);
     }
 
     auto Application::onFrame (const gbContext* context,
         const uint32_t* framebuffer, bool lcdEnabled) -> void
     {
         sf::Time deltaTime = m_clock.restart();
+        sampleStats(deltaTime);
 
         // - Process SFML events.
         sf::Event event;
@@ -276,6 +325,63 @@ namespace gbmu
 namespace gbmu
 {
 
+    auto Application::isIdle () const -> bool
+    {
+        // - A library scan reports its progress in the library window, so
+        //   keep drawing frames while it runs.
+        return (m_cart == nullptr || m_paused == true) && !m_libraryScanning;
+    }
+
+    auto Application::waitForEvent () -> void
+    {
+        // - Draw a few frames after each event before blocking again; ImGui
+        //   needs them to finish reacting to it.
+        if (m_settleFrames > 0)
+        {
+            m_settleFrames--;
+            return;
+        }
+
+        sf::Event event;
+        if (m_window.waitEvent(event) == true)
+        {
+            onEvent(event);
+            m_settleFrames = IDLE_SETTLE_FRAMES;
+        }
+
+        // - The next running frame is paced from now, not from before the
+        //   wait.
+        m_frameDeadline = m_frameClock.getElapsedTime();
+    }
+
+    auto Application::limitFrameRate () -> void
+    {
+        // - Sleep off most of what is left of the frame, then yield until its
+        //   deadline; the OS's sleep is only accurate to about a millisecond.
+        const sf::Time frame = sf::microseconds(FRAME_MICROSECONDS);
+        const sf::Time margin = sf::milliseconds(1);
+        m_frameDeadline += frame;
+
+        sf::Time now = m_frameClock.getElapsedTime();
+        if (now > m_frameDeadline + frame)
+        {
+            // - More than a frame behind (e.g., the window was dragged); drop
+            //   the lost time instead of racing to catch up.
+            m_frameDeadline = now;
+            return;
+        }
+
+        if (m_frameDeadline - now > margin)
+        {
+            sf::sleep(m_frameDeadline - now - margin);
+        }
+
+        while (m_frameClock.getElapsedTime() < m_frameDeadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
     auto Application::onEvent (const sf::Event& event) -> void
     {
         ImGui::SFML::ProcessEvent(m_window, event);
@@ -288,7 +394,22 @@ namespace gbmu
 
     auto Application::onUpdate (const sf::Time& deltaTime) -> void
     {
+        // - Write any new console lines out to the log file, if enabled.
+        spillConsoleLog();
 
+        // - Hand any battery RAM written since the last autosave to the
+        //   autosave thread; or, if it is mapped to its save file, have the
+        //   touched pages written back.
+        if (m_autosave != nullptr)
+        {
+            gbUpdateAutosave(m_autosave, m_cart);
+        }
+        else if (gbIsCartridgeRAMMapped(m_cart) &&
+            m_saveSyncClock.getElapsedTime().asSeconds() >= m_autosaveSeconds)
+        {
+            gbSyncCartridgeRAM(m_cart, false);
+            m_saveSyncClock.restart();
+        }
     }
 
     auto Application::onGUI (const sf::Time& deltaTime) -> void
@@ -298,6 +419,11 @@ namespace gbmu
 
         showMenuBar();
         showConsoleWindow();
+        showStatsWindow();
+        showProfilerWindow();
+        showLibraryWindow();
+        showCheatsWindow();
+        showRAMSearchWindow();
         
         if (m_showDemoWindow)
         {
@@ -320,9 +446,17 @@ namespace gbmu
 namespace gbmu
 {
 
-    auto Application::loadCartridge (const std::string& filepath) -> bool
+    auto Application::loadCartridge (const std::string& filepath,
+        const std::vector<std::string>& patchPaths) -> bool
     {
-        gbCartridge* cart = gbCreateCartridge(filepath.c_str());
+        std::vector<const char*> patches;
+        for (const auto& patchPath : patchPaths)
+        {
+            patches.push_back(patchPath.c_str());
+        }
+
+        gbCartridge* cart = gbCreateCartridgeWithPatches(filepath.c_str(),
+            patches.data(), patches.size());
         if (cart == nullptr)
         {
             pfd::message(
@@ -335,9 +469,35 @@ namespace gbmu
             return false;
         }
         
+        gbDestroyAutosave(m_autosave, m_cart);
+        m_autosave = nullptr;
+
+        // - Cheat codes are made for one game; drop the last cartridge's.
+        gbClearCheats(m_gb);
         gbAttachCartridge(m_gb, cart);
         gbDestroyCartridge(m_cart);
         m_cart = cart;
+        gbSetCartridgeRTCClock(m_cart,
+            m_emulatedRTC ? GB_RTC_EMULATED_CLOCK : GB_RTC_WALL_CLOCK);
+
+        // - Load the cartridge's battery RAM from the `.sav` file beside it,
+        //   and keep that file up to date from now on: either by mapping it,
+        //   or by autosaving into it.
+        if (gbHasCartridgeBatteryRAM(m_cart))
+        {
+            const auto savePath =
+                std::filesystem::path { filepath }.replace_extension(".sav").string();
+            if (m_mapSaveFiles && gbMapCartridgeRAM(m_cart, savePath.c_str(), false))
+            {
+                m_saveSyncClock.restart();
+            }
+            else
+            {
+                gbLoadCartridgeRAM(m_cart, savePath.c_str(), false);
+                m_autosave = gbCreateAutosave(m_cart, savePath.c_str(),
+                    static_cast<std::uint32_t>(m_autosaveSeconds) * 1000);
+            }
+        }
 
         const auto header = gbGetCartridgeHeader(m_cart);
         const char* title = gbGetCartridgeTitle(header);
@@ -362,22 +522,27 @@ namespace gbmu
             );
         }
 
-        // - Clear the console buffer.
-        m_consoleBuffer.str(std::string());
-        m_consoleBuffer.clear();
+        // - Clear the console window, and the last cartridge's profile.
+        m_consoleFirst = m_console.getEnd();
+        gbClearProfiler(m_profiler);
 
+        // - A newly opened cartridge starts running, even if the last was
+        //   paused.
+        m_paused = false;
         return true;
     }
 
     auto Application::unloadCartridge () -> void
     {
+        gbDestroyAutosave(m_autosave, m_cart);
+        m_autosave = nullptr;
+
         gbAttachCartridge(m_gb, nullptr);
         gbDestroyCartridge(m_cart);
         m_cart = nullptr;
 
-        // - Clear the console buffer.
-        m_consoleBuffer.str(std::string());
-        m_consoleBuffer.clear();
+        // - Clear the console window.
+        m_consoleFirst = m_console.getEnd();
 
         m_window.setTitle("GABLE Game Boy Emulator Frontend");
     }
@@ -385,17 +550,45 @@ namespace gbmu
     auto Application::parseArguments (int argc, char** argv) -> void
     {
         // -r <path>, --rom <path> : Load the specified ROM file.
+        // -p <path>, --patch <path> : Apply the specified IPS, UPS or BPS patch
+        //                             to the ROM file. May be repeated.
         // -s <max ticks>, --steps <max ticks> : Set the maximum tick count.
+        std::string romPath;
+        std::vector<std::string> patchPaths;
         for (int i = 1; i < argc; ++i)
         {
             std::string arg = argv[i];
 
             if ((arg == "-r" || arg == "--rom") && (i + 1) < argc)
             {
-                std::string romPath = argv[++i];
-                loadCartridge(romPath);
+                romPath = argv[++i];
+            }
+            else if ((arg == "-p" || arg == "--patch") && (i + 1) < argc)
+            {
+                patchPaths.push_back(argv[++i]);
             }
         }
+
+        if (!romPath.empty())
+        {
+            loadCartridge(romPath, patchPaths);
+        }
+    }
+
+    auto Application::updateHooks () -> void
+    {
+        // - Only Blargg mode needs a callback: the write to `SB` which sends
+        //   each character of a test ROM's output. Nothing else is hooked,
+        //   so the core makes no calls into the frontend per instruction.
+        gbHooks hooks {};
+        if (m_blarggMode == true)
+        {
+            hooks.events = GB_HE_BUS_WRITE;
+            hooks.busFilter = { true, GB_PR_SB, GB_PR_SB };
+            hooks.busWrite = onBusWriteStatic;
+        }
+
+        gbSetHooks(m_gb, &hooks);
     }
 
 }
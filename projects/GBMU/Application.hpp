@@ -9,7 +9,13 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <thread>
+#include <vector>
 #include <GB/GB.h>
+#include <GBMU/ConsoleLog.hpp>
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
@@ -20,6 +26,29 @@
 namespace gbmu
 {
 
+    /**
+     * @brief   The path of the ROM library index, kept between sessions.
+     */
+    inline constexpr const char* LIBRARY_INDEX_PATH = "gbmu-library.idx";
+
+    /**
+     * @brief   The path of the file the console log is written to, if enabled.
+     */
+    inline constexpr const char* CONSOLE_LOG_PATH = "gbmu-console.log";
+
+    /**
+     * @brief   The length of one Game Boy frame, in microseconds: 70224 T-cycles
+     *          at 4.194304 MHz, about 16.74 ms.
+     */
+    inline constexpr std::int64_t FRAME_MICROSECONDS =
+        static_cast<std::int64_t>(GB_CYCLES_PER_FRAME * 1000000ull / 4194304ull);
+
+    /**
+     * @brief   The number of frames drawn after each event while idle, so that
+     *          ImGui can settle (e.g., open a popup) before the loop blocks.
+     */
+    inline constexpr std::uint32_t IDLE_SETTLE_FRAMES = 3;
+
     class Application final
     {
     public: /* Public Methods *************************************************/
@@ -30,16 +59,11 @@ namespace gbmu
 
     public: /* Public Methods - GB Context Callbacks **************************/
 
-        auto onBusRead (const gbContext* context, uint16_t address,
-            uint8_t value) -> void;
         auto onBusWrite (gbContext* context, uint16_t address,
             uint8_t value, uint8_t actual) -> void;
-        auto onInstructionFetch (gbContext* context,
-            uint16_t address, uint16_t opcode) -> bool;
-        auto onInstructionExecute (gbContext* context,
-            uint16_t address, uint16_t opcode, bool success) -> void;
         auto onFrame (const gbContext* context,
             const uint32_t* framebuffer, bool lcdEnabled) -> void;
+        auto onCoreLog (gbLogLevel level, const char* message) -> void;
 
     private: /* Private Methods - Application Lifecycle ***********************/
 
@@ -47,6 +71,9 @@ namespace gbmu
         auto onUpdate (const sf::Time& deltaTime) -> void;
         auto onGUI (const sf::Time& deltaTime) -> void;
         auto onRender (const uint32_t* framebuffer) -> void;
+        auto isIdle () const -> bool;
+        auto waitForEvent () -> void;
+        auto limitFrameRate () -> void;
 
     private: /* Private Methods - ImGui Menu Bar ******************************/
 
@@ -59,40 +86,128 @@ namespace gbmu
     private: /* Private Methods - ImGui Console Window ************************/
 
         auto showConsoleWindow () -> void;
+        auto spillConsoleLog () -> void;
+
+    private: /* Private Methods - ImGui Statistics Window *********************/
+
+        auto sampleStats (const sf::Time& deltaTime) -> void;
+        auto showStatsWindow () -> void;
+
+    private: /* Private Methods - ImGui Profiler Window ***********************/
+
+        auto showProfilerWindow () -> void;
+
+    private: /* Private Methods - ImGui Library Window ************************/
+
+        auto showLibraryWindow () -> void;
+        auto startLibraryScan (const std::string& rootPath, bool verify) -> void;
+        auto filterLibrary () -> void;
+
+    private: /* Private Methods - ImGui Cheats Window *************************/
+
+        auto showCheatsWindow () -> void;
+
+    private: /* Private Methods - ImGui RAM Search Window *********************/
+
+        auto showRAMSearchWindow () -> void;
+        auto showRAMSearchResults () -> void;
 
     private: /* Private Methods - Dialogs *************************************/
 
         auto showOpenCartridgeDialog () -> void;
+        auto showOpenPatchedCartridgeDialog () -> void;
+        auto showLoadSymbolsDialog () -> void;
+        auto showExportFoldedStacksDialog () -> void;
+        auto showSelectLibraryFolderDialog () -> void;
 
     private: /* Private Methods - Utility Functions ***************************/
 
-        auto loadCartridge (const std::string& filepath) -> bool;
+        auto loadCartridge (const std::string& filepath,
+            const std::vector<std::string>& patchPaths = {}) -> bool;
         auto unloadCartridge () -> void;
         auto parseArguments (int argc, char** argv) -> void;
+        auto updateHooks () -> void;
 
     private: /* Private Members ***********************************************/
 
         gbContext*           m_gb { nullptr };
         gbCartridge*         m_cart { nullptr };
+        gbProfiler*          m_profiler { nullptr };
+        gbAutosave*          m_autosave { nullptr };
         sf::RenderWindow     m_window;
         sf::Clock            m_clock;
+        sf::Clock            m_frameClock;
+        sf::Time             m_frameDeadline;
+        std::uint32_t        m_settleFrames { IDLE_SETTLE_FRAMES };
         bool                 m_imguiInit { false };
 
     private: /* Private Members - Emulation Options ***************************/
 
+        bool                 m_paused { false };
         bool                 m_blarggMode { true };
+        std::int32_t         m_autosaveSeconds { 5 };
+        bool                 m_mapSaveFiles { false };
+        bool                 m_emulatedRTC { false };
+        sf::Clock            m_saveSyncClock;
 
     private: /* Private Members - Show Windows ********************************/
 
         bool                 m_showDemoWindow { false };
         bool                 m_showConsoleWindow { true };
+        bool                 m_showStatsWindow { false };
+        bool                 m_showProfilerWindow { false };
+        bool                 m_showLibraryWindow { false };
+        bool                 m_showCheatsWindow { false };
+        bool                 m_showRAMSearchWindow { false };
 
     private: /* Private Members - Console Output Window ***********************/
     
-        std::stringstream                  m_consoleBuffer;
+        ConsoleLog                         m_console;
+        std::uint64_t                      m_consoleFirst { 0 };
         std::streambuf*                    m_oldCoutBuf { nullptr };
         std::streambuf*                    m_oldCerrBuf { nullptr };
         std::unique_ptr<std::streambuf>    m_coutTee;
         std::unique_ptr<std::streambuf>    m_cerrTee;
+        std::array<bool, 3>                m_consoleSeverities { true, true, true };
+        std::vector<std::uint64_t>         m_consoleRows;
+        std::ofstream                      m_consoleSpill;
+        std::uint64_t                      m_consoleSpilled { 0 };
+
+    private: /* Private Members - Statistics Window ***************************/
+
+        std::array<float, 240>  m_frameTimes {};
+        std::array<float, 240>  m_instructionRates {};
+        std::size_t             m_statsOffset { 0 };
+        gbStats                 m_lastStats {};
+        bool                    m_statsEnabled { false };
+
+    private: /* Private Members - Profiler Window *****************************/
+
+        bool                    m_profilerEnabled { false };
+        bool                    m_profilerGroupBySymbol { true };
+        std::int32_t            m_profilerSamplePeriod { 1 };
+        std::uint32_t           m_profilerRefreshFrames { 0 };
+
+    private: /* Private Members - Library Window ******************************/
+
+        gbLibrary*                  m_library { nullptr };
+        std::thread                 m_libraryThread;
+        std::atomic<bool>           m_libraryScanning { false };
+        std::string                 m_libraryRoot;
+        std::string                 m_librarySearch;
+        std::vector<std::size_t>    m_libraryMatches;
+
+    private: /* Private Members - Cheats Window *******************************/
+
+        std::string                 m_cheatInput;
+        bool                        m_cheatError { false };
+
+    private: /* Private Members - RAM Search Window ***************************/
+
+        gbRAMSearch*                m_ramSearch { nullptr };
+        std::int32_t                m_ramSearchValue { GB_RSV_U8 };
+        std::int32_t                m_ramSearchComparison { GB_RSC_EQUAL_TO };
+        std::int32_t                m_ramSearchOperand { 0 };
+        bool                        m_ramSearchHex { false };
 
     };}
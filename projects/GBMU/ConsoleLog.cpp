@@ -0,0 +1,87 @@
+/**
+ * @file    GBMU/ConsoleLog.cpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ * 
+ * @brief   Contains definitions for the Game Boy Emulator Frontend's console
+ *          log.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <cstring>
+#include <GBMU/ConsoleLog.hpp>
+
+/* Public Methods *************************************************************/
+
+namespace gbmu
+{
+
+    ConsoleLog::ConsoleLog () :
+        m_slots { std::make_unique<Slot[]>(LINE_COUNT) }
+    {}
+
+    auto ConsoleLog::append (ConsoleSeverity severity, std::string_view text)
+        -> void
+    {
+        // - A line too long for one slot continues in the next.
+        do
+        {
+            const auto chunk = text.substr(0, LINE_LENGTH);
+            text.remove_prefix(chunk.size());
+
+            // - Claim a slot, mark it unreadable while it is filled, then
+            //   publish it under its sequence number.
+            const auto sequence = m_end.fetch_add(1, std::memory_order_relaxed);
+            Slot& slot = m_slots[sequence % LINE_COUNT];
+            slot.published.store(0, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.severity = severity;
+            slot.length = static_cast<std::uint8_t>(chunk.size());
+            std::memcpy(slot.text, chunk.data(), chunk.size());
+            slot.published.store(sequence + 1, std::memory_order_release);
+        }
+        while (!text.empty());
+    }
+
+    auto ConsoleLog::getFirst () const -> std::uint64_t
+    {
+        const auto end = m_end.load(std::memory_order_acquire);
+        return (end > LINE_COUNT) ? (end - LINE_COUNT) : 0;
+    }
+
+    auto ConsoleLog::getEnd () const -> std::uint64_t
+    {
+        return m_end.load(std::memory_order_acquire);
+    }
+
+    auto ConsoleLog::getSeverity (std::uint64_t sequence,
+        ConsoleSeverity& outSeverity) const -> bool
+    {
+        const Slot& slot = m_slots[sequence % LINE_COUNT];
+        if (slot.published.load(std::memory_order_acquire) != sequence + 1)
+        {
+            return false;
+        }
+
+        outSeverity = slot.severity;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.published.load(std::memory_order_relaxed) == sequence + 1;
+    }
+
+    auto ConsoleLog::read (std::uint64_t sequence, std::string& outText) const
+        -> bool
+    {
+        // - Copy the line, then check that it was not overwritten meanwhile.
+        const Slot& slot = m_slots[sequence % LINE_COUNT];
+        if (slot.published.load(std::memory_order_acquire) != sequence + 1)
+        {
+            return false;
+        }
+
+        outText.assign(slot.text, slot.length);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.published.load(std::memory_order_relaxed) == sequence + 1;
+    }
+
+}
@@ -0,0 +1,75 @@
+/**
+ * @file    GBMU/ConsoleLog.hpp
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ * 
+ * @brief   Contains declarations for the Game Boy Emulator Frontend's console
+ *          log, a fixed-capacity ring of output lines.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace gbmu
+{
+
+    /**
+     * @brief   Enumerates the severities of the lines in the console log.
+     */
+    enum class ConsoleSeverity : std::uint8_t
+    {
+        Info,
+        Warning,
+        Error
+    };
+
+    /**
+     * @brief   A fixed-capacity ring of console output lines.
+     * 
+     * Any thread may append a line without taking a lock: it claims the next
+     * sequence number, fills the slot which that number maps to, then
+     * publishes the slot. Once the ring is full, each new line overwrites the
+     * oldest. Lines are read back by sequence number; a line still being
+     * written, or already overwritten, cannot be read.
+     */
+    class ConsoleLog final
+    {
+    public: /* Public Constants ***********************************************/
+
+        static constexpr std::size_t LINE_COUNT  = 4096;
+        static constexpr std::size_t LINE_LENGTH = 240;
+
+    public: /* Public Methods *************************************************/
+
+        ConsoleLog ();
+
+        auto append (ConsoleSeverity severity, std::string_view text) -> void;
+        auto getFirst () const -> std::uint64_t;
+        auto getEnd () const -> std::uint64_t;
+        auto getSeverity (std::uint64_t sequence,
+            ConsoleSeverity& outSeverity) const -> bool;
+        auto read (std::uint64_t sequence, std::string& outText) const -> bool;
+
+    private: /* Private Structures ********************************************/
+
+        struct Slot
+        {
+            std::atomic<std::uint64_t>  published { 0 };    // Sequence number plus one; `0` while being written.
+            ConsoleSeverity             severity { ConsoleSeverity::Info };
+            std::uint8_t                length { 0 };
+            char                        text[LINE_LENGTH] {};
+        };
+
+    private: /* Private Members ***********************************************/
+
+        std::unique_ptr<Slot[]>     m_slots;
+        std::atomic<std::uint64_t>  m_end { 0 };
+
+    };
+
+}
@@ -0,0 +1,651 @@
+/**
+ * @file    GBT/BenchCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt bench` subcommand, which
+ *          runs microbenchmarks against the core's processor, address bus,
+ *          timer, interrupt and cartridge code paths.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+#include <GBT/ROMBuilder.h>
+
+#if defined(GB_WINDOWS)
+    #include <windows.h>
+#else
+    #include <sched.h>
+#endif
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The default number of operations timed in each repetition.
+ */
+#define GBT_BENCH_DEFAULT_ITERATIONS    200000ull
+
+/**
+ * @brief   The default number of timed repetitions of each benchmark.
+ */
+#define GBT_BENCH_DEFAULT_REPETITIONS   7ull
+
+/**
+ * @brief   The default number of untimed operations run before the first
+ *          repetition of each benchmark.
+ */
+#define GBT_BENCH_DEFAULT_WARMUP        20000ull
+
+/**
+ * @brief   The address in WRAM at which instruction benchmarks place their
+ *          code, and the size of the block they fill.
+ */
+#define GBT_BENCH_CODE_START            0xC000
+#define GBT_BENCH_CODE_SIZE             0x1000
+
+/**
+ * @brief   The addresses in WRAM which instruction benchmarks point `HL` and
+ *          `SP` at.
+ */
+#define GBT_BENCH_DATA_ADDRESS          0xD800
+#define GBT_BENCH_STACK_ADDRESS         0xDFF0
+
+/**
+ * @brief   The address in cartridge ROM of the loop which the trace benchmarks
+ *          run, and the capacity of the trace buffer they record into.
+ */
+#define GBT_BENCH_ROM_LOOP_ADDRESS      0x0150
+#define GBT_BENCH_TRACE_CAPACITY        0x10000
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding the emulator state shared by the
+ *          benchmarks. One cartridge is created for each memory bank
+ *          controller which is benchmarked.
+ */
+typedef struct gbtBenchState
+{
+    gbContext*      context;
+    gbProcessor*    processor;
+    gbCartridge*    mbc1;
+    gbCartridge*    mbc3;
+    gbCartridge*    mbc5;
+    gbTrace*        trace;
+    const uint8_t*  code;           // Instruction benchmarks: the repeated pattern.
+    size_t          codeLength;
+    uint16_t        address;        // Bus benchmarks: the base address accessed.
+} gbtBenchState;
+
+typedef struct gbtBenchmark gbtBenchmark;
+
+/**
+ * @brief   Defines a pointer to a function which prepares the benchmark state
+ *          before a benchmark's warmup.
+ */
+typedef bool (*gbtBenchSetup) (gbtBenchState* state,
+    const gbtBenchmark* benchmark);
+
+/**
+ * @brief   Defines a pointer to a function which performs a benchmark's
+ *          operation the given number of times.
+ */
+typedef void (*gbtBenchBody) (gbtBenchState* state, uint64_t iterations);
+
+/**
+ * @brief   Defines a structure describing a single microbenchmark.
+ */
+struct gbtBenchmark
+{
+    const char*     group;
+    const char*     name;
+    gbtBenchSetup   setup;
+    gbtBenchBody    body;
+    const void*     argument;       // Read by `setup`.
+    size_t          argumentLength;
+};
+
+/**
+ * @brief   Defines a structure holding the timings of a single benchmark.
+ */
+typedef struct gbtBenchResult
+{
+    const gbtBenchmark* benchmark;
+    double              minimum;    // Nanoseconds per operation.
+    double              median;
+    double              mean;
+} gbtBenchResult;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintBenchUsage ();
+static gbCartridge* gbtCreateBenchCartridge (uint8_t cartridgeType);
+static bool gbtPinToProcessor (uint64_t processorIndex);
+static int gbtCompareDoubles (const void* a, const void* b);
+
+static bool gbtSetupInstruction (gbtBenchState* state,
+    const gbtBenchmark* benchmark);
+static void gbtRunInstruction (gbtBenchState* state, uint64_t iterations);
+static bool gbtSetupBus (gbtBenchState* state,
+    const gbtBenchmark* benchmark);
+static void gbtRunBusRead (gbtBenchState* state, uint64_t iterations);
+static void gbtRunBusWrite (gbtBenchState* state, uint64_t iterations);
+static bool gbtSetupNothing (gbtBenchState* state,
+    const gbtBenchmark* benchmark);
+static void gbtRunTickTimer (gbtBenchState* state, uint64_t iterations);
+static void gbtRunServiceInterrupt (gbtBenchState* state, uint64_t iterations);
+static bool gbtSetupBankSwitch (gbtBenchState* state,
+    const gbtBenchmark* benchmark);
+static void gbtRunBankSwitch (gbtBenchState* state, uint64_t iterations);
+static bool gbtSetupTrace (gbtBenchState* state,
+    const gbtBenchmark* benchmark);
+static void gbtPrintTraceOverhead (const gbtBenchResult* results,
+    size_t resultCount);
+
+/* Private Constants and Enumerations - Benchmarks ****************************/
+
+#define GBT_CODE(...) \
+    (const uint8_t[]) { __VA_ARGS__ }, sizeof((const uint8_t[]) { __VA_ARGS__ })
+#define GBT_ADDRESS(address) \
+    (const uint16_t[]) { address }, sizeof(uint16_t)
+#define GBT_MBC(type) \
+    (const uint8_t[]) { type }, 1
+#define GBT_TRACED(traced) \
+    (const bool[]) { traced }, sizeof(bool)
+
+/**
+ * @brief   Defines the table of microbenchmarks run by `gbt bench`.
+ *
+ * Instruction benchmarks fill a block of WRAM with repetitions of a short code
+ * pattern, then time @a `gbTickProcessor`, one instruction per operation. The
+ * processor's opcode dispatch (@a `gbExecuteInstruction` and its `CB`-prefixed
+ * counterpart) is private, so its cost is measured together with the opcode
+ * fetch and the timer ticks each instruction consumes.
+ */
+static const gbtBenchmark GBT_BENCHMARKS[] = {
+    { "opcode", "nop",              gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x00) },
+    { "opcode", "ld-r-r",           gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x41) },
+    { "opcode", "ld-r-d8",          gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x06, 0x12) },
+    { "opcode", "ld-r-[hl]",        gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x7E) },
+    { "opcode", "ld-[hl]-r",        gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x70) },
+    { "opcode", "ldh-a-[a8]",       gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0xF0, 0x80) },
+    { "opcode", "inc-r",            gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x04) },
+    { "opcode", "inc-rr",           gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x03) },
+    { "opcode", "alu-a-r",          gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x80) },
+    { "opcode", "alu-a-d8",         gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0xC6, 0x01) },
+    { "opcode", "alu-a-[hl]",       gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0xAE) },
+    { "opcode", "push-pop",         gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0xC5, 0xC1) },
+    { "opcode", "jr-s8",            gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0x18, 0x00) },
+    { "opcode", "cb-rotate-r",      gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0xCB, 0x00) },
+    { "opcode", "cb-bit-r",         gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0xCB, 0x40) },
+    { "opcode", "cb-set-[hl]",      gbtSetupInstruction, gbtRunInstruction, GBT_CODE(0xCB, 0xC6) },
+
+    { "read",   "rom0",             gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0x0150) },
+    { "read",   "romx",             gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0x4000) },
+    { "read",   "extram",           gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0xA000) },
+    { "read",   "wram0",            gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0xC000) },
+    { "read",   "wramx",            gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0xD000) },
+    { "read",   "echo",             gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0xE000) },
+    { "read",   "oam",              gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0xFE00) },
+    { "read",   "io-timer",         gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0xFF04) },
+    { "read",   "hram",             gbtSetupBus, gbtRunBusRead,     GBT_ADDRESS(0xFF80) },
+
+    { "write",  "extram",           gbtSetupBus, gbtRunBusWrite,    GBT_ADDRESS(0xA000) },
+    { "write",  "wram0",            gbtSetupBus, gbtRunBusWrite,    GBT_ADDRESS(0xC000) },
+    { "write",  "wramx",            gbtSetupBus, gbtRunBusWrite,    GBT_ADDRESS(0xD000) },
+    { "write",  "echo",             gbtSetupBus, gbtRunBusWrite,    GBT_ADDRESS(0xE000) },
+    { "write",  "oam",              gbtSetupBus, gbtRunBusWrite,    GBT_ADDRESS(0xFE00) },
+    { "write",  "io-timer",         gbtSetupBus, gbtRunBusWrite,    GBT_ADDRESS(0xFF05) },
+    { "write",  "hram",             gbtSetupBus, gbtRunBusWrite,    GBT_ADDRESS(0xFF80) },
+
+    { "timer",  "tick",             gbtSetupNothing, gbtRunTickTimer,        nullptr, 0 },
+    { "interrupt", "request-service", gbtSetupNothing, gbtRunServiceInterrupt, nullptr, 0 },
+
+    { "mbc",    "mbc1-switch-read", gbtSetupBankSwitch, gbtRunBankSwitch, GBT_MBC(0x03) },
+    { "mbc",    "mbc3-switch-read", gbtSetupBankSwitch, gbtRunBankSwitch, GBT_MBC(0x13) },
+    { "mbc",    "mbc5-switch-read", gbtSetupBankSwitch, gbtRunBankSwitch, GBT_MBC(0x1B) },
+
+    { "trace",  "untraced",         gbtSetupTrace, gbtRunInstruction, GBT_TRACED(false) },
+    { "trace",  "traced",           gbtSetupTrace, gbtRunInstruction, GBT_TRACED(true) },
+};
+
+#undef GBT_CODE
+#undef GBT_ADDRESS
+#undef GBT_MBC
+#undef GBT_TRACED
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintBenchUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt bench [--filter TEXT] [--iterations N] [--reps N] [--warmup N]\n"
+        "            [--pin CPU] [--json FILE] [--list]\n"
+        "\n"
+        "Each benchmark runs N untimed warmup operations, then times --reps\n"
+        "repetitions of --iterations operations, and reports ns/op. When both\n"
+        "trace benchmarks run, the cost of tracing is reported after them.\n"
+    );
+}
+
+gbCartridge* gbtCreateBenchCartridge (uint8_t cartridgeType)
+{
+    // - 64 banks (1 MiB) of ROM, and 8 KiB of RAM. Each ROMX bank is filled
+    //   with its own bank number, so that bank switches can be verified.
+    gbtROMBuilder builder;
+    if (gbtInitROMBuilder(&builder, "GBT BENCH", cartridgeType, 0x05, 0x02) == false)
+    {
+        return nullptr;
+    }
+
+    for (uint16_t bank = 1; bank < builder.bankCount; ++bank)
+    {
+        gbtFillROMBank(&builder, bank, (uint8_t) bank);
+    }
+
+    // - The trace benchmarks run a loop from ROM, so that each record is
+    //   tagged with its bank: `LD A, [HL]`, `ADD A, B`, `LD [HL], A`, `INC L`.
+    gbtSetROMOrigin(&builder, 0, GBT_BENCH_ROM_LOOP_ADDRESS);
+    gbtEmit(&builder, 4, 0x7E, 0x80, 0x77, 0x2C);
+    gbtEmitJR(&builder, 0x18, GBT_BENCH_ROM_LOOP_ADDRESS);
+
+    gbCartridge* cartridge = gbtFinishROMBuilder(&builder);
+    gbtFreeROMBuilder(&builder);
+    return cartridge;
+}
+
+bool gbtPinToProcessor (uint64_t processorIndex)
+{
+#if defined(GB_WINDOWS)
+    gbCheckv(processorIndex < 64, false, "Processor index %llu is out of range.",
+        (unsigned long long) processorIndex);
+    return SetThreadAffinityMask(GetCurrentThread(),
+        (DWORD_PTR) 1 << processorIndex) != 0;
+#else
+    gbCheckv(processorIndex < CPU_SETSIZE, false,
+        "Processor index %llu is out of range.",
+        (unsigned long long) processorIndex);
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET((int) processorIndex, &set);
+    gbCheckpv(sched_setaffinity(0, sizeof(set), &set) == 0, false,
+        "Failed to pin to processor #%llu", (unsigned long long) processorIndex);
+    return true;
+#endif
+}
+
+int gbtCompareDoubles (const void* a, const void* b)
+{
+    double x = *(const double*) a, y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+/* Private Function Definitions - Benchmarks **********************************/
+
+bool gbtSetupInstruction (gbtBenchState* state, const gbtBenchmark* benchmark)
+{
+    state->code = benchmark->argument;
+    state->codeLength = benchmark->argumentLength;
+
+    // - Fill the code block with the pattern, then jump back to its start.
+    uint16_t address = GBT_BENCH_CODE_START;
+    const uint16_t end = GBT_BENCH_CODE_START + GBT_BENCH_CODE_SIZE - 3;
+    while (address + state->codeLength <= end)
+    {
+        for (size_t i = 0; i < state->codeLength; ++i)
+        {
+            gbWriteByte(state->context, address++, state->code[i], nullptr, nullptr);
+        }
+    }
+
+    gbWriteByte(state->context, address++, 0xC3, nullptr, nullptr);
+    gbWriteByte(state->context, address++, GBT_BENCH_CODE_START & 0xFF, nullptr, nullptr);
+    gbWriteByte(state->context, address++, GBT_BENCH_CODE_START >> 8, nullptr, nullptr);
+
+    // - Start at the top of the block, with `HL` and `SP` pointing into WRAM
+    //   and interrupts disabled.
+    gbDisableInterrupts(state->processor);
+    gbWriteByte(state->context, GB_PR_IE, 0x00, nullptr, nullptr);
+    return
+        gbWriteRegisterWord(state->processor, GB_RT_PC, GBT_BENCH_CODE_START) &&
+        gbWriteRegisterWord(state->processor, GB_RT_HL, GBT_BENCH_DATA_ADDRESS) &&
+        gbWriteRegisterWord(state->processor, GB_RT_SP, GBT_BENCH_STACK_ADDRESS);
+}
+
+void gbtRunInstruction (gbtBenchState* state, uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        gbTickProcessor(state->processor);
+    }
+}
+
+bool gbtSetupBus (gbtBenchState* state, const gbtBenchmark* benchmark)
+{
+    state->address = *(const uint16_t*) benchmark->argument;
+
+    // - Enable cartridge RAM and map bank 1, in case the benchmark needs it.
+    return
+        gbWriteByte(state->context, 0x0000, 0x0A, nullptr, nullptr) &&
+        gbWriteByte(state->context, 0x2000, 0x01, nullptr, nullptr);
+}
+
+void gbtRunBusRead (gbtBenchState* state, uint64_t iterations)
+{
+    uint8_t value = 0, sink = 0;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        gbReadByte(state->context, state->address + (i & 0x1F), &value, nullptr);
+        sink ^= value;
+    }
+
+    // - Keep the reads observable, so they are not optimized away.
+    volatile uint8_t observed = sink;
+    (void) observed;
+}
+
+void gbtRunBusWrite (gbtBenchState* state, uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        gbWriteByte(state->context, state->address + (i & 0x1F), (uint8_t) i,
+            nullptr, nullptr);
+    }
+}
+
+bool gbtSetupNothing (gbtBenchState* state, const gbtBenchmark* benchmark)
+{
+    return true;
+}
+
+void gbtRunTickTimer (gbtBenchState* state, uint64_t iterations)
+{
+    gbTimer* timer = gbGetTimer(state->context);
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        gbTickTimer(timer);
+    }
+}
+
+void gbtRunServiceInterrupt (gbtBenchState* state, uint64_t iterations)
+{
+    // - Each operation requests the timer interrupt and services it. The stack
+    //   pointer is reset periodically so that pushes stay within WRAM.
+    gbWriteByte(state->context, GB_PR_IE, 1 << GB_INT_TIMER, nullptr, nullptr);
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        if ((i & 0xFF) == 0)
+        {
+            gbWriteRegisterWord(state->processor, GB_RT_SP, GBT_BENCH_STACK_ADDRESS);
+        }
+
+        gbEnableInterrupts(state->processor, true);
+        gbRequestInterrupt(state->processor, GB_INT_TIMER);
+        gbServiceInterrupt(state->processor);
+    }
+
+    gbWriteByte(state->context, GB_PR_IE, 0x00, nullptr, nullptr);
+}
+
+bool gbtSetupBankSwitch (gbtBenchState* state, const gbtBenchmark* benchmark)
+{
+    uint8_t type = *(const uint8_t*) benchmark->argument;
+    gbCartridge* cartridge =
+        (type == 0x03) ? state->mbc1 :
+        (type == 0x13) ? state->mbc3 :
+                         state->mbc5;
+
+    // - Attaching a cartridge resets the context, so the other benchmarks
+    //   re-attach the MBC5 cartridge when this one is done.
+    return gbAttachCartridge(state->context, cartridge);
+}
+
+void gbtRunBankSwitch (gbtBenchState* state, uint64_t iterations)
+{
+    // - Each operation selects a ROM bank, then reads from it.
+    uint8_t value = 0, sink = 0;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        gbWriteByte(state->context, 0x2000, (uint8_t) ((i & 0x1F) + 1), nullptr,
+            nullptr);
+        gbReadByte(state->context, 0x4000, &value, nullptr);
+        sink ^= value;
+    }
+
+    volatile uint8_t observed = sink;
+    (void) observed;
+}
+
+bool gbtSetupTrace (gbtBenchState* state, const gbtBenchmark* benchmark)
+{
+    // - Both benchmarks run the same loop from ROM; only one records it.
+    bool traced = *(const bool*) benchmark->argument;
+    gbDisableInterrupts(state->processor);
+    gbWriteByte(state->context, GB_PR_IE, 0x00, nullptr, nullptr);
+    return
+        gbClearTrace(state->trace) &&
+        gbAttachTrace(state->context, (traced == true) ? state->trace : nullptr) &&
+        gbWriteRegisterWord(state->processor, GB_RT_PC, GBT_BENCH_ROM_LOOP_ADDRESS) &&
+        gbWriteRegisterWord(state->processor, GB_RT_HL, GBT_BENCH_DATA_ADDRESS) &&
+        gbWriteRegisterWord(state->processor, GB_RT_SP, GBT_BENCH_STACK_ADDRESS);
+}
+
+void gbtPrintTraceOverhead (const gbtBenchResult* results, size_t resultCount)
+{
+    // - Compare the median of the traced loop against the untraced one, if
+    //   both were run.
+    const gbtBenchResult* untraced = nullptr;
+    const gbtBenchResult* traced = nullptr;
+    for (size_t i = 0; i < resultCount; ++i)
+    {
+        if (strcmp(results[i].benchmark->group, "trace") != 0)
+        {
+            continue;
+        }
+        else if (strcmp(results[i].benchmark->name, "untraced") == 0)
+        {
+            untraced = &results[i];
+        }
+        else if (strcmp(results[i].benchmark->name, "traced") == 0)
+        {
+            traced = &results[i];
+        }
+    }
+
+    if (untraced != nullptr && traced != nullptr && untraced->median > 0.0)
+    {
+        printf("\nTrace overhead: %+.1f%% (median %.2f vs. %.2f ns/op).\n",
+            (traced->median / untraced->median - 1.0) * 100.0,
+            traced->median, untraced->median);
+    }
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtBenchCommand (int argc, char** argv)
+{
+    // - Parse the options.
+    uint64_t iterations = GBT_BENCH_DEFAULT_ITERATIONS;
+    uint64_t repetitions = GBT_BENCH_DEFAULT_REPETITIONS;
+    uint64_t warmup = GBT_BENCH_DEFAULT_WARMUP;
+    uint64_t pin = UINT64_MAX;
+    const char* filter = nullptr;
+    const char* jsonPath = nullptr;
+    bool listOnly = false;
+
+    for (int i = 0; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &iterations) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &repetitions) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &warmup) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--pin") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &pin) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            jsonPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            listOnly = true;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintBenchUsage();
+            return 1;
+        }
+    }
+
+    if (iterations == 0 || repetitions == 0)
+    {
+        fprintf(stderr, "--iterations and --reps must not be zero.\n");
+        return 1;
+    }
+
+    const size_t benchmarkCount = sizeof(GBT_BENCHMARKS) / sizeof(GBT_BENCHMARKS[0]);
+    if (listOnly == true)
+    {
+        for (size_t i = 0; i < benchmarkCount; ++i)
+        {
+            printf("%s/%s\n", GBT_BENCHMARKS[i].group, GBT_BENCHMARKS[i].name);
+        }
+
+        return 0;
+    }
+
+    // - Pin to a single processor, if requested, to reduce scheduling noise.
+    if (pin != UINT64_MAX && gbtPinToProcessor(pin) == false)
+    {
+        return 1;
+    }
+
+    // - Create the shared state.
+    int result = 1;
+    gbtBenchState state = { 0 };
+    gbtBenchResult* results = gbCreateZero(benchmarkCount, gbtBenchResult);
+    double* samples = gbCreateZero(repetitions, double);
+    state.context = gbCreateContext(false);
+    state.mbc1 = gbtCreateBenchCartridge(0x03);     // MBC1+RAM+BATTERY
+    state.mbc3 = gbtCreateBenchCartridge(0x13);     // MBC3+RAM+BATTERY
+    state.mbc5 = gbtCreateBenchCartridge(0x1B);     // MBC5+RAM+BATTERY
+    state.trace = gbCreateTrace(GBT_BENCH_TRACE_CAPACITY, GB_TF_NONE);
+    if (
+        results == nullptr || samples == nullptr || state.context == nullptr ||
+        state.mbc1 == nullptr || state.mbc3 == nullptr || state.mbc5 == nullptr ||
+        state.trace == nullptr
+    )
+    {
+        goto cleanup;
+    }
+
+    state.processor = gbGetProcessor(state.context);
+
+    printf("%-10s %-18s %12s %12s %12s\n", "group", "benchmark", "min ns/op",
+        "median", "mean");
+
+    size_t resultCount = 0;
+    for (size_t b = 0; b < benchmarkCount; ++b)
+    {
+        const gbtBenchmark* benchmark = &GBT_BENCHMARKS[b];
+        if (
+            filter != nullptr &&
+            strstr(benchmark->group, filter) == nullptr &&
+            strstr(benchmark->name, filter) == nullptr
+        )
+        {
+            continue;
+        }
+
+        // - Start each benchmark from a freshly reset, untraced context.
+        if (
+            gbAttachTrace(state.context, nullptr) == false ||
+            gbAttachCartridge(state.context, state.mbc5) == false ||
+            benchmark->setup(&state, benchmark) == false
+        )
+        {
+            fprintf(stderr, "Failed to set up benchmark '%s/%s'.\n",
+                benchmark->group, benchmark->name);
+            goto cleanup;
+        }
+
+        // - Warm up, then time each repetition.
+        benchmark->body(&state, warmup);
+        double total = 0.0;
+        for (uint64_t r = 0; r < repetitions; ++r)
+        {
+            double start = gbtGetSeconds();
+            benchmark->body(&state, iterations);
+            samples[r] = (gbtGetSeconds() - start) * 1e9 / (double) iterations;
+            total += samples[r];
+        }
+
+        qsort(samples, repetitions, sizeof(double), gbtCompareDoubles);
+        gbtBenchResult* entry = &results[resultCount++];
+        entry->benchmark = benchmark;
+        entry->minimum = samples[0];
+        entry->median = samples[repetitions / 2];
+        entry->mean = total / (double) repetitions;
+
+        printf("%-10s %-18s %12.2f %12.2f %12.2f\n", benchmark->group,
+            benchmark->name, entry->minimum, entry->median, entry->mean);
+    }
+
+    gbtPrintTraceOverhead(results, resultCount);
+
+    // - Write the JSON report, if requested.
+    if (jsonPath != nullptr)
+    {
+        FILE* fp = fopen(jsonPath, "w");
+        if (fp == nullptr)
+        {
+            gbLogErrno("Failed to open report file '%s' for writing", jsonPath);
+            goto cleanup;
+        }
+
+        fprintf(fp, "{\n  \"iterations\": %llu,\n  \"repetitions\": %llu,\n"
+            "  \"warmup\": %llu,\n  \"benchmarks\": [\n",
+            (unsigned long long) iterations, (unsigned long long) repetitions,
+            (unsigned long long) warmup);
+        for (size_t i = 0; i < resultCount; ++i)
+        {
+            fprintf(fp, "    { \"group\": \"%s\", \"name\": \"%s\", "
+                "\"min_ns\": %.3f, \"median_ns\": %.3f, \"mean_ns\": %.3f }%s\n",
+                results[i].benchmark->group, results[i].benchmark->name,
+                results[i].minimum, results[i].median, results[i].mean,
+                (i + 1 < resultCount) ? "," : "");
+        }
+
+        fprintf(fp, "  ]\n}\n");
+        fclose(fp);
+    }
+
+    result = 0;
+
+cleanup:
+    gbDestroyContext(state.context);
+    gbDestroyTrace(state.trace);
+    gbDestroyCartridge(state.mbc1);
+    gbDestroyCartridge(state.mbc3);
+    gbDestroyCartridge(state.mbc5);
+    gbDestroy(samples);
+    gbDestroy(results);
+    return result;
+}
@@ -0,0 +1,383 @@
+/**
+ * @file    GBT/BlockCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt block` subcommand, which
+ *          checks the core's block bus reads and writes against the same
+ *          accesses made a byte at a time.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+#include <GBT/ROMBuilder.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The bank a block write to the ROM area selects, unless it peeks.
+ */
+#define GBT_BLOCK_SELECTED_BANK     0x05
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines one check: a function run against a freshly created context
+ *          and cartridge, which returns whether the check passed.
+ */
+typedef struct gbtBlockCase
+{
+    const char* name;
+    bool        (*run) (gbContext* context);
+} gbtBlockCase;
+
+/**
+ * @brief   Defines a structure holding the last error the core logged.
+ */
+typedef struct gbtBlockLog
+{
+    char        lastError[256];
+} gbtBlockLog;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintBlockUsage ();
+static gbCartridge* gbtCreateBlockCartridge ();
+static void gbtFillBlockPattern (uint8_t* buffer, size_t length, uint8_t seed);
+static bool gbtMatchBlockRead (gbContext* context, uint16_t address,
+    size_t length);
+static bool gbtCheckReadWRAMBanks (gbContext* context);
+static bool gbtCheckReadWRAMEcho (gbContext* context);
+static bool gbtCheckReadSRAMWRAM (gbContext* context);
+static bool gbtCheckReadIOHRAM (gbContext* context);
+static bool gbtCheckReadROMBanks (gbContext* context);
+static bool gbtCheckWriteROMNone (gbContext* context);
+static bool gbtCheckWriteROMPeek (gbContext* context);
+static bool gbtCheckWriteSRAMWRAM (gbContext* context);
+static bool gbtCheckWriteHRAMNone (gbContext* context);
+static bool gbtCheckWriteHRAMPeek (gbContext* context);
+static bool gbtCheckPastEnd (gbContext* context);
+static void gbtCaptureBlockLog (gbLogLevel level, const char* message,
+    void* userdata);
+
+/* Private Static Variables ***************************************************/
+
+/**
+ * @brief   The error the core logs when a block runs past `$FFFF`.
+ */
+static const char* GBT_BLOCK_BOUNDS_ERROR = "runs past the end of the bus.";
+
+static const gbtBlockCase GBT_BLOCK_CASES[] = {
+    { "read/wram0-wramx",           gbtCheckReadWRAMBanks   },
+    { "read/wramx-echo",            gbtCheckReadWRAMEcho    },
+    { "read/sram-wram0",            gbtCheckReadSRAMWRAM    },
+    { "read/io-hram",               gbtCheckReadIOHRAM      },
+    { "read/rom0-romx",             gbtCheckReadROMBanks    },
+    { "write/rom-none",             gbtCheckWriteROMNone    },
+    { "write/rom-peek",             gbtCheckWriteROMPeek    },
+    { "write/sram-wram0",           gbtCheckWriteSRAMWRAM   },
+    { "write/hram-ie-none",         gbtCheckWriteHRAMNone   },
+    { "write/io-hram-peek",         gbtCheckWriteHRAMPeek   },
+    { "bounds/past-end",            gbtCheckPastEnd         }
+};
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintBlockUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt block\n"
+        "\n"
+        "Reads and writes spans which cross from one area of the address bus\n"
+        "into another with 'gbReadBlock' and 'gbWriteBlock', both as the CPU\n"
+        "would and as a peek, and checks them against the same accesses made\n"
+        "a byte at a time. Prints one line per case, and exits non-zero if any\n"
+        "case fails.\n"
+    );
+}
+
+gbCartridge* gbtCreateBlockCartridge ()
+{
+    // - 8 banks (128 KiB) of MBC5 ROM, and 8 KiB of RAM. Each ROMX bank is
+    //   filled with its own bank number, so that bank switches can be seen.
+    gbtROMBuilder builder;
+    if (gbtInitROMBuilder(&builder, "GBT BLOCK", 0x1B, 0x02, 0x02) == false)
+    {
+        return nullptr;
+    }
+
+    for (uint16_t bank = 1; bank < builder.bankCount; ++bank)
+    {
+        gbtFillROMBank(&builder, bank, (uint8_t) bank);
+    }
+
+    gbCartridge* cartridge = gbtFinishROMBuilder(&builder);
+    gbtFreeROMBuilder(&builder);
+    return cartridge;
+}
+
+void gbtFillBlockPattern (uint8_t* buffer, size_t length, uint8_t seed)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        buffer[i] = (uint8_t) (i * 13 + seed);
+    }
+}
+
+bool gbtMatchBlockRead (gbContext* context, uint16_t address, size_t length)
+{
+    // - Both kinds of block read must see what the CPU sees, a byte at a time.
+    uint8_t expected[GB_PAGE_SIZE] = { 0 };
+    uint8_t actual[GB_PAGE_SIZE] = { 0 };
+    gbAssert(length <= GB_PAGE_SIZE);
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        gbReadByte(context, (uint16_t) (address + i), &expected[i], nullptr);
+    }
+
+    const uint8_t flags[] = { GB_BF_NONE, GB_BF_PEEK };
+    for (size_t f = 0; f < sizeof(flags); ++f)
+    {
+        memset(actual, 0x00, sizeof(actual));
+        if (
+            gbReadBlock(context, address, length, actual, flags[f]) == false ||
+            memcmp(actual, expected, length) != 0
+        )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool gbtCheckReadWRAMBanks (gbContext* context)
+{
+    uint8_t pattern[0x40];
+    gbtFillBlockPattern(pattern, sizeof(pattern), 0x11);
+    return
+        gbWriteBlock(context, 0xCFE0, sizeof(pattern), pattern, GB_BF_NONE) &&
+        gbtMatchBlockRead(context, 0xCFE0, sizeof(pattern));
+}
+
+bool gbtCheckReadWRAMEcho (gbContext* context)
+{
+    // - The span runs from the top of WRAM into echo RAM, which mirrors the
+    //   bottom of WRAM.
+    uint8_t pattern[0x20];
+    gbtFillBlockPattern(pattern, sizeof(pattern), 0x22);
+    return
+        gbWriteBlock(context, 0xDFF0, 0x10, pattern, GB_BF_NONE) &&
+        gbWriteBlock(context, GB_WRAM0_START, 0x10, pattern + 0x10, GB_BF_NONE) &&
+        gbtMatchBlockRead(context, 0xDFF0, sizeof(pattern));
+}
+
+bool gbtCheckReadSRAMWRAM (gbContext* context)
+{
+    // - Enable cartridge RAM first; reads of it would otherwise be open-bus.
+    uint8_t pattern[0x20];
+    gbtFillBlockPattern(pattern, sizeof(pattern), 0x33);
+    return
+        gbWriteByte(context, 0x0000, 0x0A, nullptr, nullptr) &&
+        gbWriteBlock(context, 0xBFF0, sizeof(pattern), pattern, GB_BF_NONE) &&
+        gbtMatchBlockRead(context, 0xBFF0, sizeof(pattern));
+}
+
+bool gbtCheckReadIOHRAM (gbContext* context)
+{
+    uint8_t pattern[0x10];
+    gbtFillBlockPattern(pattern, sizeof(pattern), 0x44);
+    return
+        gbWriteBlock(context, GB_HRAM_START, sizeof(pattern), pattern,
+            GB_BF_NONE) &&
+        gbtMatchBlockRead(context, 0xFF70, 0x20);
+}
+
+bool gbtCheckReadROMBanks (gbContext* context)
+{
+    return gbtMatchBlockRead(context, 0x3FF0, 0x20);
+}
+
+bool gbtCheckWriteROMNone (gbContext* context)
+{
+    // - Written as the CPU would, the span reaches the MBC's bank register.
+    uint8_t banks[0x20];
+    uint8_t bank = 0x00;
+    memset(banks, GBT_BLOCK_SELECTED_BANK, sizeof(banks));
+    return
+        gbWriteBlock(context, 0x1FF0, sizeof(banks), banks, GB_BF_NONE) &&
+        gbReadByte(context, GB_ROMX_START, &bank, nullptr) &&
+        bank == GBT_BLOCK_SELECTED_BANK;
+}
+
+bool gbtCheckWriteROMPeek (gbContext* context)
+{
+    // - Poked, the same span must leave the MBC's bank register alone.
+    uint8_t banks[0x20];
+    uint8_t before = 0x00, after = 0x00;
+    memset(banks, GBT_BLOCK_SELECTED_BANK, sizeof(banks));
+    return
+        gbReadByte(context, GB_ROMX_START, &before, nullptr) &&
+        gbWriteBlock(context, 0x1FF0, sizeof(banks), banks, GB_BF_PEEK) &&
+        gbReadByte(context, GB_ROMX_START, &after, nullptr) &&
+        before != GBT_BLOCK_SELECTED_BANK && after == before;
+}
+
+bool gbtCheckWriteSRAMWRAM (gbContext* context)
+{
+    // - Both kinds of block write must land in cartridge RAM and WRAM alike.
+    if (gbWriteByte(context, 0x0000, 0x0A, nullptr, nullptr) == false)
+    {
+        return false;
+    }
+
+    const uint8_t flags[] = { GB_BF_NONE, GB_BF_PEEK };
+    for (size_t f = 0; f < sizeof(flags); ++f)
+    {
+        uint8_t pattern[0x20];
+        gbtFillBlockPattern(pattern, sizeof(pattern), (uint8_t) (0x55 + f));
+        if (gbWriteBlock(context, 0xBFF0, sizeof(pattern), pattern, flags[f]) == false)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < sizeof(pattern); ++i)
+        {
+            uint8_t value = 0x00;
+            gbReadByte(context, (uint16_t) (0xBFF0 + i), &value, nullptr);
+            if (value != pattern[i])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool gbtCheckWriteHRAMNone (gbContext* context)
+{
+    // - Written as the CPU would, the span runs from HRAM into `IE`.
+    const uint8_t values[] = { 0x5A, 0x1F };
+    uint8_t actual[2] = { 0 };
+    return
+        gbWriteBlock(context, 0xFFFE, sizeof(values), values, GB_BF_NONE) &&
+        gbReadBlock(context, 0xFFFE, sizeof(actual), actual, GB_BF_PEEK) &&
+        actual[0] == values[0] && (actual[1] & 0x1F) == values[1];
+}
+
+bool gbtCheckWriteHRAMPeek (gbContext* context)
+{
+    // - Poked, a span across the whole I/O page must write HRAM, and leave
+    //   every I/O register, `IE` included, as it was.
+    uint8_t before[GB_PAGE_SIZE] = { 0 };
+    uint8_t after[GB_PAGE_SIZE] = { 0 };
+    uint8_t pattern[GB_PAGE_SIZE];
+    gbtFillBlockPattern(pattern, sizeof(pattern), 0x66);
+    if (
+        gbReadBlock(context, 0xFF00, sizeof(before), before, GB_BF_PEEK) == false ||
+        gbWriteBlock(context, 0xFF00, sizeof(pattern), pattern, GB_BF_PEEK) == false ||
+        gbReadBlock(context, 0xFF00, sizeof(after), after, GB_BF_PEEK) == false
+    )
+    {
+        return false;
+    }
+
+    const size_t hram = GB_HRAM_START - 0xFF00;
+    return
+        memcmp(after, before, hram) == 0 &&
+        memcmp(after + hram, pattern + hram, GB_HRAM_SIZE) == 0 &&
+        after[GB_PAGE_SIZE - 1] == before[GB_PAGE_SIZE - 1];
+}
+
+bool gbtCheckPastEnd (gbContext* context)
+{
+    // - A span running past `$FFFF` must be refused, leaving the buffer as it
+    //   was.
+    uint8_t buffer[0x20];
+    memset(buffer, 0xA5, sizeof(buffer));
+    bool read = gbReadBlock(context, 0xFFF0, sizeof(buffer), buffer, GB_BF_NONE);
+    bool written = gbWriteBlock(context, 0xFFF0, sizeof(buffer), buffer,
+        GB_BF_PEEK);
+    for (size_t i = 0; i < sizeof(buffer); ++i)
+    {
+        if (buffer[i] != 0xA5)
+        {
+            return false;
+        }
+    }
+
+    return read == false && written == false;
+}
+
+void gbtCaptureBlockLog (gbLogLevel level, const char* message,
+    void* userdata)
+{
+    gbtBlockLog* log = userdata;
+    if (level == GB_LL_ERROR)
+    {
+        snprintf(log->lastError, sizeof(log->lastError), "%s", message);
+    }
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtBlockCommand (int argc, char** argv)
+{
+    (void) argv;
+    if (argc > 0)
+    {
+        gbtPrintBlockUsage();
+        return 1;
+    }
+
+    // - Capture the core's errors, rather than printing them, to check why
+    //   each span was refused.
+    gbtBlockLog log = { 0 };
+    gbSetLogSink(gbtCaptureBlockLog, &log);
+
+    size_t failed = 0;
+    const size_t caseCount =
+        sizeof(GBT_BLOCK_CASES) / sizeof(GBT_BLOCK_CASES[0]);
+    for (size_t i = 0; i < caseCount; ++i)
+    {
+        // - Each case starts from a fresh context and cartridge, so that no
+        //   case sees another's writes or bank switches.
+        gbContext* context = gbCreateContext(false);
+        gbCartridge* cartridge = gbtCreateBlockCartridge();
+        bool passed = false;
+        log.lastError[0] = '\0';
+        if (
+            context != nullptr && cartridge != nullptr &&
+            gbAttachCartridge(context, cartridge) == true
+        )
+        {
+            passed = GBT_BLOCK_CASES[i].run(context);
+        }
+
+        gbFlushLog();
+        if (GBT_BLOCK_CASES[i].run == gbtCheckPastEnd)
+        {
+            passed = passed &&
+                strstr(log.lastError, GBT_BLOCK_BOUNDS_ERROR) != nullptr;
+        }
+
+        printf("%-28s %s\n", GBT_BLOCK_CASES[i].name, passed ? "PASS" : "FAIL");
+        if (passed == false && log.lastError[0] != '\0')
+        {
+            printf("    %s\n", log.lastError);
+        }
+
+        failed += (passed == false);
+        gbDestroyContext(context);
+        gbDestroyCartridge(cartridge);
+    }
+
+    gbFlushLog();
+    gbSetLogSink(nullptr, nullptr);
+    printf("%zu of %zu cases passed.\n", caseCount - failed, caseCount);
+    return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,249 @@
+/**
+ * @file    GBT/Commands.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for the subcommands provided by the Game Boy
+ *          Emulator Core Library Test Suite (`gbt`).
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/GB.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+/* Public Types and Forward Declarations **************************************/
+
+/**
+ * @brief   Defines a pointer to a function implementing one of `gbt`'s
+ *          subcommands.
+ *
+ * @param   argc    The number of arguments following the subcommand's name.
+ * @param   argv    The arguments following the subcommand's name.
+ *
+ * @return  The process exit code: `0` on success, non-zero on failure.
+ */
+typedef int (*gbtCommandFunction) (int argc, char** argv);
+
+/**
+ * @brief   Defines a structure holding a growable list of file paths, as
+ *          collected from the command line by @a `gbtCollectFiles`.
+ */
+typedef struct gbtFileList
+{
+    char**  paths;
+    size_t  count;
+    size_t  capacity;
+} gbtFileList;
+
+/**
+ * @brief   Defines a structure holding a queue of jobs, numbered from zero,
+ *          which the worker threads started by @a `gbtRunWorkers` take from in
+ *          turn with @a `gbtTakeJob`.
+ */
+typedef struct gbtWorkQueue
+{
+    size_t          jobCount;
+    atomic_size_t   nextJob;
+} gbtWorkQueue;
+
+/* Public Function Declarations - Subcommands *********************************/
+
+/**
+ * @brief   Implements the `gbt trace` subcommand, which records, decodes and
+ *          diffs binary execution trace dumps.
+ */
+int gbtTraceCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt bench` subcommand, which runs microbenchmarks
+ *          against the core and reports their cost in nanoseconds per operation.
+ */
+int gbtBenchCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt run` subcommand, which runs test ROMs headless
+ *          across worker threads and reports whether each one passed.
+ */
+int gbtRunCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt lockstep` subcommand, which runs a ROM in a
+ *          reference-mode context and a normal context side by side, and
+ *          reports the first divergence between them.
+ */
+int gbtLockstepCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt sm83` subcommand, which runs single-step SM83
+ *          JSON test vectors against the processor across worker threads.
+ */
+int gbtSM83Command (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt coverage` subcommand, which runs a ROM with an
+ *          execution coverage bitmap attached, and reports, saves or merges
+ *          the ROM bytes it reached.
+ */
+int gbtCoverageCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt framehash` subcommand, which runs ROMs across
+ *          worker threads, hashes their state every few frames, and records or
+ *          checks those hashes against a golden file.
+ */
+int gbtFrameHashCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt profile` subcommand, which runs a ROM with a
+ *          guest code profiler attached, and reports the symbols it spent the
+ *          most cycles in.
+ */
+int gbtProfileCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt workload` subcommand, which generates synthetic
+ *          benchmark ROMs and reports how fast the core runs them, in frames
+ *          per second and millions of instructions per second.
+ */
+int gbtWorkloadCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt library` subcommand, which indexes a directory
+ *          tree of ROMs across worker threads, keeping the index in a file so
+ *          that later runs only read new or changed ROMs.
+ */
+int gbtLibraryCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt patch` subcommand, which applies built-in BPS
+ *          patches to a generated image, checking that well-formed patches
+ *          apply and that malformed ones are refused without harm.
+ */
+int gbtPatchCommand (int argc, char** argv);
+
+/**
+ * @brief   Implements the `gbt block` subcommand, which checks block reads and
+ *          writes of the address bus, both as the CPU would make them and as
+ *          peeks, against the same accesses made a byte at a time.
+ */
+int gbtBlockCommand (int argc, char** argv);
+
+/* Public Function Declarations - Helper Functions ****************************/
+
+/**
+ * @brief   Parses an unsigned integer command-line argument, accepting both
+ *          decimal and `0x`-prefixed hexadecimal notation.
+ *
+ * @param   text        The argument text to be parsed.
+ * @param   outValue    A pointer to a variable where the parsed value will be
+ *                      stored.
+ *
+ * @return  If the whole argument was parsed successfully, returns `true`.
+ *          Otherwise, prints an error and returns `false`.
+ */
+bool gbtParseUnsigned (const char* text, uint64_t* outValue);
+
+/**
+ * @brief   Retrieves the current value of a monotonic clock, for measuring
+ *          elapsed wall-clock time.
+ *
+ * @return  The current time, in seconds, relative to an unspecified epoch.
+ */
+double gbtGetSeconds ();
+
+/**
+ * @brief   Retrieves the number of logical processors available to `gbt`, for
+ *          use as the default number of worker threads.
+ *
+ * @return  The number of logical processors, or `1` if it cannot be determined.
+ */
+size_t gbtGetProcessorCount ();
+
+/**
+ * @brief   Adds the given path to a file list, if it names a file; or, if it
+ *          names a directory, every file beneath it, recursively, whose
+ *          extension is in the given list.
+ *
+ * @param   path        The file or directory path named on the command line.
+ *                      A file is added whatever its extension.
+ * @param   extensions  A `nullptr`-terminated array of lowercase extensions,
+ *                      without their dots (e.g., `"gb"`), to collect from
+ *                      directories.
+ * @param   list        A pointer to the @a `gbtFileList` to add paths to.
+ *
+ * @return  If successful, returns `true`.
+ *          If the path does not exist, or allocation fails, returns `false`.
+ */
+bool gbtCollectFiles (const char* path, const char* const* extensions,
+    gbtFileList* list);
+
+/**
+ * @brief   Sorts the paths in a file list, so that reports are stable from run
+ *          to run.
+ */
+void gbtSortFileList (gbtFileList* list);
+
+/**
+ * @brief   Frees every path in a file list, and the list itself.
+ */
+void gbtFreeFileList (gbtFileList* list);
+
+/**
+ * @brief   Runs the given worker function on up to the given number of threads,
+ *          and waits for them all to return. Each worker takes jobs from the
+ *          queue with @a `gbtTakeJob` until it is empty.
+ *
+ * No more workers are started than there are jobs. If a thread cannot be
+ * started, the jobs are left to those which were; if none could be, the
+ * worker function is run on the calling thread instead.
+ *
+ * @param   queue       A pointer to the @a `gbtWorkQueue` to be drained. Its
+ *                      @a `jobCount` must be set; its next job is reset here.
+ * @param   workerCount The number of worker threads requested. `0` is taken
+ *                      as `1`.
+ * @param   worker      The function each worker thread runs.
+ * @param   argument    The argument passed to each worker thread.
+ *
+ * @return  The number of workers which ran, which is always at least `1`.
+ */
+size_t gbtRunWorkers (gbtWorkQueue* queue, size_t workerCount,
+    thrd_start_t worker, void* argument);
+
+/**
+ * @brief   Takes the next job from a work queue.
+ *
+ * @param   queue       A pointer to the @a `gbtWorkQueue` to take from.
+ * @param   outIndex    A pointer to a variable where the job's index will be
+ *                      stored.
+ *
+ * @return  If a job was taken, returns `true`.
+ *          If the queue is empty, returns `false`.
+ */
+bool gbtTakeJob (gbtWorkQueue* queue, size_t* outIndex);
+
+/**
+ * @brief   Looks for the RGBDS `.sym` file beside a ROM: the ROM's path, with
+ *          its extension replaced by `.sym`, as written by `rgblink -n`.
+ *
+ * @param   romPath     The path of the ROM.
+ *
+ * @return  If the `.sym` file exists, returns its path, which the caller must
+ *          free with @a `gbDestroy`. Otherwise, returns `nullptr`.
+ */
+char* gbtFindSymbolFile (const char* romPath);
+
+/**
+ * @brief   Prints a single trace record as one line of decoded text: its cycle,
+ *          bank and address, and either the instruction's mnemonic and a few
+ *          registers or the bus access.
+ *
+ * @param   prefix      Text printed at the start of the line (e.g., `"< "`).
+ * @param   index       The record's index, printed after the prefix.
+ * @param   record      A pointer to the @a `gbTraceRecord` to print.
+ */
+void gbtPrintTraceRecord (const char* prefix, size_t index,
+    const gbTraceRecord* record);
@@ -0,0 +1,221 @@
+/**
+ * @file    GBT/CoverageCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt coverage` subcommand, which
+ *          runs a ROM headless with an execution coverage bitmap attached, and
+ *          reports, saves or merges the ROM bytes it reached.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The number of T-cycles in one frame, at the normal-speed clock rate.
+ */
+#define GBT_COVERAGE_FRAME_CYCLES   70224ull
+
+/**
+ * @brief   The default number of frames to run.
+ */
+#define GBT_COVERAGE_DEFAULT_FRAMES 600ull
+
+/**
+ * @brief   The size of one cartridge ROM bank, in bytes.
+ */
+#define GBT_COVERAGE_BANK_SIZE      0x4000
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintCoverageUsage ();
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintCoverageUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt coverage <rom> [--frames N] [--merge FILE]... [--save FILE]\n"
+        "                     [--lcov FILE] [--sym FILE]\n"
+        "\n"
+        "Runs <rom> for --frames frames (0 to skip running), marking every ROM\n"
+        "byte fetched as an opcode, and prints how many were reached per bank.\n"
+        "--merge adds the bits of an earlier --save file of the same ROM, so a\n"
+        "corpus of runs can be combined. --save writes the merged bitmap, and\n"
+        "--lcov writes it as an LCOV tracefile whose functions are the symbols\n"
+        "read from --sym, or else from the .sym file next to <rom>.\n"
+    );
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtCoverageCommand (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintCoverageUsage();
+        return 1;
+    }
+
+    // - Parse the options. Merge files are collected in place, from `argv`.
+    uint64_t frames = GBT_COVERAGE_DEFAULT_FRAMES;
+    const char* symPath = nullptr;
+    const char* savePath = nullptr;
+    const char* lcovPath = nullptr;
+    const char** mergePaths = gbCreateZero((size_t) argc, const char*);
+    size_t mergeCount = 0;
+    if (mergePaths == nullptr)
+    {
+        fprintf(stderr, "Error allocating memory for the merge file list.\n");
+        return 1;
+    }
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &frames) == false)
+            {
+                gbDestroy(mergePaths);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--merge") == 0 && i + 1 < argc)
+        {
+            mergePaths[mergeCount++] = argv[++i];
+        }
+        else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc)
+        {
+            savePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--lcov") == 0 && i + 1 < argc)
+        {
+            lcovPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--sym") == 0 && i + 1 < argc)
+        {
+            symPath = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintCoverageUsage();
+            gbDestroy(mergePaths);
+            return 1;
+        }
+    }
+
+    // - Create the context and cartridge, and a coverage bitmap sized to the
+    //   cartridge's ROM.
+    int result = 1;
+    char* defaultSymPath = nullptr;
+    gbSymbolTable* symbols = nullptr;
+    gbCoverage* coverage = nullptr;
+    gbContext* context = gbCreateContext(false);
+    gbCartridge* cartridge = gbCreateCartridge(argv[0]);
+    if (
+        context == nullptr || cartridge == nullptr ||
+        gbAttachCartridge(context, cartridge) == false
+    )
+    {
+        goto cleanup;
+    }
+
+    coverage = gbCreateCoverage(
+        gbGetCartridgeROMSize(gbGetCartridgeHeader(cartridge)));
+    if (coverage == nullptr || gbAttachCoverage(context, coverage) == false)
+    {
+        goto cleanup;
+    }
+
+    for (size_t i = 0; i < mergeCount; ++i)
+    {
+        if (gbLoadCoverage(coverage, mergePaths[i]) == false) { goto cleanup; }
+        printf("Merged coverage from '%s'.\n", mergePaths[i]);
+    }
+
+    // - Run the ROM. A ROM which locks up has reached all it is going to.
+    if (frames > 0)
+    {
+        double start = gbtGetSeconds();
+        gbStopReason reason = GB_SR_TICK_BUDGET;
+        if (gbRun(context, frames * GBT_COVERAGE_FRAME_CYCLES, &reason) == false)
+        {
+            fprintf(stderr, "The ROM stopped with an emulation error.\n");
+        }
+        else if (reason != GB_SR_TICK_BUDGET)
+        {
+            printf("The ROM stopped early: %s.\n", gbStringifyStopReason(reason));
+        }
+
+        printf("Ran %llu frames in %.2fs.\n", (unsigned long long) frames,
+            gbtGetSeconds() - start);
+    }
+
+    // - Print the per-bank summary, skipping banks never reached.
+    size_t romSize = gbGetCoverageROMSize(coverage);
+    size_t total = gbCountCoverage(coverage);
+    printf("\n  %-6s  %10s  %8s\n", "Bank", "Opcodes", "Bytes %");
+    for (size_t bank = 0; bank < romSize / GBT_COVERAGE_BANK_SIZE; ++bank)
+    {
+        size_t count = gbCountCoverageBank(coverage, bank);
+        if (count > 0)
+        {
+            printf("  $%-5zX  %10zu  %7.2f%%\n", bank, count,
+                100.0 * (double) count / GBT_COVERAGE_BANK_SIZE);
+        }
+    }
+
+    printf("\nReached %zu opcode bytes of a %zu-byte ROM (%.2f%%).\n", total,
+        romSize, 100.0 * (double) total / (double) romSize);
+
+    if (savePath != nullptr)
+    {
+        if (gbSaveCoverage(coverage, savePath) == false) { goto cleanup; }
+        printf("Wrote coverage bitmap to '%s'.\n", savePath);
+    }
+
+    if (lcovPath != nullptr)
+    {
+        // - Symbols are optional; without them, the tracefile has lines only.
+        if (symPath == nullptr)
+        {
+            defaultSymPath = gbtFindSymbolFile(argv[0]);
+            symPath = defaultSymPath;
+        }
+
+        if (symPath != nullptr)
+        {
+            symbols = gbCreateSymbolTable();
+            if (symbols == nullptr || gbLoadSymbolTable(symbols, symPath) == false)
+            {
+                goto cleanup;
+            }
+
+            printf("Loaded %zu symbols from '%s'.\n", gbGetSymbolCount(symbols),
+                symPath);
+        }
+
+        if (gbSaveCoverageLCOV(coverage, lcovPath, argv[0], symbols) == false)
+        {
+            goto cleanup;
+        }
+
+        printf("Wrote LCOV tracefile to '%s'.\n", lcovPath);
+    }
+
+    result = 0;
+
+cleanup:
+    gbDestroyContext(context);
+    gbDestroyCartridge(cartridge);
+    gbDestroyCoverage(coverage);
+    gbDestroySymbolTable(symbols);
+    gbDestroy(defaultSymPath);
+    gbDestroy(mergePaths);
+    return result;
+}
@@ -0,0 +1,493 @@
+/**
+ * @file    GBT/FrameHashCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt framehash` subcommand, which
+ *          runs ROMs headless across worker threads, hashes their state every
+ *          few frames, and records or checks those hashes against a golden
+ *          file.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The number of T-cycles in one frame, at the normal-speed clock rate.
+ */
+#define GBT_FRAMEHASH_FRAME_CYCLES      70224ull
+
+/**
+ * @brief   The default number of frames each ROM is run for.
+ */
+#define GBT_FRAMEHASH_DEFAULT_FRAMES    3600ull
+
+/**
+ * @brief   The default interval, in frames, between hashes.
+ */
+#define GBT_FRAMEHASH_DEFAULT_INTERVAL  60ull
+
+/**
+ * @brief   The maximum length of a golden file line.
+ */
+#define GBT_FRAMEHASH_LINE_CAPACITY     4096
+
+/**
+ * @brief   The first line of every golden file, followed by the frame count and
+ *          hash interval it was recorded with.
+ */
+#define GBT_FRAMEHASH_MAGIC             "# gbt framehash v1"
+
+/**
+ * @brief   The extensions of the files collected from directories.
+ */
+static const char* const GBT_FRAMEHASH_EXTENSIONS[] = { "gb", "gbc", nullptr };
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding a ROM to be run, its recorded hashes,
+ *          and the golden hashes they are checked against.
+ */
+typedef struct gbtFrameHashJob
+{
+    const char* path;               // Owned by the command's file list.
+    uint64_t*   hashes;             // One per checkpoint.
+    uint64_t*   golden;             // One per checkpoint; checking only.
+    bool*       hasGolden;          // Which checkpoints the golden file covers.
+    bool        error;              // Set if the ROM could not be loaded or run.
+    const char* stopReason;         // Set if the ROM reached a terminal state.
+    uint64_t    stopFrame;
+    size_t      mismatch;           // The first mismatched checkpoint, or `SIZE_MAX`.
+    double      seconds;
+} gbtFrameHashJob;
+
+/**
+ * @brief   Defines a structure holding the settings and work queue shared by
+ *          all worker threads.
+ */
+typedef struct gbtFrameHashQueue
+{
+    gbtFrameHashJob*    jobs;
+    gbtWorkQueue        work;
+    uint64_t            frames;
+    uint64_t            interval;
+    size_t              checkpoints;
+} gbtFrameHashQueue;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintFrameHashUsage ();
+static bool gbtHashFrameState (gbContext* context, uint64_t* outHash);
+static void gbtExecuteFrameHashJob (gbtFrameHashJob* job,
+    const gbtFrameHashQueue* queue);
+static int gbtFrameHashWorker (void* argument);
+static int gbtCompareFrameHashJobs (const void* a, const void* b);
+static bool gbtWriteGoldenFile (const char* filepath,
+    const gbtFrameHashQueue* queue);
+static bool gbtReadGoldenFile (const char* filepath, gbtFrameHashQueue* queue);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintFrameHashUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt framehash <rom-or-directory>... --golden FILE [--record]\n"
+        "                [--frames N] [--every N] [--jobs N]\n"
+        "\n"
+        "Runs each ROM for --frames frames, hashing its processor registers,\n"
+        "work RAM, high RAM and cartridge RAM every --every frames. With\n"
+        "--record, the hashes are written to the golden file; otherwise they\n"
+        "are checked against it, and the first mismatched frame of each ROM\n"
+        "is reported. Directories are searched recursively for '.gb' and\n"
+        "'.gbc' files. Input movies are not supported, since the core has no\n"
+        "joypad to play them into.\n"
+    );
+}
+
+bool gbtHashFrameState (gbContext* context, uint64_t* outHash)
+{
+    // - There is no frame buffer to hash yet, so the registers and memory
+    //   stand in for the picture.
+    uint64_t memoryHash = 0;
+    const gbProcessorRegisterFile* registers =
+        gbGetRegisterFile(gbGetProcessor(context));
+    if (registers == nullptr || gbHashContextMemory(context, &memoryHash) == false)
+    {
+        return false;
+    }
+
+    *outHash = gbHash64(registers, sizeof(*registers), memoryHash);
+    return true;
+}
+
+void gbtExecuteFrameHashJob (gbtFrameHashJob* job,
+    const gbtFrameHashQueue* queue)
+{
+    double start = gbtGetSeconds();
+    job->error = true;
+
+    // - Each job gets a context of its own, owned by this worker thread.
+    gbContext* context = gbCreateContext(false);
+    gbCartridge* cartridge = gbCreateCartridge(job->path);
+    if (
+        context == nullptr || cartridge == nullptr ||
+        gbAttachCartridge(context, cartridge) == false
+    )
+    {
+        goto cleanup;
+    }
+
+    // - A real-time clock read from the wall clock would make the hashes vary
+    //   from run to run.
+    gbSetCartridgeRTCClock(cartridge, GB_RTC_EMULATED_CLOCK);
+
+    // - Run up to each checkpoint exactly, so that hashes are taken at the
+    //   same cycle count regardless of how the last instruction lands. A ROM
+    //   which reaches a terminal state keeps that state for the rest of the
+    //   run, and is hashed as such.
+    gbProcessor* processor = gbGetProcessor(context);
+    for (size_t i = 0; i < queue->checkpoints; ++i)
+    {
+        uint64_t frame = (i + 1) * queue->interval;
+        uint64_t target = frame * GBT_FRAMEHASH_FRAME_CYCLES;
+        while (job->stopReason == nullptr && gbGetTickCyclesConsumed(processor) < target)
+        {
+            gbStopReason reason = GB_SR_TICK_BUDGET;
+            if (
+                gbRun(context, target - gbGetTickCyclesConsumed(processor),
+                    &reason) == false
+            )
+            {
+                goto cleanup;
+            }
+
+            if (reason == GB_SR_SELF_JUMP || reason == GB_SR_HALT || reason == GB_SR_STOP)
+            {
+                job->stopReason = gbStringifyStopReason(reason);
+                job->stopFrame = gbGetTickCyclesConsumed(processor) /
+                    GBT_FRAMEHASH_FRAME_CYCLES;
+            }
+        }
+
+        if (gbtHashFrameState(context, &job->hashes[i]) == false)
+        {
+            goto cleanup;
+        }
+    }
+
+    job->error = false;
+
+cleanup:
+    gbDestroyContext(context);
+    gbDestroyCartridge(cartridge);
+    job->seconds = gbtGetSeconds() - start;
+}
+
+int gbtFrameHashWorker (void* argument)
+{
+    gbtFrameHashQueue* queue = argument;
+
+    // - Pull jobs off the shared queue until it is empty.
+    size_t index;
+    while (gbtTakeJob(&queue->work, &index) == true)
+    {
+        gbtFrameHashJob* job = &queue->jobs[index];
+        gbtExecuteFrameHashJob(job, queue);
+        printf("[%-5s] %6.2fs  %s\n", (job->error == true) ? "error" : "done",
+            job->seconds, job->path);
+    }
+
+    return 0;
+}
+
+int gbtCompareFrameHashJobs (const void* a, const void* b)
+{
+    return strcmp(((const gbtFrameHashJob*) a)->path,
+        ((const gbtFrameHashJob*) b)->path);
+}
+
+bool gbtWriteGoldenFile (const char* filepath, const gbtFrameHashQueue* queue)
+{
+    FILE* fp = fopen(filepath, "w");
+    gbCheckpv(fp != nullptr, false, "Failed to open golden file '%s' for writing",
+        filepath);
+
+    // - One line per checkpoint: the frame, the hash, then the ROM path, which
+    //   comes last so that it may contain spaces.
+    fprintf(fp, GBT_FRAMEHASH_MAGIC " frames=%llu every=%llu\n",
+        (unsigned long long) queue->frames, (unsigned long long) queue->interval);
+    for (size_t i = 0; i < queue->work.jobCount; ++i)
+    {
+        const gbtFrameHashJob* job = &queue->jobs[i];
+        if (job->error == true)
+        {
+            continue;
+        }
+
+        for (size_t j = 0; j < queue->checkpoints; ++j)
+        {
+            fprintf(fp, "%llu %016llX %s\n",
+                (unsigned long long) ((j + 1) * queue->interval),
+                (unsigned long long) job->hashes[j], job->path);
+        }
+    }
+
+    fclose(fp);
+    return true;
+}
+
+bool gbtReadGoldenFile (const char* filepath, gbtFrameHashQueue* queue)
+{
+    FILE* fp = fopen(filepath, "r");
+    gbCheckpv(fp != nullptr, false, "Failed to open golden file '%s'", filepath);
+
+    // - The golden file must have been recorded with the same settings, or
+    //   its checkpoints will not line up.
+    char line[GBT_FRAMEHASH_LINE_CAPACITY];
+    unsigned long long frames = 0, interval = 0;
+    if (
+        fgets(line, sizeof(line), fp) == nullptr ||
+        sscanf(line, GBT_FRAMEHASH_MAGIC " frames=%llu every=%llu", &frames,
+            &interval) != 2
+    )
+    {
+        fprintf(stderr, "'%s' is not a golden file.\n", filepath);
+        fclose(fp);
+        return false;
+    }
+    else if (frames != queue->frames || interval != queue->interval)
+    {
+        fprintf(stderr, "'%s' was recorded with --frames %llu --every %llu.\n",
+            filepath, frames, interval);
+        fclose(fp);
+        return false;
+    }
+
+    // - Entries for ROMs which are not being run are ignored.
+    while (fgets(line, sizeof(line), fp) != nullptr)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+
+        unsigned long long frame = 0, hash = 0;
+        int pathOffset = 0;
+        if (
+            sscanf(line, "%llu %llx %n", &frame, &hash, &pathOffset) != 2 ||
+            pathOffset == 0 || frame == 0 || frame % interval != 0 ||
+            frame / interval > queue->checkpoints
+        )
+        {
+            continue;
+        }
+
+        gbtFrameHashJob key = { .path = line + pathOffset };
+        gbtFrameHashJob* job = bsearch(&key, queue->jobs, queue->work.jobCount,
+            sizeof(gbtFrameHashJob), gbtCompareFrameHashJobs);
+        if (job != nullptr)
+        {
+            size_t checkpoint = (size_t) (frame / interval) - 1;
+            job->golden[checkpoint] = (uint64_t) hash;
+            job->hasGolden[checkpoint] = true;
+        }
+    }
+
+    fclose(fp);
+    return true;
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtFrameHashCommand (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintFrameHashUsage();
+        return 1;
+    }
+
+    // - Parse the options, and collect the ROMs named by the other arguments.
+    gbtFrameHashQueue queue = {
+        .frames = GBT_FRAMEHASH_DEFAULT_FRAMES,
+        .interval = GBT_FRAMEHASH_DEFAULT_INTERVAL
+    };
+    uint64_t workerCount = (uint64_t) gbtGetProcessorCount();
+    const char* goldenPath = nullptr;
+    bool record = false;
+    gbtFileList roms = { 0 };
+    int result = 1;
+
+    for (int i = 0; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc)
+        {
+            goldenPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--record") == 0)
+        {
+            record = true;
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &queue.frames) == false) { goto cleanup; }
+        }
+        else if (strcmp(argv[i], "--every") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &queue.interval) == false) { goto cleanup; }
+        }
+        else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &workerCount) == false) { goto cleanup; }
+        }
+        else if (strncmp(argv[i], "--", 2) == 0)
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintFrameHashUsage();
+            goto cleanup;
+        }
+        else if (gbtCollectFiles(argv[i], GBT_FRAMEHASH_EXTENSIONS, &roms) == false)
+        {
+            goto cleanup;
+        }
+    }
+
+    if (goldenPath == nullptr)
+    {
+        fprintf(stderr, "No golden file given; pass one with --golden.\n");
+        goto cleanup;
+    }
+    else if (queue.interval == 0 || queue.frames < queue.interval)
+    {
+        fprintf(stderr, "--every must be non-zero, and no more than --frames.\n");
+        goto cleanup;
+    }
+    else if (roms.count == 0)
+    {
+        fprintf(stderr, "No ROMs found.\n");
+        goto cleanup;
+    }
+
+    // - Sort the ROMs, so that golden files are stable and can be searched,
+    //   then create a job for each, with room for its hashes.
+    gbtSortFileList(&roms);
+    queue.checkpoints = (size_t) (queue.frames / queue.interval);
+    queue.jobs = gbCreateZero(roms.count, gbtFrameHashJob);
+    if (queue.jobs == nullptr)
+    {
+        gbLogErrno("Error allocating memory for frame hash jobs");
+        goto cleanup;
+    }
+
+    queue.work.jobCount = roms.count;
+    for (size_t i = 0; i < roms.count; ++i)
+    {
+        gbtFrameHashJob* job = &queue.jobs[i];
+        job->path = roms.paths[i];
+        job->mismatch = SIZE_MAX;
+        job->hashes = gbCreateZero(queue.checkpoints, uint64_t);
+        job->golden = gbCreateZero(queue.checkpoints, uint64_t);
+        job->hasGolden = gbCreateZero(queue.checkpoints, bool);
+        if (job->hashes == nullptr || job->golden == nullptr || job->hasGolden == nullptr)
+        {
+            gbLogErrno("Error allocating memory for frame hashes");
+            goto cleanup;
+        }
+    }
+
+    // - Load the golden hashes before running anything, so that a bad golden
+    //   file fails fast.
+    if (record == false && gbtReadGoldenFile(goldenPath, &queue) == false)
+    {
+        goto cleanup;
+    }
+
+    // - Spawn the workers, then wait for them to drain the queue.
+    double start = gbtGetSeconds();
+    gbtRunWorkers(&queue.work, (size_t) workerCount, gbtFrameHashWorker,
+        &queue);
+    double seconds = gbtGetSeconds() - start;
+
+    // - Count the errors, and in checking mode, find each ROM's first
+    //   mismatched checkpoint.
+    size_t errors = 0, mismatches = 0, missing = 0;
+    for (size_t i = 0; i < queue.work.jobCount; ++i)
+    {
+        gbtFrameHashJob* job = &queue.jobs[i];
+        if (job->error == true)
+        {
+            errors++;
+            continue;
+        }
+        else if (record == true)
+        {
+            continue;
+        }
+        else if (job->hasGolden[0] == false)
+        {
+            printf("  %s: not in the golden file\n", job->path);
+            missing++;
+            continue;
+        }
+
+        for (size_t j = 0; j < queue.checkpoints; ++j)
+        {
+            if (job->hasGolden[j] == false || job->hashes[j] != job->golden[j])
+            {
+                job->mismatch = j;
+                break;
+            }
+        }
+
+        if (job->mismatch != SIZE_MAX)
+        {
+            size_t j = job->mismatch;
+            printf("  %s: mismatch at frame %llu (%016llX, expected %016llX)",
+                job->path, (unsigned long long) ((j + 1) * queue.interval),
+                (unsigned long long) job->hashes[j],
+                (unsigned long long) job->golden[j]);
+            if (job->stopReason != nullptr)
+            {
+                printf(" after %s at frame %llu", job->stopReason,
+                    (unsigned long long) job->stopFrame);
+            }
+
+            printf("\n");
+            mismatches++;
+        }
+    }
+
+    if (record == true)
+    {
+        if (gbtWriteGoldenFile(goldenPath, &queue) == false)
+        {
+            goto cleanup;
+        }
+
+        printf("\nRecorded %zu checkpoint(s) for %zu of %zu ROM(s) to '%s' in "
+            "%.2fs.\n", queue.checkpoints, queue.work.jobCount - errors,
+            queue.work.jobCount, goldenPath, seconds);
+    }
+    else
+    {
+        printf("\n%zu matched, %zu mismatched, %zu missing, %zu error(s) in "
+            "%.2fs.\n", queue.work.jobCount - errors - mismatches - missing,
+            mismatches, missing, errors, seconds);
+    }
+
+    result = (errors == 0 && mismatches == 0 && missing == 0) ? 0 : 1;
+
+cleanup:
+    for (size_t i = 0; queue.jobs != nullptr && i < queue.work.jobCount; ++i)
+    {
+        gbDestroy(queue.jobs[i].hashes);
+        gbDestroy(queue.jobs[i].golden);
+        gbDestroy(queue.jobs[i].hasGolden);
+    }
+
+    gbDestroy(queue.jobs);
+    gbtFreeFileList(&roms);
+    return result;
+}
@@ -0,0 +1,432 @@
+/**
+ * @file    GBT/JSON.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for `gbt`'s minimal JSON reader.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/JSON.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The maximum nesting depth of arrays and objects.
+ */
+#define GBT_JSON_MAX_DEPTH 64
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding the state of a parse in progress.
+ */
+typedef struct gbtJSONParser
+{
+    gbtJSONDocument*    document;
+    char*               cursor;
+    const char*         filepath;
+    size_t              depth;
+} gbtJSONParser;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtSkipJSONWhitespace (gbtJSONParser* parser);
+static bool gbtFailJSON (gbtJSONParser* parser, const char* message);
+static size_t gbtAddJSONNode (gbtJSONParser* parser, gbtJSONType type);
+static bool gbtParseJSONString (gbtJSONParser* parser, const char** outString);
+static bool gbtParseJSONValue (gbtJSONParser* parser, size_t* outIndex);
+static bool gbtParseJSONContainer (gbtJSONParser* parser, size_t index,
+    bool isObject);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtSkipJSONWhitespace (gbtJSONParser* parser)
+{
+    while (
+        *parser->cursor == ' ' || *parser->cursor == '\t' ||
+        *parser->cursor == '\n' || *parser->cursor == '\r'
+    )
+    {
+        parser->cursor++;
+    }
+}
+
+bool gbtFailJSON (gbtJSONParser* parser, const char* message)
+{
+    fprintf(stderr, "%s: offset %zu: %s\n", parser->filepath,
+        (size_t) (parser->cursor - parser->document->text), message);
+    return false;
+}
+
+size_t gbtAddJSONNode (gbtJSONParser* parser, gbtJSONType type)
+{
+    gbtJSONDocument* document = parser->document;
+    if (document->nodeCount == document->nodeCapacity)
+    {
+        size_t newCapacity =
+            (document->nodeCapacity == 0) ? 1024 : document->nodeCapacity * 2;
+        gbtJSONNode* newNodes = gbResize(document->nodes, newCapacity, gbtJSONNode);
+        gbCheckpv(newNodes != nullptr, SIZE_MAX, "Error allocating memory for JSON nodes");
+
+        document->nodes = newNodes;
+        document->nodeCapacity = newCapacity;
+    }
+
+    size_t index = document->nodeCount++;
+    document->nodes[index] = (gbtJSONNode) {
+        .type = type,
+        .child = SIZE_MAX,
+        .next = SIZE_MAX
+    };
+
+    return index;
+}
+
+bool gbtParseJSONString (gbtJSONParser* parser, const char** outString)
+{
+    // - Strings are unescaped in place: the unescaped text is never longer
+    //   than the source text, so it can be written over it.
+    parser->cursor++;
+    char* start = parser->cursor;
+    char* write = parser->cursor;
+    while (*parser->cursor != '"')
+    {
+        char c = *parser->cursor++;
+        if (c == '\0')
+        {
+            return gbtFailJSON(parser, "Unterminated string.");
+        }
+        else if (c != '\\')
+        {
+            *write++ = c;
+            continue;
+        }
+
+        c = *parser->cursor++;
+        switch (c)
+        {
+            case '"':   *write++ = '"';  break;
+            case '\\':  *write++ = '\\'; break;
+            case '/':   *write++ = '/';  break;
+            case 'b':   *write++ = '\b'; break;
+            case 'f':   *write++ = '\f'; break;
+            case 'n':   *write++ = '\n'; break;
+            case 'r':   *write++ = '\r'; break;
+            case 't':   *write++ = '\t'; break;
+            case 'u':
+            {
+                // - Encode the code point as UTF-8; surrogate pairs are not
+                //   combined, since test vectors never contain them.
+                char digits[5] = { 0 };
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    if (isxdigit((unsigned char) parser->cursor[i]) == 0)
+                    {
+                        return gbtFailJSON(parser, "Invalid '\\u' escape.");
+                    }
+
+                    digits[i] = parser->cursor[i];
+                }
+
+                parser->cursor += 4;
+                unsigned long codePoint = strtoul(digits, nullptr, 16);
+                if (codePoint < 0x80)
+                {
+                    *write++ = (char) codePoint;
+                }
+                else if (codePoint < 0x800)
+                {
+                    *write++ = (char) (0xC0 | (codePoint >> 6));
+                    *write++ = (char) (0x80 | (codePoint & 0x3F));
+                }
+                else
+                {
+                    *write++ = (char) (0xE0 | (codePoint >> 12));
+                    *write++ = (char) (0x80 | ((codePoint >> 6) & 0x3F));
+                    *write++ = (char) (0x80 | (codePoint & 0x3F));
+                }
+            } break;
+
+            default:
+                return gbtFailJSON(parser, "Invalid escape sequence.");
+        }
+    }
+
+    parser->cursor++;
+    *write = '\0';
+    *outString = start;
+    return true;
+}
+
+bool gbtParseJSONContainer (gbtJSONParser* parser, size_t index, bool isObject)
+{
+    const char closer = (isObject == true) ? '}' : ']';
+    size_t last = SIZE_MAX;
+
+    parser->cursor++;
+    gbtSkipJSONWhitespace(parser);
+    if (*parser->cursor == closer)
+    {
+        parser->cursor++;
+        return true;
+    }
+
+    while (true)
+    {
+        // - Object members start with their name.
+        const char* key = nullptr;
+        if (isObject == true)
+        {
+            gbtSkipJSONWhitespace(parser);
+            if (*parser->cursor != '"')
+            {
+                return gbtFailJSON(parser, "Expected a member name.");
+            }
+
+            if (gbtParseJSONString(parser, &key) == false)
+            {
+                return false;
+            }
+
+            gbtSkipJSONWhitespace(parser);
+            if (*parser->cursor++ != ':')
+            {
+                return gbtFailJSON(parser, "Expected ':' after member name.");
+            }
+        }
+
+        size_t child = SIZE_MAX;
+        if (gbtParseJSONValue(parser, &child) == false)
+        {
+            return false;
+        }
+
+        // - Link the child in after its previous sibling. Indices are used
+        //   rather than pointers, since the node array may have moved.
+        gbtJSONNode* nodes = parser->document->nodes;
+        nodes[child].key = key;
+        if (last == SIZE_MAX)
+        {
+            nodes[index].child = child;
+        }
+        else
+        {
+            nodes[last].next = child;
+        }
+
+        nodes[index].count++;
+        last = child;
+
+        gbtSkipJSONWhitespace(parser);
+        char c = *parser->cursor++;
+        if (c == closer)
+        {
+            return true;
+        }
+        else if (c != ',')
+        {
+            parser->cursor--;
+            return gbtFailJSON(parser, "Expected ',' or the end of a container.");
+        }
+    }
+}
+
+bool gbtParseJSONValue (gbtJSONParser* parser, size_t* outIndex)
+{
+    gbtSkipJSONWhitespace(parser);
+
+    char c = *parser->cursor;
+    size_t index = SIZE_MAX;
+    if (c == '{' || c == '[')
+    {
+        if (++parser->depth > GBT_JSON_MAX_DEPTH)
+        {
+            return gbtFailJSON(parser, "Containers are nested too deeply.");
+        }
+
+        index = gbtAddJSONNode(parser,
+            (c == '{') ? GBT_JSON_OBJECT : GBT_JSON_ARRAY);
+        if (
+            index == SIZE_MAX ||
+            gbtParseJSONContainer(parser, index, c == '{') == false
+        )
+        {
+            return false;
+        }
+
+        parser->depth--;
+    }
+    else if (c == '"')
+    {
+        const char* string = nullptr;
+        index = gbtAddJSONNode(parser, GBT_JSON_STRING);
+        if (index == SIZE_MAX || gbtParseJSONString(parser, &string) == false)
+        {
+            return false;
+        }
+
+        parser->document->nodes[index].string = string;
+    }
+    else if (c == '-' || isdigit((unsigned char) c) != 0)
+    {
+        char* end = nullptr;
+        double number = strtod(parser->cursor, &end);
+        if (end == parser->cursor)
+        {
+            return gbtFailJSON(parser, "Invalid number.");
+        }
+
+        parser->cursor = end;
+        index = gbtAddJSONNode(parser, GBT_JSON_NUMBER);
+        if (index == SIZE_MAX)
+        {
+            return false;
+        }
+
+        parser->document->nodes[index].number = number;
+    }
+    else if (strncmp(parser->cursor, "true", 4) == 0 ||
+        strncmp(parser->cursor, "false", 5) == 0)
+    {
+        bool value = (c == 't');
+        parser->cursor += (value == true) ? 4 : 5;
+        index = gbtAddJSONNode(parser, GBT_JSON_BOOLEAN);
+        if (index == SIZE_MAX)
+        {
+            return false;
+        }
+
+        parser->document->nodes[index].boolean = value;
+    }
+    else if (strncmp(parser->cursor, "null", 4) == 0)
+    {
+        parser->cursor += 4;
+        index = gbtAddJSONNode(parser, GBT_JSON_NULL);
+        if (index == SIZE_MAX)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return gbtFailJSON(parser, "Unexpected character.");
+    }
+
+    *outIndex = index;
+    return true;
+}
+
+/* Public Function Definitions ************************************************/
+
+bool gbtParseJSONFile (const char* filepath, gbtJSONDocument* outDocument)
+{
+    gbCheckv(filepath != nullptr && outDocument != nullptr, false,
+        "Invalid arguments provided for JSON parsing.");
+    memset(outDocument, 0, sizeof(*outDocument));
+
+    // - Read the whole file into a null-terminated buffer.
+    FILE* fp = fopen(filepath, "rb");
+    gbCheckpv(fp != nullptr, false, "Failed to open JSON file '%s'", filepath);
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (size < 0)
+    {
+        gbLogErrno("Error reading JSON file '%s'", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    outDocument->text = gbCreate((size_t) size + 1, char);
+    if (outDocument->text == nullptr)
+    {
+        gbLogErrno("Error allocating memory for JSON file '%s'", filepath);
+        fclose(fp);
+        return false;
+    }
+
+    size_t bytesRead = fread(outDocument->text, 1, (size_t) size, fp);
+    fclose(fp);
+    outDocument->text[bytesRead] = '\0';
+
+    // - Parse the root value; nothing but whitespace may follow it.
+    gbtJSONParser parser = {
+        .document = outDocument,
+        .cursor = outDocument->text,
+        .filepath = filepath
+    };
+
+    size_t root = SIZE_MAX;
+    bool result = gbtParseJSONValue(&parser, &root);
+    if (result == true)
+    {
+        gbtSkipJSONWhitespace(&parser);
+        if (*parser.cursor != '\0')
+        {
+            result = gbtFailJSON(&parser, "Unexpected text after the root value.");
+        }
+    }
+
+    if (result == false)
+    {
+        gbtFreeJSON(outDocument);
+    }
+
+    return result;
+}
+
+void gbtFreeJSON (gbtJSONDocument* document)
+{
+    if (document != nullptr)
+    {
+        gbDestroy(document->text);
+        gbDestroy(document->nodes);
+        document->nodeCount = 0;
+        document->nodeCapacity = 0;
+    }
+}
+
+const gbtJSONNode* gbtGetJSONRoot (const gbtJSONDocument* document)
+{
+    return (document->nodeCount > 0) ? &document->nodes[0] : nullptr;
+}
+
+const gbtJSONNode* gbtGetJSONChild (const gbtJSONDocument* document,
+    const gbtJSONNode* node)
+{
+    return (node != nullptr && node->child != SIZE_MAX) ?
+        &document->nodes[node->child] : nullptr;
+}
+
+const gbtJSONNode* gbtGetJSONNext (const gbtJSONDocument* document,
+    const gbtJSONNode* node)
+{
+    return (node != nullptr && node->next != SIZE_MAX) ?
+        &document->nodes[node->next] : nullptr;
+}
+
+const gbtJSONNode* gbtGetJSONMember (const gbtJSONDocument* document,
+    const gbtJSONNode* node, const char* key)
+{
+    if (node == nullptr || node->type != GBT_JSON_OBJECT)
+    {
+        return nullptr;
+    }
+
+    for (
+        const gbtJSONNode* member = gbtGetJSONChild(document, node);
+        member != nullptr;
+        member = gbtGetJSONNext(document, member)
+    )
+    {
+        if (strcmp(member->key, key) == 0)
+        {
+            return member;
+        }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file    GBT/JSON.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for `gbt`'s minimal JSON reader, which parses
+ *          test vector files into a flat, read-only tree of nodes.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/GB.h>
+
+/* Public Constants and Enumerations ******************************************/
+
+/**
+ * @brief   Enumerates the types of JSON values.
+ */
+typedef enum gbtJSONType : uint8_t
+{
+    GBT_JSON_NULL,
+    GBT_JSON_BOOLEAN,
+    GBT_JSON_NUMBER,
+    GBT_JSON_STRING,
+    GBT_JSON_ARRAY,
+    GBT_JSON_OBJECT
+} gbtJSONType;
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure holding a single JSON value.
+ *
+ * Nodes are stored in one array, in document order. An array's or object's
+ * children are linked through their `next` indices, starting from `child`;
+ * `SIZE_MAX` marks the end of a list.
+ */
+typedef struct gbtJSONNode
+{
+    gbtJSONType type;
+    bool        boolean;
+    double      number;
+    const char* string;         // Strings: the unescaped value.
+    const char* key;            // Object members: the member's name.
+    size_t      child;          // Arrays and objects: the first child.
+    size_t      next;           // The next sibling.
+    size_t      count;          // Arrays and objects: the number of children.
+} gbtJSONNode;
+
+/**
+ * @brief   Defines a structure holding a parsed JSON document. Its strings
+ *          point into its own copy of the source text.
+ */
+typedef struct gbtJSONDocument
+{
+    char*           text;
+    gbtJSONNode*    nodes;
+    size_t          nodeCount;
+    size_t          nodeCapacity;
+} gbtJSONDocument;
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Reads and parses the JSON file at the given path.
+ *
+ * @param   filepath        The path of the file to parse.
+ * @param   outDocument     A pointer to the @a `gbtJSONDocument` to fill.
+ *
+ * @return  If successful, returns `true`.
+ *          If the file cannot be read or is not valid JSON, prints an error and
+ *          returns `false`.
+ */
+bool gbtParseJSONFile (const char* filepath, gbtJSONDocument* outDocument);
+
+/**
+ * @brief   Frees a parsed JSON document.
+ */
+void gbtFreeJSON (gbtJSONDocument* document);
+
+/**
+ * @brief   Retrieves the root value of a parsed JSON document.
+ */
+const gbtJSONNode* gbtGetJSONRoot (const gbtJSONDocument* document);
+
+/**
+ * @brief   Retrieves the first child of an array or object, or `nullptr` if it
+ *          has none.
+ */
+const gbtJSONNode* gbtGetJSONChild (const gbtJSONDocument* document,
+    const gbtJSONNode* node);
+
+/**
+ * @brief   Retrieves the next sibling of an array element or object member, or
+ *          `nullptr` if it is the last.
+ */
+const gbtJSONNode* gbtGetJSONNext (const gbtJSONDocument* document,
+    const gbtJSONNode* node);
+
+/**
+ * @brief   Retrieves the member of an object with the given name, or `nullptr`
+ *          if the node is not an object or has no such member.
+ */
+const gbtJSONNode* gbtGetJSONMember (const gbtJSONDocument* document,
+    const gbtJSONNode* node, const char* key);
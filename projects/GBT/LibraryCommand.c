@@ -0,0 +1,228 @@
+/**
+ * @file    GBT/LibraryCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt library` subcommand, which
+ *          indexes a directory tree of ROMs across worker threads, and lists
+ *          the entries matching a search.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding the library being scanned, and the
+ *          work queue shared by all worker threads.
+ */
+typedef struct gbtLibraryQueue
+{
+    gbLibrary*      library;
+    gbtWorkQueue    work;
+} gbtLibraryQueue;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintLibraryUsage ();
+static bool gbtMatchesLibrarySearch (const gbLibraryEntry* entry,
+    const char* search);
+static int gbtLibraryWorker (void* argument);
+
+/* Private Static Variables ***************************************************/
+
+/**
+ * @brief   The file extensions collected from directories as ROMs.
+ */
+static const char* const GBT_LIBRARY_EXTENSIONS[] = { "gb", "gbc", nullptr };
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintLibraryUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt library <dir> [--index FILE] [--jobs N] [--verify] [--rescan]\n"
+        "                    [--search TEXT]\n"
+        "\n"
+        "Scans <dir> for .gb and .gbc files, reading only their headers, and\n"
+        "prints how many were found and how long it took. With --index, the\n"
+        "entries are loaded from FILE first, so that unchanged files are not\n"
+        "read again, and saved back to it after. --verify also reads each whole\n"
+        "file to check its global checksum and hash it. --rescan ignores the\n"
+        "loaded entries. --search lists the entries whose title or path\n"
+        "contains TEXT, ignoring case.\n"
+    );
+}
+
+bool gbtMatchesLibrarySearch (const gbLibraryEntry* entry, const char* search)
+{
+    const char* fields[] = { entry->title, entry->path };
+    for (size_t field = 0; field < 2; ++field)
+    {
+        for (const char* start = fields[field]; *start != '\0'; ++start)
+        {
+            size_t i = 0;
+            while (
+                search[i] != '\0' && start[i] != '\0' &&
+                tolower((unsigned char) start[i]) == tolower((unsigned char) search[i])
+            )
+            {
+                ++i;
+            }
+
+            if (search[i] == '\0')
+            {
+                return true;
+            }
+        }
+    }
+
+    return search[0] == '\0';
+}
+
+int gbtLibraryWorker (void* argument)
+{
+    gbtLibraryQueue* queue = argument;
+
+    // - A file which cannot be read is left out of the library, with a
+    //   warning when the scan ends.
+    size_t index;
+    while (gbtTakeJob(&queue->work, &index) == true)
+    {
+        gbRunLibraryScanJob(queue->library, index);
+    }
+
+    return 0;
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtLibraryCommand (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintLibraryUsage();
+        return 1;
+    }
+
+    const char* indexPath = nullptr;
+    const char* search = nullptr;
+    uint64_t workerCount = (uint64_t) gbtGetProcessorCount();
+    uint8_t flags = GB_LS_NONE;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--index") == 0 && i + 1 < argc)
+        {
+            indexPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &workerCount) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--verify") == 0)
+        {
+            flags |= GB_LS_VERIFY;
+        }
+        else if (strcmp(argv[i], "--rescan") == 0)
+        {
+            flags |= GB_LS_RESCAN;
+        }
+        else if (strcmp(argv[i], "--search") == 0 && i + 1 < argc)
+        {
+            search = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintLibraryUsage();
+            return 1;
+        }
+    }
+
+    gbLibrary* library = gbCreateLibrary();
+    if (library == nullptr)
+    {
+        return 1;
+    }
+
+    // - A missing index is not an error; it is written after the first scan.
+    int result = 1;
+    gbtFileList files = { 0 };
+    if (indexPath != nullptr)
+    {
+        FILE* fp = fopen(indexPath, "rb");
+        if (fp != nullptr)
+        {
+            fclose(fp);
+            if (gbLoadLibraryIndex(library, indexPath) == false) { goto cleanup; }
+            printf("Loaded %zu entries from '%s'.\n",
+                gbGetLibraryEntryCount(library), indexPath);
+        }
+    }
+
+    // - List the ROMs, then read their headers on the worker threads.
+    double start = gbtGetSeconds();
+    if (
+        gbtCollectFiles(argv[0], GBT_LIBRARY_EXTENSIONS, &files) == false ||
+        gbBeginLibraryScan(library, (const char* const*) files.paths,
+            files.count, flags) == false
+    )
+    {
+        goto cleanup;
+    }
+
+    gbtLibraryQueue queue = { .library = library };
+    queue.work.jobCount = files.count;
+    gbtRunWorkers(&queue.work, (size_t) workerCount, gbtLibraryWorker, &queue);
+    if (gbEndLibraryScan(library) == false)
+    {
+        goto cleanup;
+    }
+
+    size_t count = gbGetLibraryEntryCount(library);
+    size_t badHeaders = 0, badGlobals = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const gbLibraryEntry* entry = gbGetLibraryEntry(library, i);
+        badHeaders += (entry->headerValid == false);
+        badGlobals += (entry->verified == true && entry->globalValid == false);
+    }
+
+    printf("Indexed %zu ROMs in %.3fs; read %zu, reused %zu.\n", count,
+        gbtGetSeconds() - start, gbGetLibraryScannedCount(library),
+        count - gbGetLibraryScannedCount(library));
+    printf("%zu with a bad header checksum, %zu with a bad global checksum.\n",
+        badHeaders, badGlobals);
+
+    if (search != nullptr)
+    {
+        printf("\n  %-16s  %-4s  %-4s  %-4s  %s\n", "Title", "CGB", "Type",
+            "ROM", "Path");
+        for (size_t i = 0; i < count; ++i)
+        {
+            const gbLibraryEntry* entry = gbGetLibraryEntry(library, i);
+            if (gbtMatchesLibrarySearch(entry, search) == true)
+            {
+                printf("  %-16s  $%02X   $%02X   $%02X   %s\n", entry->title,
+                    entry->cgbFlag, entry->cartridgeType, entry->romSizeByte,
+                    entry->path);
+            }
+        }
+    }
+
+    if (indexPath != nullptr)
+    {
+        if (gbSaveLibraryIndex(library, indexPath) == false) { goto cleanup; }
+        printf("Wrote %zu entries to '%s'.\n", count, indexPath);
+    }
+
+    result = 0;
+
+cleanup:
+    gbtFreeFileList(&files);
+    gbDestroyLibrary(library);
+    return result;
+}
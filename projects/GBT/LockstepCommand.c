@@ -0,0 +1,302 @@
+/**
+ * @file    GBT/LockstepCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt lockstep` subcommand, which
+ *          runs a ROM in a reference-mode context and a normal context side by
+ *          side, and reports the first point at which they diverge.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The default number of instructions to run in lockstep.
+ */
+#define GBT_LOCKSTEP_DEFAULT_INSTRUCTIONS   10000000ull
+
+/**
+ * @brief   The default number of trailing trace records printed for each side
+ *          when a divergence is found.
+ */
+#define GBT_LOCKSTEP_DEFAULT_WINDOW         16ull
+
+/**
+ * @brief   The default interval, in instructions, between memory hash
+ *          comparisons. Registers and cycle counts are compared after every
+ *          instruction.
+ */
+#define GBT_LOCKSTEP_DEFAULT_HASH_INTERVAL  64ull
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding one side of a lockstep run.
+ */
+typedef struct gbtLockstepSide
+{
+    const char*     label;
+    gbContext*      context;
+    gbCartridge*    cartridge;
+    gbTrace*        trace;
+} gbtLockstepSide;
+
+/**
+ * @brief   Defines a structure holding the state compared between the two
+ *          sides after each instruction.
+ */
+typedef struct gbtLockstepState
+{
+    gbProcessorRegisterFile registers;
+    uint64_t                cycles;
+    bool                    halted;
+    bool                    stopped;
+    bool                    masterEnabled;
+    uint64_t                memoryHash;
+} gbtLockstepState;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintLockstepUsage ();
+static bool gbtCreateLockstepSide (gbtLockstepSide* side, const char* label,
+    const char* romPath, bool referenceMode, uint64_t window, uint8_t flags);
+static void gbtDestroyLockstepSide (gbtLockstepSide* side);
+static void gbtCaptureLockstepState (const gbtLockstepSide* side,
+    bool hashMemory, gbtLockstepState* outState);
+static void gbtPrintLockstepState (const char* label,
+    const gbtLockstepState* state, bool hashed);
+static void gbtPrintLockstepWindow (const gbtLockstepSide* side);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintLockstepUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt lockstep <rom> [--instructions N] [--window N] [--hash-every N]\n"
+        "                     [--bus]\n"
+        "\n"
+        "Runs <rom> in a reference-mode context and a normal context in\n"
+        "lockstep. Registers and cycle counts are compared after every\n"
+        "instruction; memory hashes every --hash-every instructions. The first\n"
+        "divergence is reported with the last --window trace records of each\n"
+        "side. --bus adds bus accesses to the trace window.\n"
+    );
+}
+
+bool gbtCreateLockstepSide (gbtLockstepSide* side, const char* label,
+    const char* romPath, bool referenceMode, uint64_t window, uint8_t flags)
+{
+    // - Each side needs its own cartridge, since the cartridge holds banking
+    //   state and external RAM.
+    side->label = label;
+    side->context = gbCreateContext(false);
+    side->cartridge = gbCreateCartridge(romPath);
+    side->trace = gbCreateTrace((size_t) window, flags);
+    return
+        side->context != nullptr &&
+        side->cartridge != nullptr &&
+        side->trace != nullptr &&
+        gbSetReferenceMode(side->context, referenceMode) &&
+        gbAttachCartridge(side->context, side->cartridge) &&
+        gbSetCartridgeRTCClock(side->cartridge, GB_RTC_EMULATED_CLOCK) &&
+        gbAttachTrace(side->context, side->trace);
+}
+
+void gbtDestroyLockstepSide (gbtLockstepSide* side)
+{
+    gbDestroyContext(side->context);
+    gbDestroyCartridge(side->cartridge);
+    gbDestroyTrace(side->trace);
+}
+
+void gbtCaptureLockstepState (const gbtLockstepSide* side, bool hashMemory,
+    gbtLockstepState* outState)
+{
+    const gbProcessor* processor = gbGetProcessor(side->context);
+
+    memset(outState, 0, sizeof(*outState));
+    outState->registers = *gbGetRegisterFile(processor);
+    outState->cycles = gbGetTickCyclesConsumed(processor);
+    gbCheckHaltState(processor, &outState->halted);
+    gbCheckStopState(processor, &outState->stopped);
+    gbCheckInterruptMasterEnabled(processor, &outState->masterEnabled);
+    if (hashMemory == true)
+    {
+        gbHashContextMemory(side->context, &outState->memoryHash);
+    }
+}
+
+void gbtPrintLockstepState (const char* label, const gbtLockstepState* state,
+    bool hashed)
+{
+    const gbProcessorRegisterFile* r = &state->registers;
+    printf("  %-9s AF=%02X%02X BC=%02X%02X DE=%02X%02X HL=%02X%02X SP=%04X "
+        "PC=%04X IME=%u HALT=%u STOP=%u cycles=%llu",
+        label, r->accumulator, r->flags.raw, r->b, r->c, r->d, r->e, r->h,
+        r->l, r->stackPointer, r->programCounter, state->masterEnabled,
+        state->halted, state->stopped, (unsigned long long) state->cycles);
+    if (hashed == true)
+    {
+        printf(" memory=%016llX", (unsigned long long) state->memoryHash);
+    }
+
+    printf("\n");
+}
+
+void gbtPrintLockstepWindow (const gbtLockstepSide* side)
+{
+    size_t count = gbGetTraceRecordCount(side->trace);
+    printf("\nLast %zu trace records (%s):\n", count, side->label);
+    for (size_t i = 0; i < count; ++i)
+    {
+        gbTraceRecord record;
+        gbReadTraceRecord(side->trace, i, &record);
+        gbtPrintTraceRecord("  ", i, &record);
+    }
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtLockstepCommand (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintLockstepUsage();
+        return 1;
+    }
+
+    // - Parse the options.
+    uint64_t instructions = GBT_LOCKSTEP_DEFAULT_INSTRUCTIONS;
+    uint64_t window = GBT_LOCKSTEP_DEFAULT_WINDOW;
+    uint64_t hashInterval = GBT_LOCKSTEP_DEFAULT_HASH_INTERVAL;
+    uint8_t flags = GB_TF_NONE;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--instructions") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &instructions) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--window") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &window) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--hash-every") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &hashInterval) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--bus") == 0)
+        {
+            flags |= GB_TF_BUS_ACCESSES;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintLockstepUsage();
+            return 1;
+        }
+    }
+
+    if (window == 0 || hashInterval == 0)
+    {
+        fprintf(stderr, "--window and --hash-every must not be zero.\n");
+        return 1;
+    }
+
+    // - Create both sides. The reference side takes only the core's general
+    //   code paths; the other side takes whichever paths are fastest.
+    int result = 1;
+    gbtLockstepSide reference = { 0 }, optimized = { 0 };
+    if (
+        gbtCreateLockstepSide(&reference, "reference", argv[0], true, window,
+            flags) == false ||
+        gbtCreateLockstepSide(&optimized, "optimized", argv[0], false, window,
+            flags) == false
+    )
+    {
+        goto cleanup;
+    }
+
+    // - Step both sides one instruction at a time, comparing their states.
+    uint64_t lastHashed = 0;
+    for (uint64_t step = 1; step <= instructions; ++step)
+    {
+        bool tickedReference = gbTick(reference.context);
+        bool tickedOptimized = gbTick(optimized.context);
+
+        bool hashMemory = (step % hashInterval) == 0 || step == instructions;
+        gbtLockstepState a, b;
+        gbtCaptureLockstepState(&reference, hashMemory, &a);
+        gbtCaptureLockstepState(&optimized, hashMemory, &b);
+
+        bool registersMatch =
+            memcmp(&a.registers, &b.registers, sizeof(a.registers)) == 0;
+        bool cyclesMatch = a.cycles == b.cycles;
+        bool modesMatch =
+            a.halted == b.halted && a.stopped == b.stopped &&
+            a.masterEnabled == b.masterEnabled;
+        bool memoryMatches = a.memoryHash == b.memoryHash;
+        bool ticksMatch = tickedReference == tickedOptimized;
+
+        if (
+            ticksMatch == true && registersMatch == true && cyclesMatch == true &&
+            modesMatch == true && memoryMatches == true
+        )
+        {
+            // - Both sides stopping with an error is not a divergence, but
+            //   nothing after it can be compared.
+            if (tickedReference == false)
+            {
+                printf("Both sides stopped with an error after %llu "
+                    "instructions; no divergence.\n", (unsigned long long) step);
+                result = 0;
+                goto cleanup;
+            }
+
+            if (hashMemory == true)
+            {
+                lastHashed = step;
+            }
+
+            continue;
+        }
+
+        // - Report the divergence.
+        printf("Divergence at instruction %llu:", (unsigned long long) step);
+        if (ticksMatch == false)     { printf(" tick-result"); }
+        if (registersMatch == false) { printf(" registers"); }
+        if (cyclesMatch == false)    { printf(" cycles"); }
+        if (modesMatch == false)     { printf(" processor-mode"); }
+        if (memoryMatches == false)  { printf(" memory"); }
+        printf("\n");
+
+        if (memoryMatches == false)
+        {
+            printf("  Memory last matched after instruction %llu; rerun with "
+                "--hash-every 1 to pinpoint the write.\n",
+                (unsigned long long) lastHashed);
+        }
+
+        gbtPrintLockstepState(reference.label, &a, hashMemory);
+        gbtPrintLockstepState(optimized.label, &b, hashMemory);
+        gbtPrintLockstepWindow(&reference);
+        gbtPrintLockstepWindow(&optimized);
+        goto cleanup;
+    }
+
+    printf("No divergence in %llu instructions (%llu T-cycles).\n",
+        (unsigned long long) instructions,
+        (unsigned long long) gbGetTickCyclesConsumed(
+            gbGetProcessor(reference.context)));
+    result = 0;
+
+cleanup:
+    gbtDestroyLockstepSide(&reference);
+    gbtDestroyLockstepSide(&optimized);
+    return result;
+}
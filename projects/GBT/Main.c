@@ -1,5 +1,410 @@
+/**
+ * @file    GBT/Main.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the entry point of the Game Boy Emulator Core Library Test
+ *          Suite (`gbt`), which dispatches to its subcommands.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+#if defined(GB_WINDOWS)
+    #include <windows.h>
+#else
+    #include <dirent.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure describing one of `gbt`'s subcommands.
+ */
+typedef struct gbtCommand
+{
+    const char*         name;
+    gbtCommandFunction  function;
+    const char*         summary;
+} gbtCommand;
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   Defines the table of subcommands provided by `gbt`.
+ */
+static const gbtCommand GBT_COMMANDS[] = {
+    { "bench",  gbtBenchCommand,    "Run core microbenchmarks and report ns/op." },
+    { "block",  gbtBlockCommand,    "Check block bus reads and writes against byte-at-a-time access." },
+    { "coverage", gbtCoverageCommand, "Record, merge and export which ROM bytes were executed." },
+    { "framehash", gbtFrameHashCommand, "Record or check per-frame state hashes against a golden file." },
+    { "library", gbtLibraryCommand, "Index a directory tree of ROMs, and search the index." },
+    { "lockstep", gbtLockstepCommand, "Run a ROM in reference and normal contexts and compare them." },
+    { "patch",  gbtPatchCommand,    "Check that malformed ROM patches are refused, and good ones apply." },
+    { "profile", gbtProfileCommand, "Profile where a ROM spends its cycles, by RGBDS symbol." },
+    { "run",    gbtRunCommand,      "Run test ROMs headless and report pass/fail results." },
+    { "sm83",   gbtSM83Command,     "Run SM83 single-step JSON test vectors across worker threads." },
+    { "trace",  gbtTraceCommand,    "Record, decode and diff binary execution traces." },
+    { "workload", gbtWorkloadCommand, "Run generated benchmark ROMs and report FPS and MIPS." },
+};
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintUsage (const char* program);
+static bool gbtHasExtension (const char* path, const char* const* extensions);
+static bool gbtAddFile (gbtFileList* list, const char* path);
+static int gbtComparePaths (const void* a, const void* b);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintUsage (const char* program)
+{
+    fprintf(stderr, "Usage: %s <command> [arguments...]\n\n", program);
+    fprintf(stderr, "Commands:\n");
+    for (size_t i = 0; i < sizeof(GBT_COMMANDS) / sizeof(GBT_COMMANDS[0]); ++i)
+    {
+        fprintf(stderr, "  %-10s %s\n", GBT_COMMANDS[i].name,
+            GBT_COMMANDS[i].summary);
+    }
+
+    fprintf(stderr, "\nRun '%s <command>' without arguments for its usage.\n",
+        program);
+}
+
+bool gbtHasExtension (const char* path, const char* const* extensions)
+{
+    const char* dot = strrchr(path, '.');
+    if (dot == nullptr)
+    {
+        return false;
+    }
+
+    char extension[16] = { 0 };
+    for (size_t i = 0; i < sizeof(extension) - 1 && dot[i + 1] != '\0'; ++i)
+    {
+        extension[i] = (char) tolower((unsigned char) dot[i + 1]);
+    }
+
+    for (size_t i = 0; extensions[i] != nullptr; ++i)
+    {
+        if (strcmp(extension, extensions[i]) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool gbtAddFile (gbtFileList* list, const char* path)
+{
+    if (list->count == list->capacity)
+    {
+        size_t newCapacity = (list->capacity == 0) ? 64 : list->capacity * 2;
+        char** newPaths = gbResize(list->paths, newCapacity, char*);
+        gbCheckpv(newPaths != nullptr, false, "Error allocating memory for file list");
+
+        list->paths = newPaths;
+        list->capacity = newCapacity;
+    }
+
+    char* copy = gbCreate(strlen(path) + 1, char);
+    gbCheckpv(copy != nullptr, false, "Error allocating memory for file path");
+
+    strcpy(copy, path);
+    list->paths[list->count++] = copy;
+    return true;
+}
+
+int gbtComparePaths (const void* a, const void* b)
+{
+    return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
+/* Public Function Definitions - Helper Functions *****************************/
+
+bool gbtParseUnsigned (const char* text, uint64_t* outValue)
+{
+    if (text == nullptr || text[0] == '\0' || text[0] == '-')
+    {
+        fprintf(stderr, "Expected an unsigned number, got '%s'.\n",
+            (text != nullptr) ? text : "");
+        return false;
+    }
+
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long value = strtoull(text, &end, 0);
+    if (errno != 0 || end == text || *end != '\0')
+    {
+        fprintf(stderr, "Expected an unsigned number, got '%s'.\n", text);
+        return false;
+    }
+
+    *outValue = (uint64_t) value;
+    return true;
+}
+
+double gbtGetSeconds ()
+{
+#if defined(GB_WINDOWS)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double) counter.QuadPart / (double) frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec / 1e9;
+#endif
+}
+
+size_t gbtGetProcessorCount ()
+{
+#if defined(GB_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (info.dwNumberOfProcessors > 0) ? info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (size_t) count : 1;
+#endif
+}
+
+#if defined(GB_WINDOWS)
+
+bool gbtCollectFiles (const char* path, const char* const* extensions,
+    gbtFileList* list)
+{
+    DWORD attributes = GetFileAttributesA(path);
+    gbCheckv(attributes != INVALID_FILE_ATTRIBUTES, false,
+        "Path '%s' does not exist.", path);
+
+    if ((attributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+    {
+        return gbtAddFile(list, path);
+    }
+
+    // - Search the directory, recursing into subdirectories.
+    char pattern[MAX_PATH];
+    snprintf(pattern, sizeof(pattern), "%s\\*", path);
+
+    WIN32_FIND_DATAA entry;
+    HANDLE find = FindFirstFileA(pattern, &entry);
+    if (find == INVALID_HANDLE_VALUE)
+    {
+        return true;
+    }
+
+    bool result = true;
+    do
+    {
+        if (strcmp(entry.cFileName, ".") == 0 || strcmp(entry.cFileName, "..") == 0)
+        {
+            continue;
+        }
+
+        char child[MAX_PATH];
+        snprintf(child, sizeof(child), "%s\\%s", path, entry.cFileName);
+        if ((entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+        {
+            result = gbtCollectFiles(child, extensions, list);
+        }
+        else if (gbtHasExtension(child, extensions) == true)
+        {
+            result = gbtAddFile(list, child);
+        }
+    } while (result == true && FindNextFileA(find, &entry) != 0);
+
+    FindClose(find);
+    return result;
+}
+
+#else
+
+bool gbtCollectFiles (const char* path, const char* const* extensions,
+    gbtFileList* list)
+{
+    struct stat info;
+    gbCheckpv(stat(path, &info) == 0, false, "Could not stat '%s'", path);
+
+    if (S_ISDIR(info.st_mode) == false)
+    {
+        return gbtAddFile(list, path);
+    }
+
+    // - Search the directory, recursing into subdirectories.
+    DIR* directory = opendir(path);
+    gbCheckpv(directory != nullptr, false, "Could not open directory '%s'", path);
+
+    bool result = true;
+    struct dirent* entry = nullptr;
+    while (result == true && (entry = readdir(directory)) != nullptr)
+    {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+        {
+            continue;
+        }
+
+        size_t length = strlen(path) + strlen(entry->d_name) + 2;
+        char* child = gbCreate(length, char);
+        if (child == nullptr)
+        {
+            gbLogErrno("Error allocating memory for path");
+            result = false;
+            break;
+        }
+
+        snprintf(child, length, "%s/%s", path, entry->d_name);
+        if (stat(child, &info) == 0)
+        {
+            if (S_ISDIR(info.st_mode) == true)
+            {
+                result = gbtCollectFiles(child, extensions, list);
+            }
+            else if (gbtHasExtension(child, extensions) == true)
+            {
+                result = gbtAddFile(list, child);
+            }
+        }
+
+        gbDestroy(child);
+    }
+
+    closedir(directory);
+    return result;
+}
+
+#endif
+
+char* gbtFindSymbolFile (const char* romPath)
+{
+    size_t length = strlen(romPath);
+    const char* dot = strrchr(romPath, '.');
+    const char* slash = strrchr(romPath, '/');
+    if (dot != nullptr && (slash == nullptr || dot > slash))
+    {
+        length = (size_t) (dot - romPath);
+    }
+
+    char* symPath = gbCreate(length + 5, char);
+    if (symPath == nullptr)
+    {
+        return nullptr;
+    }
+
+    snprintf(symPath, length + 5, "%.*s.sym", (int) length, romPath);
+
+    FILE* fp = fopen(symPath, "r");
+    if (fp == nullptr)
+    {
+        gbDestroy(symPath);
+        return nullptr;
+    }
+
+    fclose(fp);
+    return symPath;
+}
+
+void gbtSortFileList (gbtFileList* list)
+{
+    if (list->count > 1)
+    {
+        qsort(list->paths, list->count, sizeof(char*), gbtComparePaths);
+    }
+}
+
+void gbtFreeFileList (gbtFileList* list)
+{
+    for (size_t i = 0; i < list->count; ++i)
+    {
+        gbDestroy(list->paths[i]);
+    }
+
+    gbDestroy(list->paths);
+    list->count = 0;
+    list->capacity = 0;
+}
+
+size_t gbtRunWorkers (gbtWorkQueue* queue, size_t workerCount,
+    thrd_start_t worker, void* argument)
+{
+    // - There is no point in spawning more workers than there are jobs.
+    if (workerCount == 0)
+    {
+        workerCount = 1;
+    }
+    else if (workerCount > queue->jobCount && queue->jobCount > 0)
+    {
+        workerCount = queue->jobCount;
+    }
+
+    atomic_store(&queue->nextJob, 0);
+    thrd_t* workers = gbCreate(workerCount, thrd_t);
+    if (workers == nullptr)
+    {
+        gbLogErrno("Error allocating memory for worker threads");
+    }
+
+    size_t spawned = 0;
+    for (; workers != nullptr && spawned < workerCount; ++spawned)
+    {
+        if (thrd_create(&workers[spawned], worker, argument) != thrd_success)
+        {
+            gbLogError("Failed to spawn worker thread #%zu.", spawned);
+            break;
+        }
+    }
+
+    // - If no worker could be spawned, run the queue on this thread instead.
+    if (spawned == 0)
+    {
+        worker(argument);
+    }
+
+    for (size_t i = 0; i < spawned; ++i)
+    {
+        thrd_join(workers[i], nullptr);
+    }
+
+    gbDestroy(workers);
+    return (spawned > 0) ? spawned : 1;
+}
+
+bool gbtTakeJob (gbtWorkQueue* queue, size_t* outIndex)
+{
+    size_t index = atomic_fetch_add(&queue->nextJob, 1);
+    if (index >= queue->jobCount)
+    {
+        return false;
+    }
+
+    *outIndex = index;
+    return true;
+}
+
+/* Public Function Definitions ************************************************/
 
 int main (int argc, char** argv)
 {
-    return 0;
+    if (argc < 2)
+    {
+        gbtPrintUsage(argv[0]);
+        return 1;
+    }
+
+    for (size_t i = 0; i < sizeof(GBT_COMMANDS) / sizeof(GBT_COMMANDS[0]); ++i)
+    {
+        if (strcmp(argv[1], GBT_COMMANDS[i].name) == 0)
+        {
+            return GBT_COMMANDS[i].function(argc - 2, argv + 2);
+        }
+    }
+
+    fprintf(stderr, "Unknown command '%s'.\n\n", argv[1]);
+    gbtPrintUsage(argv[0]);
+    return 1;
 }
@@ -0,0 +1,305 @@
+/**
+ * @file    GBT/PatchCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt patch` subcommand, which
+ *          runs the ROM patcher against built-in regression patches, checking
+ *          that well-formed patches apply and malformed ones are refused.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The size of the source image the regression patches are made for.
+ */
+#define GBT_PATCH_SOURCE_SIZE   0x8000
+
+/**
+ * @brief   The largest regression patch.
+ */
+#define GBT_PATCH_CAPACITY      64
+
+/**
+ * @brief   The BPS actions.
+ */
+#define GBT_BPS_SOURCE_READ     0
+#define GBT_BPS_TARGET_READ     1
+#define GBT_BPS_SOURCE_COPY     2
+#define GBT_BPS_TARGET_COPY     3
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding a BPS patch as it is built.
+ */
+typedef struct gbtPatchBuilder
+{
+    uint8_t     data[GBT_PATCH_CAPACITY];
+    size_t      size;
+} gbtPatchBuilder;
+
+/**
+ * @brief   Defines one regression case: a function which writes the actions
+ *          of a BPS patch, and whether the patcher should accept it.
+ */
+typedef struct gbtPatchCase
+{
+    const char* name;
+    void        (*build) (gbtPatchBuilder* builder);
+    bool        accepted;
+} gbtPatchCase;
+
+/**
+ * @brief   Defines a structure holding the last error the core logged.
+ */
+typedef struct gbtPatchLog
+{
+    char        lastError[256];
+} gbtPatchLog;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintPatchUsage ();
+static void gbtPutPatchByte (gbtPatchBuilder* builder, uint8_t byte);
+static void gbtPutPatchNumber (gbtPatchBuilder* builder, uint64_t value);
+static void gbtPutPatchCRC (gbtPatchBuilder* builder, uint32_t crc);
+static void gbtPutPatchAction (gbtPatchBuilder* builder, uint8_t action,
+    uint64_t length);
+static void gbtPutPatchDelta (gbtPatchBuilder* builder, int64_t delta);
+static void gbtBuildSourceRead (gbtPatchBuilder* builder);
+static void gbtBuildSourceCopyBack (gbtPatchBuilder* builder);
+static void gbtBuildSourceCopyPastEnd (gbtPatchBuilder* builder);
+static void gbtBuildSourceCopyStraddle (gbtPatchBuilder* builder);
+static void gbtBuildTargetCopyBack (gbtPatchBuilder* builder);
+static void gbtBuildTargetCopyAhead (gbtPatchBuilder* builder);
+static void gbtCapturePatchLog (gbLogLevel level, const char* message,
+    void* userdata);
+static bool gbtRunPatchCase (const gbtPatchCase* patchCase,
+    const uint8_t* source, gbtPatchLog* log);
+
+/* Private Static Variables ***************************************************/
+
+/**
+ * @brief   The error the patcher logs when a copy reaches outside its buffers.
+ */
+static const char* GBT_PATCH_BOUNDS_ERROR =
+    "The BPS patch reads or copies outside of its buffers.";
+
+static const gbtPatchCase GBT_PATCH_CASES[] = {
+    { "bps-source-read",            gbtBuildSourceRead,         true  },
+    { "bps-source-copy-before-0",   gbtBuildSourceCopyBack,     false },
+    { "bps-source-copy-past-end",   gbtBuildSourceCopyPastEnd,  false },
+    { "bps-source-copy-straddle",   gbtBuildSourceCopyStraddle, false },
+    { "bps-target-copy-before-0",   gbtBuildTargetCopyBack,     false },
+    { "bps-target-copy-ahead",      gbtBuildTargetCopyAhead,    false }
+};
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintPatchUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt patch\n"
+        "\n"
+        "Applies built-in BPS patches to a generated 32 KiB image: one which\n"
+        "should apply, and others whose relative copies reach outside the\n"
+        "source or the target, which the patcher should refuse without\n"
+        "touching the image. Prints one line per case, and exits non-zero if\n"
+        "any case fails.\n"
+    );
+}
+
+void gbtPutPatchByte (gbtPatchBuilder* builder, uint8_t byte)
+{
+    gbAssert(builder->size < GBT_PATCH_CAPACITY);
+    builder->data[builder->size++] = byte;
+}
+
+void gbtPutPatchNumber (gbtPatchBuilder* builder, uint64_t value)
+{
+    // - The inverse of the core's reader: seven bits at a time, with each
+    //   continuation taking one away.
+    while (true)
+    {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if (value == 0)
+        {
+            gbtPutPatchByte(builder, byte | 0x80);
+            return;
+        }
+
+        gbtPutPatchByte(builder, byte);
+        value--;
+    }
+}
+
+void gbtPutPatchCRC (gbtPatchBuilder* builder, uint32_t crc)
+{
+    for (size_t i = 0; i < 4; ++i)
+    {
+        gbtPutPatchByte(builder, (uint8_t) (crc >> (i * 8)));
+    }
+}
+
+void gbtPutPatchAction (gbtPatchBuilder* builder, uint8_t action,
+    uint64_t length)
+{
+    gbtPutPatchNumber(builder, ((length - 1) << 2) | action);
+}
+
+void gbtPutPatchDelta (gbtPatchBuilder* builder, int64_t delta)
+{
+    gbtPutPatchNumber(builder, (delta < 0) ?
+        (((uint64_t) -delta << 1) | 1) : ((uint64_t) delta << 1));
+}
+
+void gbtBuildSourceRead (gbtPatchBuilder* builder)
+{
+    gbtPutPatchAction(builder, GBT_BPS_SOURCE_READ, GBT_PATCH_SOURCE_SIZE);
+}
+
+void gbtBuildSourceCopyBack (gbtPatchBuilder* builder)
+{
+    gbtPutPatchAction(builder, GBT_BPS_SOURCE_COPY, GBT_PATCH_SOURCE_SIZE);
+    gbtPutPatchDelta(builder, -16);
+}
+
+void gbtBuildSourceCopyPastEnd (gbtPatchBuilder* builder)
+{
+    gbtPutPatchAction(builder, GBT_BPS_SOURCE_COPY, GBT_PATCH_SOURCE_SIZE);
+    gbtPutPatchDelta(builder, 16);
+}
+
+void gbtBuildSourceCopyStraddle (gbtPatchBuilder* builder)
+{
+    // - The move lands inside the source, but the copy runs past its end.
+    gbtPutPatchAction(builder, GBT_BPS_SOURCE_COPY, 32);
+    gbtPutPatchDelta(builder, GBT_PATCH_SOURCE_SIZE - 16);
+}
+
+void gbtBuildTargetCopyBack (gbtPatchBuilder* builder)
+{
+    gbtPutPatchAction(builder, GBT_BPS_TARGET_READ, 1);
+    gbtPutPatchByte(builder, 0xAA);
+    gbtPutPatchAction(builder, GBT_BPS_TARGET_COPY, GBT_PATCH_SOURCE_SIZE - 1);
+    gbtPutPatchDelta(builder, -16);
+}
+
+void gbtBuildTargetCopyAhead (gbtPatchBuilder* builder)
+{
+    gbtPutPatchAction(builder, GBT_BPS_TARGET_READ, 1);
+    gbtPutPatchByte(builder, 0xAA);
+    gbtPutPatchAction(builder, GBT_BPS_TARGET_COPY, GBT_PATCH_SOURCE_SIZE - 1);
+    gbtPutPatchDelta(builder, 16);
+}
+
+void gbtCapturePatchLog (gbLogLevel level, const char* message,
+    void* userdata)
+{
+    gbtPatchLog* log = userdata;
+    if (level == GB_LL_ERROR)
+    {
+        snprintf(log->lastError, sizeof(log->lastError), "%s", message);
+    }
+}
+
+bool gbtRunPatchCase (const gbtPatchCase* patchCase, const uint8_t* source,
+    gbtPatchLog* log)
+{
+    // - Every case makes a target the size of the source, and claims the
+    //   source's CRC for it; only the accepted case produces exactly that.
+    uint32_t sourceCRC = gbComputeCRC32(source, GBT_PATCH_SOURCE_SIZE, 0);
+    gbtPatchBuilder builder = { 0 };
+    memcpy(builder.data, "BPS1", 4);
+    builder.size = 4;
+    gbtPutPatchNumber(&builder, GBT_PATCH_SOURCE_SIZE);
+    gbtPutPatchNumber(&builder, GBT_PATCH_SOURCE_SIZE);
+    gbtPutPatchNumber(&builder, 0);
+    patchCase->build(&builder);
+    gbtPutPatchCRC(&builder, sourceCRC);
+    gbtPutPatchCRC(&builder, sourceCRC);
+    gbtPutPatchCRC(&builder, gbComputeCRC32(builder.data, builder.size, 0));
+
+    uint8_t* image = gbCreate(GBT_PATCH_SOURCE_SIZE, uint8_t);
+    if (image == nullptr)
+    {
+        return false;
+    }
+
+    memcpy(image, source, GBT_PATCH_SOURCE_SIZE);
+    uint8_t* original = image;
+    size_t size = GBT_PATCH_SOURCE_SIZE;
+    log->lastError[0] = '\0';
+    bool applied = gbApplyPatch(builder.data, builder.size, &image, &size);
+    gbFlushLog();
+
+    // - A refused patch must leave the image as it was, and must have been
+    //   refused by the bounds checks.
+    bool passed = applied == patchCase->accepted &&
+        size == GBT_PATCH_SOURCE_SIZE &&
+        memcmp(image, source, GBT_PATCH_SOURCE_SIZE) == 0 &&
+        (applied == true || (image == original &&
+            strstr(log->lastError, GBT_PATCH_BOUNDS_ERROR) != nullptr));
+
+    gbDestroy(image);
+    return passed;
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtPatchCommand (int argc, char** argv)
+{
+    (void) argv;
+    if (argc > 0)
+    {
+        gbtPrintPatchUsage();
+        return 1;
+    }
+
+    uint8_t* source = gbCreate(GBT_PATCH_SOURCE_SIZE, uint8_t);
+    if (source == nullptr)
+    {
+        fprintf(stderr, "Error allocating memory for the source image.\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < GBT_PATCH_SOURCE_SIZE; ++i)
+    {
+        source[i] = (uint8_t) (i * 7 + (i >> 8));
+    }
+
+    // - Capture the patcher's errors, rather than printing them, to check why
+    //   each patch was refused.
+    gbtPatchLog log = { 0 };
+    gbSetLogSink(gbtCapturePatchLog, &log);
+
+    size_t failed = 0;
+    const size_t caseCount =
+        sizeof(GBT_PATCH_CASES) / sizeof(GBT_PATCH_CASES[0]);
+    for (size_t i = 0; i < caseCount; ++i)
+    {
+        bool passed = gbtRunPatchCase(&GBT_PATCH_CASES[i], source, &log);
+        printf("%-28s %s (%s)\n", GBT_PATCH_CASES[i].name,
+            passed ? "PASS" : "FAIL",
+            GBT_PATCH_CASES[i].accepted ? "applies" : "refused");
+        if (passed == false && log.lastError[0] != '\0')
+        {
+            printf("    %s\n", log.lastError);
+        }
+
+        failed += (passed == false);
+    }
+
+    gbFlushLog();
+    gbSetLogSink(nullptr, nullptr);
+    printf("%zu of %zu cases passed.\n", caseCount - failed, caseCount);
+    gbDestroy(source);
+    return (failed == 0) ? 0 : 1;
+}
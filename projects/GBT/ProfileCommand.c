@@ -0,0 +1,213 @@
+/**
+ * @file    GBT/ProfileCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt profile` subcommand, which
+ *          runs a ROM headless with a guest code profiler attached, and reports
+ *          where its cycles were spent.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The number of T-cycles in one frame, at the normal-speed clock rate.
+ */
+#define GBT_PROFILE_FRAME_CYCLES    70224ull
+
+/**
+ * @brief   The default number of frames to profile.
+ */
+#define GBT_PROFILE_DEFAULT_FRAMES  600ull
+
+/**
+ * @brief   The default number of report rows printed.
+ */
+#define GBT_PROFILE_DEFAULT_TOP     25ull
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintProfileUsage ();
+static bool gbtLoadDefaultSymbols (gbProfiler* profiler, const char* romPath);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintProfileUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt profile <rom> [--frames N] [--sym FILE] [--sample N] [--top N]\n"
+        "                    [--by-address] [--folded FILE]\n"
+        "\n"
+        "Runs <rom> for --frames frames, counting the T-cycles spent at each\n"
+        "instruction, and prints the --top most expensive symbols. Symbols are\n"
+        "read from the RGBDS .sym file given with --sym, or else from the .sym\n"
+        "file next to <rom>, if there is one. --sample N counts only every Nth\n"
+        "instruction. --by-address reports single addresses instead of\n"
+        "symbols. --folded writes the counts as folded stacks, for flame graph\n"
+        "tools.\n"
+    );
+}
+
+bool gbtLoadDefaultSymbols (gbProfiler* profiler, const char* romPath)
+{
+    char* symPath = gbtFindSymbolFile(romPath);
+    if (symPath == nullptr)
+    {
+        return false;
+    }
+
+    bool loaded = gbLoadProfilerSymbols(profiler, symPath);
+    if (loaded == true)
+    {
+        printf("Loaded %zu symbols from '%s'.\n",
+            gbGetProfilerSymbolCount(profiler), symPath);
+    }
+
+    gbDestroy(symPath);
+    return loaded;
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtProfileCommand (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintProfileUsage();
+        return 1;
+    }
+
+    // - Parse the options.
+    uint64_t frames = GBT_PROFILE_DEFAULT_FRAMES;
+    uint64_t samplePeriod = 1;
+    uint64_t top = GBT_PROFILE_DEFAULT_TOP;
+    const char* symPath = nullptr;
+    const char* foldedPath = nullptr;
+    bool byAddress = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &frames) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--sample") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &samplePeriod) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &top) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--sym") == 0 && i + 1 < argc)
+        {
+            symPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--folded") == 0 && i + 1 < argc)
+        {
+            foldedPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--by-address") == 0)
+        {
+            byAddress = true;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintProfileUsage();
+            return 1;
+        }
+    }
+
+    if (samplePeriod == 0 || samplePeriod > UINT32_MAX)
+    {
+        fprintf(stderr, "--sample must be between 1 and %u.\n", UINT32_MAX);
+        return 1;
+    }
+
+    // - Create the context, cartridge and profiler.
+    int result = 1;
+    gbContext* context = gbCreateContext(false);
+    gbCartridge* cartridge = gbCreateCartridge(argv[0]);
+    gbProfiler* profiler = gbCreateProfiler((uint32_t) samplePeriod);
+    if (
+        context == nullptr || cartridge == nullptr || profiler == nullptr ||
+        gbAttachCartridge(context, cartridge) == false ||
+        gbAttachProfiler(context, profiler) == false
+    )
+    {
+        goto cleanup;
+    }
+
+    if (symPath != nullptr)
+    {
+        if (gbLoadProfilerSymbols(profiler, symPath) == false) { goto cleanup; }
+        printf("Loaded %zu symbols from '%s'.\n",
+            gbGetProfilerSymbolCount(profiler), symPath);
+    }
+    else
+    {
+        gbtLoadDefaultSymbols(profiler, argv[0]);
+    }
+
+    // - Run the ROM. A ROM which locks up has nothing more to profile.
+    double start = gbtGetSeconds();
+    gbStopReason reason = GB_SR_TICK_BUDGET;
+    if (gbRun(context, frames * GBT_PROFILE_FRAME_CYCLES, &reason) == false)
+    {
+        fprintf(stderr, "The ROM stopped with an emulation error.\n");
+    }
+    else if (reason != GB_SR_TICK_BUDGET)
+    {
+        printf("The ROM stopped early: %s.\n", gbStringifyStopReason(reason));
+    }
+
+    double seconds = gbtGetSeconds() - start;
+
+    // - Print the report.
+    if (gbBuildProfilerReport(profiler, byAddress == false) == false)
+    {
+        goto cleanup;
+    }
+
+    size_t count = 0;
+    const gbProfilerEntry* entries = gbGetProfilerReport(profiler, &count);
+    uint64_t total = gbGetProfilerTotalCycles(profiler);
+    uint64_t halted = gbGetProfilerHaltedCycles(profiler);
+    printf("\nProfiled %llu T-cycles in %.2fs (%.1f%% halted).\n\n",
+        (unsigned long long) total, seconds,
+        (total > 0) ? 100.0 * (double) halted / (double) total : 0.0);
+    printf("  %14s  %6s  %-9s  %s\n", "T-cycles", "%", "Address", "Symbol");
+    for (size_t i = 0; i < count && i < top; ++i)
+    {
+        printf("  %14llu  %5.1f%%  $%02X:%04X  %s\n",
+            (unsigned long long) entries[i].cycles,
+            (total > 0) ? 100.0 * (double) entries[i].cycles / (double) total : 0.0,
+            entries[i].bank, entries[i].address,
+            (entries[i].symbol != nullptr) ? entries[i].symbol : "");
+    }
+
+    if (count > top)
+    {
+        printf("  ... and %zu more.\n", count - (size_t) top);
+    }
+
+    if (foldedPath != nullptr)
+    {
+        if (gbSaveProfilerFoldedStacks(profiler, foldedPath) == false) { goto cleanup; }
+        printf("\nWrote folded stacks to '%s'.\n", foldedPath);
+    }
+
+    result = 0;
+
+cleanup:
+    gbDestroyContext(context);
+    gbDestroyCartridge(cartridge);
+    gbDestroyProfiler(profiler);
+    return result;
+}
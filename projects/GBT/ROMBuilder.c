@@ -0,0 +1,193 @@
+/**
+ * @file    GBT/ROMBuilder.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains definitions for `gbt`'s ROM builder.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/ROMBuilder.h>
+#include <stdarg.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The logo bitmap which the boot ROM expects at `$0104`.
+ */
+static const uint8_t GBT_NINTENDO_LOGO[48] = {
+    0xCE, 0xED, 0x66, 0x66, 0xCC, 0x0D, 0x00, 0x0B, 0x03, 0x73, 0x00, 0x83,
+    0x00, 0x0C, 0x00, 0x0D, 0x00, 0x08, 0x11, 0x1F, 0x88, 0x89, 0x00, 0x0E,
+    0xDC, 0xCC, 0x6E, 0xE6, 0xDD, 0xDD, 0xD9, 0x99, 0xBB, 0xBB, 0x67, 0x63,
+    0x6E, 0x0E, 0xEC, 0xCC, 0xDD, 0xDC, 0x99, 0x9F, 0xBB, 0xB9, 0x33, 0x3E
+};
+
+/* Private Function Declarations **********************************************/
+
+static void gbtFinalizeChecksums (gbtROMBuilder* builder);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtFinalizeChecksums (gbtROMBuilder* builder)
+{
+    // - Header checksum, over `$0134`-`$014C`.
+    uint8_t headerChecksum = 0;
+    for (size_t i = 0x0134; i <= 0x014C; ++i)
+    {
+        headerChecksum = headerChecksum - builder->image[i] - 1;
+    }
+
+    builder->image[0x014D] = headerChecksum;
+
+    // - Global checksum, over every byte but itself; stored big-endian.
+    uint16_t globalChecksum = 0;
+    for (size_t i = 0; i < builder->size; ++i)
+    {
+        if (i != 0x014E && i != 0x014F)
+        {
+            globalChecksum += builder->image[i];
+        }
+    }
+
+    builder->image[0x014E] = globalChecksum >> 8;
+    builder->image[0x014F] = globalChecksum & 0xFF;
+}
+
+/* Public Function Definitions ************************************************/
+
+bool gbtInitROMBuilder (gbtROMBuilder* builder, const char* title,
+    uint8_t cartridgeType, uint8_t romSizeCode, uint8_t ramSizeCode)
+{
+    gbCheckv(builder != nullptr, false, "No valid 'gbtROMBuilder' provided.");
+    gbCheckv(romSizeCode <= 0x08, false, "ROM size code $%02X is not supported.",
+        romSizeCode);
+
+    memset(builder, 0, sizeof(*builder));
+    builder->bankCount = 2 << romSizeCode;
+    builder->size = (size_t) builder->bankCount * GB_ROM_BANK_SIZE;
+    builder->image = gbCreateZero(builder->size, uint8_t);
+    gbCheckpv(builder->image != nullptr, false, "Error allocating memory for ROM image");
+
+    // - Write the header.
+    memcpy(builder->image + 0x0104, GBT_NINTENDO_LOGO, sizeof(GBT_NINTENDO_LOGO));
+    if (title != nullptr)
+    {
+        size_t length = strlen(title);
+        memcpy(builder->image + 0x0134, title, (length < 15) ? length : 15);
+    }
+
+    builder->image[0x0147] = cartridgeType;
+    builder->image[0x0148] = romSizeCode;
+    builder->image[0x0149] = ramSizeCode;
+
+    // - Entry point: `NOP`, then `JP $0150`.
+    gbtSetROMOrigin(builder, 0, 0x0100);
+    gbtEmit(builder, 4, 0x00, 0xC3, 0x50, 0x01);
+    gbtSetROMOrigin(builder, 0, 0x0150);
+    return true;
+}
+
+void gbtFreeROMBuilder (gbtROMBuilder* builder)
+{
+    if (builder != nullptr)
+    {
+        gbDestroy(builder->image);
+    }
+}
+
+void gbtSetROMOrigin (gbtROMBuilder* builder, uint16_t bank, uint16_t address)
+{
+    builder->bank = bank;
+    builder->address = address;
+}
+
+uint16_t gbtGetROMOrigin (const gbtROMBuilder* builder)
+{
+    return builder->address;
+}
+
+void gbtEmit (gbtROMBuilder* builder, size_t count, ...)
+{
+    va_list args;
+    va_start(args, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t value = (uint8_t) va_arg(args, int);
+
+        // - Translate the CPU address into an offset into the image.
+        size_t offset = (builder->address < GB_ROMX_START) ?
+            builder->address :
+            (size_t) builder->bank * GB_ROM_BANK_SIZE +
+                (builder->address - GB_ROMX_START);
+        bool inBounds =
+            builder->address <= GB_ROMX_END && offset < builder->size &&
+            (builder->bank == 0) == (builder->address < GB_ROMX_START);
+        if (inBounds == false)
+        {
+            builder->overflowed = true;
+            break;
+        }
+
+        builder->image[offset] = value;
+        builder->address++;
+    }
+
+    va_end(args);
+}
+
+void gbtEmitJR (gbtROMBuilder* builder, uint8_t opcode, uint16_t target)
+{
+    int displacement = (int) target - (int) (builder->address + 2);
+    if (displacement < -128 || displacement > 127)
+    {
+        builder->overflowed = true;
+        return;
+    }
+
+    gbtEmit(builder, 2, opcode, displacement & 0xFF);
+}
+
+void gbtFillROMBank (gbtROMBuilder* builder, uint16_t bank, uint8_t value)
+{
+    if (bank == 0 || bank >= builder->bankCount)
+    {
+        builder->overflowed = true;
+        return;
+    }
+
+    memset(builder->image + (size_t) bank * GB_ROM_BANK_SIZE, value,
+        GB_ROM_BANK_SIZE);
+}
+
+gbCartridge* gbtFinishROMBuilder (gbtROMBuilder* builder)
+{
+    gbCheckv(builder != nullptr && builder->image != nullptr, nullptr,
+        "No valid 'gbtROMBuilder' provided.");
+    gbCheckv(builder->overflowed == false, nullptr,
+        "Code was emitted outside of the ROM image.");
+
+    gbtFinalizeChecksums(builder);
+    return gbCreateCartridgeFromMemory(builder->image, builder->size);
+}
+
+bool gbtSaveROMBuilder (gbtROMBuilder* builder, const char* filepath)
+{
+    gbCheckv(builder != nullptr && builder->image != nullptr, false,
+        "No valid 'gbtROMBuilder' provided.");
+
+    gbtFinalizeChecksums(builder);
+
+    FILE* fp = fopen(filepath, "wb");
+    gbCheckpv(fp != nullptr, false, "Failed to open ROM file '%s' for writing",
+        filepath);
+
+    bool result = fwrite(builder->image, 1, builder->size, fp) == builder->size;
+    if (result == false)
+    {
+        gbLogErrno("Error writing ROM file '%s'", filepath);
+    }
+
+    fclose(fp);
+    return result;
+}
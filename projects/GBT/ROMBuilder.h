@@ -0,0 +1,113 @@
+/**
+ * @file    GBT/ROMBuilder.h
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains declarations for `gbt`'s ROM builder, a tiny assembler
+ *          which generates deterministic test and benchmark ROM images in
+ *          memory.
+ */
+
+#pragma once
+
+/* Public Includes ************************************************************/
+
+#include <GB/GB.h>
+
+/* Public Unions and Structures ***********************************************/
+
+/**
+ * @brief   Defines a structure holding a ROM image under construction.
+ *
+ * Code is emitted at a cursor, which is positioned with @a `gbtSetROMOrigin`
+ * at a bank and CPU address (`$0000`-`$3FFF` for bank 0, `$4000`-`$7FFF` for
+ * any switchable bank).
+ */
+typedef struct gbtROMBuilder
+{
+    uint8_t*    image;
+    size_t      size;
+    uint16_t    bankCount;
+    uint16_t    bank;               // The bank the cursor is in.
+    uint16_t    address;            // The CPU address of the cursor.
+    bool        overflowed;         // Set if anything was emitted out of bounds.
+} gbtROMBuilder;
+
+/* Public Function Declarations ***********************************************/
+
+/**
+ * @brief   Creates an empty ROM image with a valid cartridge header, with the
+ *          cursor placed at `$0150` in bank 0, just past the header. The entry
+ *          point at `$0100` jumps there.
+ *
+ * @param   builder         A pointer to the @a `gbtROMBuilder` to initialize.
+ * @param   title           The title written into the header (up to 15 chars).
+ * @param   cartridgeType   The cartridge type byte (e.g., `0x1B` for MBC5 with
+ *                          battery-backed RAM).
+ * @param   romSizeCode     The ROM size byte; the image holds `2 << code` banks.
+ * @param   ramSizeCode     The RAM size byte.
+ *
+ * @return  If successful, returns `true`.
+ *          If allocation fails, returns `false`.
+ */
+bool gbtInitROMBuilder (gbtROMBuilder* builder, const char* title,
+    uint8_t cartridgeType, uint8_t romSizeCode, uint8_t ramSizeCode);
+
+/**
+ * @brief   Frees the ROM image held by the given builder.
+ */
+void gbtFreeROMBuilder (gbtROMBuilder* builder);
+
+/**
+ * @brief   Moves the builder's cursor to the given bank and CPU address.
+ */
+void gbtSetROMOrigin (gbtROMBuilder* builder, uint16_t bank, uint16_t address);
+
+/**
+ * @brief   Retrieves the CPU address of the builder's cursor, for use as the
+ *          target of a later branch.
+ */
+uint16_t gbtGetROMOrigin (const gbtROMBuilder* builder);
+
+/**
+ * @brief   Emits the given bytes at the builder's cursor, then advances it.
+ *
+ * @param   builder     A pointer to the @a `gbtROMBuilder` to emit into.
+ * @param   count       The number of bytes which follow.
+ * @param   ...         The bytes to emit, as `int`s.
+ */
+void gbtEmit (gbtROMBuilder* builder, size_t count, ...);
+
+/**
+ * @brief   Emits a relative jump (`JR`, or one of its conditional forms) to the
+ *          given target address, which must lie within reach.
+ *
+ * @param   builder     A pointer to the @a `gbtROMBuilder` to emit into.
+ * @param   opcode      The `JR` opcode to emit (`0x18`, `0x20`, `0x28`, `0x30`
+ *                      or `0x38`).
+ * @param   target      The CPU address to jump to.
+ */
+void gbtEmitJR (gbtROMBuilder* builder, uint8_t opcode, uint16_t target);
+
+/**
+ * @brief   Fills a whole switchable bank with the given byte.
+ */
+void gbtFillROMBank (gbtROMBuilder* builder, uint16_t bank, uint8_t value);
+
+/**
+ * @brief   Finalizes the header and global checksums, then loads the image
+ *          into a new cartridge. The builder may be freed afterwards.
+ *
+ * @return  If successful, returns a pointer to the new @a `gbCartridge`.
+ *          If anything was emitted out of bounds, or loading fails, returns
+ *          `nullptr`.
+ */
+gbCartridge* gbtFinishROMBuilder (gbtROMBuilder* builder);
+
+/**
+ * @brief   Writes the builder's ROM image to a file, for use with other tools.
+ *          Checksums are finalized first.
+ *
+ * @return  If successful, returns `true`. Otherwise, returns `false`.
+ */
+bool gbtSaveROMBuilder (gbtROMBuilder* builder, const char* filepath);
@@ -0,0 +1,525 @@
+/**
+ * @file    GBT/RunCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt run` subcommand, which runs
+ *          test ROMs headless across worker threads and reports whether each
+ *          one passed or failed.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The default T-cycle budget given to each test ROM: two minutes of
+ *          emulated time at the normal-speed clock rate.
+ */
+#define GBT_RUN_DEFAULT_CYCLES      (4194304ull * 120)
+
+/**
+ * @brief   The default wall-clock timeout given to each test ROM, in seconds.
+ */
+#define GBT_RUN_DEFAULT_TIMEOUT     30ull
+
+/**
+ * @brief   The number of T-cycles run between wall-clock timeout checks.
+ */
+#define GBT_RUN_TIMEOUT_INTERVAL    (1ull << 20)
+
+/**
+ * @brief   The maximum number of serial output bytes kept per test ROM.
+ */
+#define GBT_RUN_SERIAL_CAPACITY     4096
+
+/**
+ * @brief   The extensions of the files collected from directories.
+ */
+static const char* const GBT_RUN_EXTENSIONS[] = { "gb", "gbc", nullptr };
+
+/**
+ * @brief   Enumerates the possible outcomes of running a test ROM.
+ */
+typedef enum gbtVerdict
+{
+    GBT_VERDICT_PASS,           /** @brief The ROM reported success. */
+    GBT_VERDICT_FAIL,           /** @brief The ROM reported failure. */
+    GBT_VERDICT_CYCLE_BUDGET,   /** @brief The ROM exhausted its T-cycle budget. */
+    GBT_VERDICT_TIMEOUT,        /** @brief The ROM exceeded its wall-clock timeout. */
+    GBT_VERDICT_TERMINAL,       /** @brief The ROM locked up without reporting a verdict. */
+    GBT_VERDICT_ERROR           /** @brief The ROM could not be loaded or run. */
+} gbtVerdict;
+
+/**
+ * @brief   Names of the @a `gbtVerdict` values, as printed in reports.
+ */
+static const char* GBT_VERDICT_NAMES[] = {
+    [GBT_VERDICT_PASS]          = "pass",
+    [GBT_VERDICT_FAIL]          = "fail",
+    [GBT_VERDICT_CYCLE_BUDGET]  = "cycle-budget",
+    [GBT_VERDICT_TIMEOUT]       = "timeout",
+    [GBT_VERDICT_TERMINAL]      = "terminal",
+    [GBT_VERDICT_ERROR]         = "error",
+};
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding a test ROM to be run, and the results of
+ *          running it.
+ */
+typedef struct gbtRunJob
+{
+    // Input
+    const char* path;               // Owned by the command's file list.
+
+    // Results
+    gbtVerdict  verdict;
+    bool        finished;           // Set once a pass/fail signature is seen.
+    const char* detector;           // The signature which decided the verdict.
+    uint64_t    cycles;
+    double      seconds;
+    char        serial[GBT_RUN_SERIAL_CAPACITY + 1];
+    size_t      serialLength;
+} gbtRunJob;
+
+/**
+ * @brief   Defines a structure holding the settings and work queue shared by
+ *          all worker threads.
+ */
+typedef struct gbtRunQueue
+{
+    gbtRunJob*      jobs;
+    gbtWorkQueue    work;
+    uint64_t        cycleBudget;
+    uint64_t        timeout;
+    const char**    patchPaths;     // Applied to every ROM, in order.
+    size_t          patchCount;
+} gbtRunQueue;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintRunUsage ();
+static void gbtOnSerialTransfer (gbContext* context, uint8_t sent,
+    uint8_t received);
+static void gbtOnInstructionExecute (gbContext* context, uint16_t address,
+    uint16_t opcode, bool success);
+static void gbtExecuteRunJob (gbtRunJob* job, const gbtRunQueue* queue);
+static int gbtRunWorker (void* argument);
+static void gbtWriteEscaped (FILE* fp, const char* text, size_t length,
+    bool xml);
+static bool gbtWriteJSONReport (const char* filepath, const gbtRunQueue* queue);
+static bool gbtWriteJUnitReport (const char* filepath, const gbtRunQueue* queue);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintRunUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt run <rom-or-directory>... [--jobs N] [--cycles N] [--timeout SECONDS]\n"
+        "                                [--json FILE] [--junit FILE] [--patch FILE]...\n"
+        "\n"
+        "Each '--patch' names an IPS, UPS or BPS patch, applied to every ROM in the\n"
+        "order given.\n"
+        "Directories are searched recursively for '.gb' and '.gbc' files.\n"
+        "A ROM passes when it prints \"Passed\" over the serial port, or executes\n"
+        "'LD B, B' with the Fibonacci register signature (B=3 C=5 D=8 E=13 H=21\n"
+        "L=34). It fails on \"Failed\", or 'LD B, B' with all registers set to $42.\n"
+    );
+}
+
+void gbtOnSerialTransfer (gbContext* context, uint8_t sent, uint8_t received)
+{
+    gbtRunJob* job = gbGetUserdata(context);
+    if (job == nullptr || job->serialLength >= GBT_RUN_SERIAL_CAPACITY)
+    {
+        return;
+    }
+
+    job->serial[job->serialLength++] = (char) sent;
+    job->serial[job->serialLength] = '\0';
+
+    // - Blargg's test ROMs print their verdict over the serial port.
+    if (strstr(job->serial, "Passed") != nullptr)
+    {
+        job->verdict = GBT_VERDICT_PASS;
+        job->finished = true;
+        job->detector = "serial";
+        gbRequestStop(context);
+    }
+    else if (strstr(job->serial, "Failed") != nullptr)
+    {
+        job->verdict = GBT_VERDICT_FAIL;
+        job->finished = true;
+        job->detector = "serial";
+        gbRequestStop(context);
+    }
+}
+
+void gbtOnInstructionExecute (gbContext* context, uint16_t address,
+    uint16_t opcode, bool success)
+{
+    // - Mooneye's test ROMs signal completion with `LD B, B`.
+    if (opcode != 0x0040)
+    {
+        return;
+    }
+
+    gbtRunJob* job = gbGetUserdata(context);
+    const gbProcessorRegisterFile* registers =
+        gbGetRegisterFile(gbGetProcessor(context));
+    if (job == nullptr || registers == nullptr)
+    {
+        return;
+    }
+
+    if (
+        registers->b == 3 && registers->c == 5 && registers->d == 8 &&
+        registers->e == 13 && registers->h == 21 && registers->l == 34
+    )
+    {
+        job->verdict = GBT_VERDICT_PASS;
+        job->finished = true;
+        job->detector = "mooneye";
+        gbRequestStop(context);
+    }
+    else if (
+        registers->b == 0x42 && registers->c == 0x42 && registers->d == 0x42 &&
+        registers->e == 0x42 && registers->h == 0x42 && registers->l == 0x42
+    )
+    {
+        job->verdict = GBT_VERDICT_FAIL;
+        job->finished = true;
+        job->detector = "mooneye";
+        gbRequestStop(context);
+    }
+}
+
+void gbtExecuteRunJob (gbtRunJob* job, const gbtRunQueue* queue)
+{
+    double start = gbtGetSeconds();
+    job->verdict = GBT_VERDICT_ERROR;
+    job->detector = "none";
+
+    // - Each job gets a context of its own, owned by this worker thread.
+    gbContext* context = gbCreateContext(false);
+    gbCartridge* cartridge = gbCreateCartridgeWithPatches(job->path,
+        queue->patchPaths, queue->patchCount);
+    if (
+        context == nullptr || cartridge == nullptr ||
+        gbAttachCartridge(context, cartridge) == false
+    )
+    {
+        goto cleanup;
+    }
+
+    gbProcessor* processor = gbGetProcessor(context);
+    gbSetUserdata(context, job);
+    gbSetSerialTransferCallback(gbGetSerial(context), gbtOnSerialTransfer);
+    gbSetInstructionExecuteCallback(processor, gbtOnInstructionExecute);
+
+    // - Run until the ROM reports a verdict, locks up, or its budgets run out.
+    //   The wall clock is checked between slices of the cycle budget.
+    while (job->finished == false)
+    {
+        uint64_t remaining = queue->cycleBudget - job->cycles;
+        if (remaining == 0)
+        {
+            job->verdict = GBT_VERDICT_CYCLE_BUDGET;
+            break;
+        }
+        else if (gbtGetSeconds() - start >= (double) queue->timeout)
+        {
+            job->verdict = GBT_VERDICT_TIMEOUT;
+            break;
+        }
+
+        gbStopReason reason = GB_SR_TICK_BUDGET;
+        bool ok = gbRun(context,
+            (remaining < GBT_RUN_TIMEOUT_INTERVAL) ? remaining : GBT_RUN_TIMEOUT_INTERVAL,
+            &reason);
+        job->cycles = gbGetTickCyclesConsumed(processor);
+        if (job->cycles > queue->cycleBudget)
+        {
+            job->cycles = queue->cycleBudget;
+        }
+
+        if (ok == false)
+        {
+            job->detector = "emulation-error";
+            break;
+        }
+        else if (
+            job->finished == false &&
+            (reason == GB_SR_SELF_JUMP || reason == GB_SR_HALT || reason == GB_SR_STOP)
+        )
+        {
+            // - The ROM can never report a verdict from here on.
+            job->verdict = GBT_VERDICT_TERMINAL;
+            job->detector = gbStringifyStopReason(reason);
+            break;
+        }
+    }
+
+cleanup:
+    gbDestroyContext(context);
+    gbDestroyCartridge(cartridge);
+    job->seconds = gbtGetSeconds() - start;
+}
+
+int gbtRunWorker (void* argument)
+{
+    gbtRunQueue* queue = argument;
+
+    // - Pull jobs off the shared queue until it is empty.
+    size_t index;
+    while (gbtTakeJob(&queue->work, &index) == true)
+    {
+        gbtRunJob* job = &queue->jobs[index];
+        gbtExecuteRunJob(job, queue);
+        printf("[%-12s] %6.2fs  %s\n", GBT_VERDICT_NAMES[job->verdict],
+            job->seconds, job->path);
+    }
+
+    return 0;
+}
+
+void gbtWriteEscaped (FILE* fp, const char* text, size_t length, bool xml)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        unsigned char ch = (unsigned char) text[i];
+        if (xml == true)
+        {
+            switch (ch)
+            {
+                case '&':   fputs("&amp;", fp); break;
+                case '<':   fputs("&lt;", fp); break;
+                case '>':   fputs("&gt;", fp); break;
+                case '"':   fputs("&quot;", fp); break;
+                case '\n':
+                case '\t':  fputc(ch, fp); break;
+                default:    fputc((ch < 0x20 || ch >= 0x7F) ? '?' : ch, fp); break;
+            }
+        }
+        else
+        {
+            switch (ch)
+            {
+                case '"':   fputs("\\\"", fp); break;
+                case '\\':  fputs("\\\\", fp); break;
+                case '\n':  fputs("\\n", fp); break;
+                case '\t':  fputs("\\t", fp); break;
+                default:
+                    if (ch < 0x20 || ch >= 0x7F) { fprintf(fp, "\\u%04x", ch); }
+                    else                         { fputc(ch, fp); }
+                    break;
+            }
+        }
+    }
+}
+
+bool gbtWriteJSONReport (const char* filepath, const gbtRunQueue* queue)
+{
+    FILE* fp = fopen(filepath, "w");
+    gbCheckpv(fp != nullptr, false, "Failed to open report file '%s' for writing",
+        filepath);
+
+    fprintf(fp, "{\n  \"results\": [\n");
+    for (size_t i = 0; i < queue->work.jobCount; ++i)
+    {
+        const gbtRunJob* job = &queue->jobs[i];
+        fprintf(fp, "    { \"rom\": \"");
+        gbtWriteEscaped(fp, job->path, strlen(job->path), false);
+        fprintf(fp, "\", \"verdict\": \"%s\", \"detector\": \"%s\", "
+            "\"cycles\": %llu, \"seconds\": %.3f, \"serial\": \"",
+            GBT_VERDICT_NAMES[job->verdict], job->detector,
+            (unsigned long long) job->cycles, job->seconds);
+        gbtWriteEscaped(fp, job->serial, job->serialLength, false);
+        fprintf(fp, "\" }%s\n", (i + 1 < queue->work.jobCount) ? "," : "");
+    }
+
+    fprintf(fp, "  ]\n}\n");
+    fclose(fp);
+    return true;
+}
+
+bool gbtWriteJUnitReport (const char* filepath, const gbtRunQueue* queue)
+{
+    FILE* fp = fopen(filepath, "w");
+    gbCheckpv(fp != nullptr, false, "Failed to open report file '%s' for writing",
+        filepath);
+
+    size_t failures = 0, errors = 0;
+    double total = 0.0;
+    for (size_t i = 0; i < queue->work.jobCount; ++i)
+    {
+        failures += (queue->jobs[i].verdict == GBT_VERDICT_FAIL);
+        errors += (
+            queue->jobs[i].verdict != GBT_VERDICT_PASS &&
+            queue->jobs[i].verdict != GBT_VERDICT_FAIL
+        );
+        total += queue->jobs[i].seconds;
+    }
+
+    fprintf(fp, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    fprintf(fp, "<testsuite name=\"gbt\" tests=\"%zu\" failures=\"%zu\" "
+        "errors=\"%zu\" time=\"%.3f\">\n", queue->work.jobCount, failures, errors, total);
+    for (size_t i = 0; i < queue->work.jobCount; ++i)
+    {
+        const gbtRunJob* job = &queue->jobs[i];
+        fprintf(fp, "  <testcase name=\"");
+        gbtWriteEscaped(fp, job->path, strlen(job->path), true);
+        fprintf(fp, "\" time=\"%.3f\">\n", job->seconds);
+
+        if (job->verdict == GBT_VERDICT_FAIL)
+        {
+            fprintf(fp, "    <failure message=\"failed (%s)\"/>\n", job->detector);
+        }
+        else if (job->verdict != GBT_VERDICT_PASS)
+        {
+            fprintf(fp, "    <error message=\"%s after %llu cycles\"/>\n",
+                GBT_VERDICT_NAMES[job->verdict], (unsigned long long) job->cycles);
+        }
+
+        if (job->serialLength > 0)
+        {
+            fprintf(fp, "    <system-out>");
+            gbtWriteEscaped(fp, job->serial, job->serialLength, true);
+            fprintf(fp, "</system-out>\n");
+        }
+
+        fprintf(fp, "  </testcase>\n");
+    }
+
+    fprintf(fp, "</testsuite>\n");
+    fclose(fp);
+    return true;
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtRunCommand (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintRunUsage();
+        return 1;
+    }
+
+    // - Parse the options, and collect the ROMs named by the other arguments.
+    gbtRunQueue queue = {
+        .cycleBudget = GBT_RUN_DEFAULT_CYCLES,
+        .timeout = GBT_RUN_DEFAULT_TIMEOUT
+    };
+    uint64_t workerCount = (uint64_t) gbtGetProcessorCount();
+    const char* jsonPath = nullptr;
+    const char* junitPath = nullptr;
+    gbtFileList roms = { 0 };
+    int result = 1;
+
+    for (int i = 0; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &workerCount) == false) { goto cleanup; }
+        }
+        else if (strcmp(argv[i], "--cycles") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &queue.cycleBudget) == false) { goto cleanup; }
+        }
+        else if (strcmp(argv[i], "--timeout") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &queue.timeout) == false) { goto cleanup; }
+        }
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            jsonPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--junit") == 0 && i + 1 < argc)
+        {
+            junitPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--patch") == 0 && i + 1 < argc)
+        {
+            if (queue.patchPaths == nullptr)
+            {
+                queue.patchPaths = gbCreate(argc, const char*);
+                if (queue.patchPaths == nullptr)
+                {
+                    gbLogErrno("Error allocating memory for patch list");
+                    goto cleanup;
+                }
+            }
+
+            queue.patchPaths[queue.patchCount++] = argv[++i];
+        }
+        else if (strncmp(argv[i], "--", 2) == 0)
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintRunUsage();
+            goto cleanup;
+        }
+        else if (gbtCollectFiles(argv[i], GBT_RUN_EXTENSIONS, &roms) == false)
+        {
+            goto cleanup;
+        }
+    }
+
+    if (roms.count == 0)
+    {
+        fprintf(stderr, "No test ROMs found.\n");
+        goto cleanup;
+    }
+
+    // - Sort the ROMs so that reports are stable from run to run, then create
+    //   a job for each.
+    gbtSortFileList(&roms);
+    queue.jobs = gbCreateZero(roms.count, gbtRunJob);
+    if (queue.jobs == nullptr)
+    {
+        gbLogErrno("Error allocating memory for test jobs");
+        goto cleanup;
+    }
+
+    queue.work.jobCount = roms.count;
+    for (size_t i = 0; i < roms.count; ++i)
+    {
+        queue.jobs[i].path = roms.paths[i];
+    }
+
+    // - Spawn the workers, then wait for them to drain the queue.
+    double start = gbtGetSeconds();
+    size_t workers = gbtRunWorkers(&queue.work, (size_t) workerCount,
+        gbtRunWorker, &queue);
+
+    // - Summarize, and write the requested reports.
+    size_t passed = 0;
+    for (size_t i = 0; i < queue.work.jobCount; ++i)
+    {
+        passed += (queue.jobs[i].verdict == GBT_VERDICT_PASS);
+    }
+
+    printf("\n%zu of %zu test ROMs passed in %.2fs on %zu worker(s).\n", passed,
+        queue.work.jobCount, gbtGetSeconds() - start, workers);
+
+    if (
+        (jsonPath != nullptr && gbtWriteJSONReport(jsonPath, &queue) == false) ||
+        (junitPath != nullptr && gbtWriteJUnitReport(junitPath, &queue) == false)
+    )
+    {
+        goto cleanup;
+    }
+
+    result = (passed == queue.work.jobCount) ? 0 : 1;
+
+cleanup:
+    gbDestroy(queue.patchPaths);
+    gbDestroy(queue.jobs);
+    gbtFreeFileList(&roms);
+    return result;
+}
@@ -0,0 +1,663 @@
+/**
+ * @file    GBT/SM83Command.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt sm83` subcommand, which runs
+ *          per-opcode, single-step JSON test vectors against the processor
+ *          across worker threads.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+#include <GBT/JSON.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The maximum number of bus accesses logged for a single test case.
+ *          No instruction performs more than six.
+ */
+#define GBT_SM83_MAX_ACCESSES       16
+
+/**
+ * @brief   The maximum length of the description of a test file's first
+ *          failure.
+ */
+#define GBT_SM83_DETAIL_CAPACITY    512
+
+/**
+ * @brief   The extensions of the files collected from directories.
+ */
+static const char* const GBT_SM83_EXTENSIONS[] = { "json", nullptr };
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a structure holding a single bus access, logged by the flat
+ *          test bus or read from a test case's expected cycles.
+ */
+typedef struct gbtSM83Access
+{
+    uint16_t    address;
+    uint8_t     value;
+    bool        write;
+} gbtSM83Access;
+
+/**
+ * @brief   Defines a structure holding a worker thread's context, and the flat,
+ *          64 KiB test bus which replaces its memory map.
+ */
+typedef struct gbtSM83Bus
+{
+    gbContext*      context;
+    uint8_t         memory[0x10000];
+    gbtSM83Access   accesses[GBT_SM83_MAX_ACCESSES];
+    size_t          accessCount;
+    bool            overflowed;
+} gbtSM83Bus;
+
+/**
+ * @brief   Defines a structure holding a test file to be run, and the results
+ *          of running its cases.
+ */
+typedef struct gbtSM83Job
+{
+    const char* path;
+    size_t      passed;
+    size_t      failed;
+    bool        error;              // Set if the file could not be parsed.
+    char        detail[GBT_SM83_DETAIL_CAPACITY];
+} gbtSM83Job;
+
+/**
+ * @brief   Defines a structure holding the settings and work queue shared by
+ *          all worker threads.
+ */
+typedef struct gbtSM83Queue
+{
+    gbtSM83Job*     jobs;
+    gbtWorkQueue    work;
+    bool            checkBus;
+} gbtSM83Queue;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintSM83Usage ();
+static bool gbtReadSM83Bus (const gbContext* context, uint16_t address,
+    uint8_t* outValue);
+static bool gbtWriteSM83Bus (gbContext* context, uint16_t address,
+    uint8_t value);
+static uint64_t gbtGetJSONUnsigned (const gbtJSONDocument* document,
+    const gbtJSONNode* object, const char* key);
+static bool gbtCheckSM83Prefetched (const gbtJSONDocument* document,
+    const gbtJSONNode* tests);
+static bool gbtLoadSM83State (gbtSM83Bus* bus, const gbtJSONDocument* document,
+    const gbtJSONNode* state, bool prefetched);
+static bool gbtCheckSM83State (gbtSM83Bus* bus, const gbtJSONDocument* document,
+    const gbtJSONNode* state, bool prefetched, char* detail, size_t detailSize);
+static bool gbtCheckSM83Cycles (gbtSM83Bus* bus, const gbtJSONDocument* document,
+    const gbtJSONNode* cycles, bool prefetched, uint64_t tickCycles,
+    bool checkBus, char* detail, size_t detailSize);
+static void gbtExecuteSM83Job (gbtSM83Bus* bus, gbtSM83Job* job, bool checkBus);
+static int gbtSM83Worker (void* argument);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintSM83Usage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt sm83 <json-or-directory>... [--jobs N] [--no-bus]\n"
+        "\n"
+        "Runs single-step SM83 test vectors: one JSON array of test cases per\n"
+        "opcode, each with \"initial\" and \"final\" register and RAM states and\n"
+        "the expected bus \"cycles\". Directories are searched recursively for\n"
+        "'.json' files. Each case executes one instruction against a flat 64 KiB\n"
+        "test bus. --no-bus skips the bus access comparison, checking only the\n"
+        "final state and the M-cycle count.\n"
+    );
+}
+
+bool gbtReadSM83Bus (const gbContext* context, uint16_t address,
+    uint8_t* outValue)
+{
+    gbtSM83Bus* bus = gbGetUserdata(context);
+    *outValue = bus->memory[address];
+    if (bus->accessCount < GBT_SM83_MAX_ACCESSES)
+    {
+        bus->accesses[bus->accessCount++] =
+            (gbtSM83Access) { address, *outValue, false };
+    }
+    else
+    {
+        bus->overflowed = true;
+    }
+
+    return true;
+}
+
+bool gbtWriteSM83Bus (gbContext* context, uint16_t address, uint8_t value)
+{
+    gbtSM83Bus* bus = gbGetUserdata(context);
+    bus->memory[address] = value;
+    if (bus->accessCount < GBT_SM83_MAX_ACCESSES)
+    {
+        bus->accesses[bus->accessCount++] =
+            (gbtSM83Access) { address, value, true };
+    }
+    else
+    {
+        bus->overflowed = true;
+    }
+
+    return true;
+}
+
+uint64_t gbtGetJSONUnsigned (const gbtJSONDocument* document,
+    const gbtJSONNode* object, const char* key)
+{
+    const gbtJSONNode* member = gbtGetJSONMember(document, object, key);
+    return (member != nullptr && member->type == GBT_JSON_NUMBER) ?
+        (uint64_t) member->number : 0;
+}
+
+bool gbtCheckSM83Prefetched (const gbtJSONDocument* document,
+    const gbtJSONNode* tests)
+{
+    // - Some test vector sets start each case with `PC` at the opcode; others
+    //   start just past it, modeling the opcode fetch which overlaps the
+    //   previous instruction. Vote on which one the file uses, by comparing
+    //   the opcode in each case's name with the RAM at and before `PC`.
+    size_t atPC = 0, beforePC = 0;
+    for (
+        const gbtJSONNode* test = gbtGetJSONChild(document, tests);
+        test != nullptr;
+        test = gbtGetJSONNext(document, test)
+    )
+    {
+        const gbtJSONNode* name = gbtGetJSONMember(document, test, "name");
+        const gbtJSONNode* initial = gbtGetJSONMember(document, test, "initial");
+        const gbtJSONNode* ram = gbtGetJSONMember(document, initial, "ram");
+        if (name == nullptr || name->type != GBT_JSON_STRING || ram == nullptr)
+        {
+            continue;
+        }
+
+        unsigned long opcode = strtoul(name->string, nullptr, 16);
+        uint64_t pc = gbtGetJSONUnsigned(document, initial, "pc");
+        for (
+            const gbtJSONNode* entry = gbtGetJSONChild(document, ram);
+            entry != nullptr;
+            entry = gbtGetJSONNext(document, entry)
+        )
+        {
+            const gbtJSONNode* address = gbtGetJSONChild(document, entry);
+            const gbtJSONNode* value = gbtGetJSONNext(document, address);
+            if (address == nullptr || value == nullptr)
+            {
+                continue;
+            }
+
+            if ((uint64_t) address->number == pc && (unsigned long) value->number == opcode)
+            {
+                atPC++;
+            }
+            else if ((uint64_t) address->number + 1 == pc &&
+                (unsigned long) value->number == opcode)
+            {
+                beforePC++;
+            }
+        }
+    }
+
+    return beforePC > atPC;
+}
+
+bool gbtLoadSM83State (gbtSM83Bus* bus, const gbtJSONDocument* document,
+    const gbtJSONNode* state, bool prefetched)
+{
+    gbProcessor* processor = gbGetProcessor(bus->context);
+
+    // - Reset the processor, timer and serial port, then clear any interrupt
+    //   they request at power-on, so that none is serviced mid-test.
+    memset(bus->memory, 0, sizeof(bus->memory));
+    if (
+        gbInitializeProcessor(processor) == false ||
+        gbInitializeTimer(gbGetTimer(bus->context)) == false ||
+        gbInitializeSerial(gbGetSerial(bus->context)) == false ||
+        gbWriteIF(processor, 0x00, nullptr, nullptr) == false
+    )
+    {
+        return false;
+    }
+
+    uint16_t pc = (uint16_t) gbtGetJSONUnsigned(document, state, "pc");
+    gbWriteRegisterByte(processor, GB_RT_A, (uint8_t) gbtGetJSONUnsigned(document, state, "a"));
+    gbWriteRegisterByte(processor, GB_RT_F, (uint8_t) gbtGetJSONUnsigned(document, state, "f"));
+    gbWriteRegisterByte(processor, GB_RT_B, (uint8_t) gbtGetJSONUnsigned(document, state, "b"));
+    gbWriteRegisterByte(processor, GB_RT_C, (uint8_t) gbtGetJSONUnsigned(document, state, "c"));
+    gbWriteRegisterByte(processor, GB_RT_D, (uint8_t) gbtGetJSONUnsigned(document, state, "d"));
+    gbWriteRegisterByte(processor, GB_RT_E, (uint8_t) gbtGetJSONUnsigned(document, state, "e"));
+    gbWriteRegisterByte(processor, GB_RT_H, (uint8_t) gbtGetJSONUnsigned(document, state, "h"));
+    gbWriteRegisterByte(processor, GB_RT_L, (uint8_t) gbtGetJSONUnsigned(document, state, "l"));
+    gbWriteRegisterWord(processor, GB_RT_SP, (uint16_t) gbtGetJSONUnsigned(document, state, "sp"));
+    gbWriteRegisterWord(processor, GB_RT_PC, (prefetched == true) ? pc - 1 : pc);
+    gbWriteIE(processor, (uint8_t) gbtGetJSONUnsigned(document, state, "ie"),
+        nullptr, nullptr);
+
+    if (gbtGetJSONUnsigned(document, state, "ime") != 0)
+    {
+        gbEnableInterrupts(processor, true);
+    }
+    else
+    {
+        gbDisableInterrupts(processor);
+    }
+
+    const gbtJSONNode* ram = gbtGetJSONMember(document, state, "ram");
+    for (
+        const gbtJSONNode* entry = gbtGetJSONChild(document, ram);
+        entry != nullptr;
+        entry = gbtGetJSONNext(document, entry)
+    )
+    {
+        const gbtJSONNode* address = gbtGetJSONChild(document, entry);
+        const gbtJSONNode* value = gbtGetJSONNext(document, address);
+        if (address != nullptr && value != nullptr)
+        {
+            bus->memory[(uint16_t) address->number] = (uint8_t) value->number;
+        }
+    }
+
+    bus->accessCount = 0;
+    bus->overflowed = false;
+    return true;
+}
+
+bool gbtCheckSM83State (gbtSM83Bus* bus, const gbtJSONDocument* document,
+    const gbtJSONNode* state, bool prefetched, char* detail, size_t detailSize)
+{
+    const gbProcessor* processor = gbGetProcessor(bus->context);
+
+    // - Compare the registers. With a prefetched opcode, the expected `PC` has
+    //   already moved past the next instruction's opcode.
+    static const struct { const char* key; gbRegisterType type; bool word; } REGISTERS[] = {
+        { "a", GB_RT_A, false }, { "f", GB_RT_F, false },
+        { "b", GB_RT_B, false }, { "c", GB_RT_C, false },
+        { "d", GB_RT_D, false }, { "e", GB_RT_E, false },
+        { "h", GB_RT_H, false }, { "l", GB_RT_L, false },
+        { "sp", GB_RT_SP, true }, { "pc", GB_RT_PC, true },
+    };
+
+    for (size_t i = 0; i < sizeof(REGISTERS) / sizeof(REGISTERS[0]); ++i)
+    {
+        uint64_t expected = gbtGetJSONUnsigned(document, state, REGISTERS[i].key);
+        uint16_t actual = 0;
+        if (REGISTERS[i].word == true)
+        {
+            gbReadRegisterWord(processor, REGISTERS[i].type, &actual);
+            if (REGISTERS[i].type == GB_RT_PC && prefetched == true)
+            {
+                actual++;
+            }
+        }
+        else
+        {
+            uint8_t byte = 0;
+            gbReadRegisterByte(processor, REGISTERS[i].type, &byte);
+            actual = byte;
+        }
+
+        if (actual != (uint16_t) expected)
+        {
+            snprintf(detail, detailSize, "%s = $%04X, expected $%04X",
+                REGISTERS[i].key, actual, (unsigned) expected);
+            return false;
+        }
+    }
+
+    bool masterEnabled = false;
+    gbCheckInterruptMasterEnabled(processor, &masterEnabled);
+    const gbtJSONNode* ime = gbtGetJSONMember(document, state, "ime");
+    if (ime != nullptr && masterEnabled != (ime->number != 0))
+    {
+        snprintf(detail, detailSize, "ime = %u, expected %u", masterEnabled,
+            ime->number != 0);
+        return false;
+    }
+
+    // - Compare the RAM the case names.
+    const gbtJSONNode* ram = gbtGetJSONMember(document, state, "ram");
+    for (
+        const gbtJSONNode* entry = gbtGetJSONChild(document, ram);
+        entry != nullptr;
+        entry = gbtGetJSONNext(document, entry)
+    )
+    {
+        const gbtJSONNode* address = gbtGetJSONChild(document, entry);
+        const gbtJSONNode* value = gbtGetJSONNext(document, address);
+        if (address == nullptr || value == nullptr)
+        {
+            continue;
+        }
+
+        uint16_t where = (uint16_t) address->number;
+        if (bus->memory[where] != (uint8_t) value->number)
+        {
+            snprintf(detail, detailSize, "[$%04X] = $%02X, expected $%02X",
+                where, bus->memory[where], (uint8_t) value->number);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool gbtCheckSM83Cycles (gbtSM83Bus* bus, const gbtJSONDocument* document,
+    const gbtJSONNode* cycles, bool prefetched, uint64_t tickCycles,
+    bool checkBus, char* detail, size_t detailSize)
+{
+    if (cycles == nullptr)
+    {
+        return true;
+    }
+
+    // - Fetching the opcode here takes the place of the next opcode's
+    //   prefetch, so the M-cycle count is the same either way.
+    if (tickCycles != cycles->count * 4)
+    {
+        snprintf(detail, detailSize, "took %llu M-cycles, expected %zu",
+            (unsigned long long) (tickCycles / 4), cycles->count);
+        return false;
+    }
+
+    if (checkBus == false)
+    {
+        return true;
+    }
+
+    // - Gather the expected bus accesses, skipping idle cycles.
+    gbtSM83Access expected[GBT_SM83_MAX_ACCESSES];
+    size_t expectedCount = 0;
+    for (
+        const gbtJSONNode* entry = gbtGetJSONChild(document, cycles);
+        entry != nullptr && expectedCount < GBT_SM83_MAX_ACCESSES;
+        entry = gbtGetJSONNext(document, entry)
+    )
+    {
+        const gbtJSONNode* address = gbtGetJSONChild(document, entry);
+        const gbtJSONNode* value = gbtGetJSONNext(document, address);
+        const gbtJSONNode* activity = gbtGetJSONNext(document, value);
+        if (
+            address == nullptr || address->type != GBT_JSON_NUMBER ||
+            value == nullptr || value->type != GBT_JSON_NUMBER ||
+            activity == nullptr || activity->type != GBT_JSON_STRING ||
+            strlen(activity->string) < 2
+        )
+        {
+            continue;
+        }
+
+        bool read = activity->string[0] == 'r';
+        bool write = activity->string[1] == 'w';
+        if (read == true || write == true)
+        {
+            expected[expectedCount++] = (gbtSM83Access) {
+                (uint16_t) address->number, (uint8_t) value->number, write
+            };
+        }
+    }
+
+    // - With a prefetched opcode, this run's opcode fetch is not in the
+    //   expected accesses, and the expected accesses end with the next
+    //   opcode's prefetch instead.
+    const gbtSM83Access* actual = bus->accesses;
+    size_t actualCount = bus->accessCount;
+    if (prefetched == true)
+    {
+        if (actualCount > 0)    { actual++; actualCount--; }
+        if (expectedCount > 0)  { expectedCount--; }
+    }
+
+    if (bus->overflowed == true || actualCount != expectedCount)
+    {
+        snprintf(detail, detailSize, "made %zu bus accesses, expected %zu",
+            actualCount, expectedCount);
+        return false;
+    }
+
+    for (size_t i = 0; i < expectedCount; ++i)
+    {
+        if (
+            actual[i].address != expected[i].address ||
+            actual[i].value != expected[i].value ||
+            actual[i].write != expected[i].write
+        )
+        {
+            snprintf(detail, detailSize,
+                "bus access #%zu was %c [$%04X] = $%02X, expected %c [$%04X] = $%02X",
+                i, (actual[i].write == true) ? 'W' : 'R', actual[i].address,
+                actual[i].value, (expected[i].write == true) ? 'W' : 'R',
+                expected[i].address, expected[i].value);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void gbtExecuteSM83Job (gbtSM83Bus* bus, gbtSM83Job* job, bool checkBus)
+{
+    gbtJSONDocument document;
+    if (gbtParseJSONFile(job->path, &document) == false)
+    {
+        job->error = true;
+        snprintf(job->detail, sizeof(job->detail), "could not be parsed");
+        return;
+    }
+
+    const gbtJSONNode* tests = gbtGetJSONRoot(&document);
+    if (tests == nullptr || tests->type != GBT_JSON_ARRAY)
+    {
+        job->error = true;
+        snprintf(job->detail, sizeof(job->detail), "is not an array of test cases");
+        gbtFreeJSON(&document);
+        return;
+    }
+
+    gbProcessor* processor = gbGetProcessor(bus->context);
+    bool prefetched = gbtCheckSM83Prefetched(&document, tests);
+    for (
+        const gbtJSONNode* test = gbtGetJSONChild(&document, tests);
+        test != nullptr;
+        test = gbtGetJSONNext(&document, test)
+    )
+    {
+        const gbtJSONNode* name = gbtGetJSONMember(&document, test, "name");
+        const gbtJSONNode* initial = gbtGetJSONMember(&document, test, "initial");
+        const gbtJSONNode* final = gbtGetJSONMember(&document, test, "final");
+        const gbtJSONNode* cycles = gbtGetJSONMember(&document, test, "cycles");
+
+        char detail[GBT_SM83_DETAIL_CAPACITY / 2] = "";
+        bool passed = false;
+        if (initial == nullptr || final == nullptr)
+        {
+            snprintf(detail, sizeof(detail), "has no initial or final state");
+        }
+        else if (gbtLoadSM83State(bus, &document, initial, prefetched) == false)
+        {
+            snprintf(detail, sizeof(detail), "could not be loaded");
+        }
+        else
+        {
+            // - Execute exactly one instruction.
+            uint64_t start = gbGetTickCyclesConsumed(processor);
+            bool ticked = gbTickProcessor(processor);
+            uint64_t tickCycles = gbGetTickCyclesConsumed(processor) - start;
+            if (ticked == false)
+            {
+                snprintf(detail, sizeof(detail), "the processor reported an error");
+            }
+            else
+            {
+                passed =
+                    gbtCheckSM83State(bus, &document, final, prefetched, detail,
+                        sizeof(detail)) &&
+                    gbtCheckSM83Cycles(bus, &document, cycles, prefetched,
+                        tickCycles, checkBus, detail, sizeof(detail));
+            }
+        }
+
+        if (passed == true)
+        {
+            job->passed++;
+            continue;
+        }
+
+        // - Keep only the first failure's description.
+        if (job->failed++ == 0)
+        {
+            snprintf(job->detail, sizeof(job->detail), "'%s': %s",
+                (name != nullptr && name->type == GBT_JSON_STRING) ?
+                    name->string : "?", detail);
+        }
+    }
+
+    gbtFreeJSON(&document);
+}
+
+int gbtSM83Worker (void* argument)
+{
+    gbtSM83Queue* queue = argument;
+
+    // - Each worker drives its own context, with its own flat test bus.
+    gbtSM83Bus* bus = gbCreateZero(1, gbtSM83Bus);
+    if (bus == nullptr)
+    {
+        gbLogErrno("Error allocating memory for test bus");
+        return 1;
+    }
+
+    bus->context = gbCreateContext(false);
+    if (
+        bus->context == nullptr ||
+        gbSetUserdata(bus->context, bus) == false ||
+        gbSetBusReadOverride(bus->context, gbtReadSM83Bus) == false ||
+        gbSetBusWriteOverride(bus->context, gbtWriteSM83Bus) == false
+    )
+    {
+        gbDestroyContext(bus->context);
+        gbDestroy(bus);
+        return 1;
+    }
+
+    // - Pull test files off the shared queue until it is empty.
+    size_t index;
+    while (gbtTakeJob(&queue->work, &index) == true)
+    {
+        gbtSM83Job* job = &queue->jobs[index];
+        gbtExecuteSM83Job(bus, job, queue->checkBus);
+        printf("[%-5s] %6zu/%-6zu  %s\n",
+            (job->error == true) ? "error" : (job->failed == 0) ? "pass" : "fail",
+            job->passed, job->passed + job->failed, job->path);
+    }
+
+    gbDestroyContext(bus->context);
+    gbDestroy(bus);
+    return 0;
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtSM83Command (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintSM83Usage();
+        return 1;
+    }
+
+    // - Parse the options, and collect the test files named by the other
+    //   arguments.
+    gbtSM83Queue queue = { .checkBus = true };
+    uint64_t workerCount = (uint64_t) gbtGetProcessorCount();
+    gbtFileList files = { 0 };
+    int result = 1;
+
+    for (int i = 0; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &workerCount) == false) { goto cleanup; }
+        }
+        else if (strcmp(argv[i], "--no-bus") == 0)
+        {
+            queue.checkBus = false;
+        }
+        else if (strncmp(argv[i], "--", 2) == 0)
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintSM83Usage();
+            goto cleanup;
+        }
+        else if (gbtCollectFiles(argv[i], GBT_SM83_EXTENSIONS, &files) == false)
+        {
+            goto cleanup;
+        }
+    }
+
+    if (files.count == 0)
+    {
+        fprintf(stderr, "No test files found.\n");
+        goto cleanup;
+    }
+
+    gbtSortFileList(&files);
+    queue.jobs = gbCreateZero(files.count, gbtSM83Job);
+    if (queue.jobs == nullptr)
+    {
+        gbLogErrno("Error allocating memory for test jobs");
+        goto cleanup;
+    }
+
+    queue.work.jobCount = files.count;
+    for (size_t i = 0; i < files.count; ++i)
+    {
+        queue.jobs[i].path = files.paths[i];
+    }
+
+    // - Spawn the workers, then wait for them to drain the queue.
+    double start = gbtGetSeconds();
+    size_t workers = gbtRunWorkers(&queue.work, (size_t) workerCount,
+        gbtSM83Worker, &queue);
+
+    // - List each failing file's first failure, in order, then summarize.
+    size_t passed = 0, total = 0, failedFiles = 0;
+    for (size_t i = 0; i < queue.work.jobCount; ++i)
+    {
+        const gbtSM83Job* job = &queue.jobs[i];
+        passed += job->passed;
+        total += job->passed + job->failed;
+        if (job->error == true || job->failed > 0)
+        {
+            if (failedFiles++ == 0)
+            {
+                printf("\nFailures:\n");
+            }
+
+            printf("  %s: %s\n", job->path, job->detail);
+        }
+    }
+
+    printf("\n%zu of %zu test cases passed (%zu of %zu files) in %.2fs on %zu "
+        "worker(s).\n", passed, total, queue.work.jobCount - failedFiles,
+        queue.work.jobCount, gbtGetSeconds() - start, workers);
+    result = (failedFiles == 0) ? 0 : 1;
+
+cleanup:
+    gbDestroy(queue.jobs);
+    gbtFreeFileList(&files);
+    return result;
+}
@@ -0,0 +1,470 @@
+/**
+ * @file    GBT/TraceCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt trace` subcommand, which
+ *          records, decodes and diffs binary execution trace dumps.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The default number of records held by a trace buffer created by
+ *          `gbt trace record`.
+ */
+#define GBT_TRACE_DEFAULT_CAPACITY      (1u << 20)
+
+/**
+ * @brief   The default number of instructions executed by `gbt trace record`.
+ */
+#define GBT_TRACE_DEFAULT_INSTRUCTIONS  1000000ull
+
+/**
+ * @brief   The default number of records shown before the first divergence by
+ *          `gbt trace diff`.
+ */
+#define GBT_TRACE_DEFAULT_WINDOW        16ull
+
+/**
+ * @brief   Names of the 8-bit register operands encoded in bits 0-2 (and 3-5)
+ *          of the regular `LD r, r`, ALU and `CB`-prefixed opcode blocks.
+ */
+static const char* GBT_R8_NAMES[8] = {
+    "B", "C", "D", "E", "H", "L", "[HL]", "A"
+};
+
+/**
+ * @brief   Names of the operations encoded in bits 3-5 of the `0x80`-`0xBF`
+ *          ALU opcode block.
+ */
+static const char* GBT_ALU_NAMES[8] = {
+    "ADD A,", "ADC A,", "SUB", "SBC A,", "AND", "XOR", "OR", "CP"
+};
+
+/**
+ * @brief   Names of the operations encoded in bits 3-5 of the `0xCB00`-`0xCB3F`
+ *          prefixed opcode block.
+ */
+static const char* GBT_CB_NAMES[8] = {
+    "RLC", "RRC", "RL", "RR", "SLA", "SRA", "SWAP", "SRL"
+};
+
+/**
+ * @brief   Mnemonics of the unprefixed opcodes which are not part of the
+ *          regular `0x40`-`0xBF` blocks. Those blocks are decoded from their
+ *          bit patterns instead.
+ */
+static const char* GBT_OPCODE_NAMES[256] = {
+    [0x00] = "NOP",         [0x01] = "LD BC, d16",  [0x02] = "LD [BC], A",  [0x03] = "INC BC",
+    [0x04] = "INC B",       [0x05] = "DEC B",       [0x06] = "LD B, d8",    [0x07] = "RLCA",
+    [0x08] = "LD [a16], SP",[0x09] = "ADD HL, BC",  [0x0A] = "LD A, [BC]",  [0x0B] = "DEC BC",
+    [0x0C] = "INC C",       [0x0D] = "DEC C",       [0x0E] = "LD C, d8",    [0x0F] = "RRCA",
+    [0x10] = "STOP",        [0x11] = "LD DE, d16",  [0x12] = "LD [DE], A",  [0x13] = "INC DE",
+    [0x14] = "INC D",       [0x15] = "DEC D",       [0x16] = "LD D, d8",    [0x17] = "RLA",
+    [0x18] = "JR s8",       [0x19] = "ADD HL, DE",  [0x1A] = "LD A, [DE]",  [0x1B] = "DEC DE",
+    [0x1C] = "INC E",       [0x1D] = "DEC E",       [0x1E] = "LD E, d8",    [0x1F] = "RRA",
+    [0x20] = "JR NZ, s8",   [0x21] = "LD HL, d16",  [0x22] = "LD [HL+], A", [0x23] = "INC HL",
+    [0x24] = "INC H",       [0x25] = "DEC H",       [0x26] = "LD H, d8",    [0x27] = "DAA",
+    [0x28] = "JR Z, s8",    [0x29] = "ADD HL, HL",  [0x2A] = "LD A, [HL+]", [0x2B] = "DEC HL",
+    [0x2C] = "INC L",       [0x2D] = "DEC L",       [0x2E] = "LD L, d8",    [0x2F] = "CPL",
+    [0x30] = "JR NC, s8",   [0x31] = "LD SP, d16",  [0x32] = "LD [HL-], A", [0x33] = "INC SP",
+    [0x34] = "INC [HL]",    [0x35] = "DEC [HL]",    [0x36] = "LD [HL], d8", [0x37] = "SCF",
+    [0x38] = "JR C, s8",    [0x39] = "ADD HL, SP",  [0x3A] = "LD A, [HL-]", [0x3B] = "DEC SP",
+    [0x3C] = "INC A",       [0x3D] = "DEC A",       [0x3E] = "LD A, d8",    [0x3F] = "CCF",
+    [0x76] = "HALT",
+    [0xC0] = "RET NZ",      [0xC1] = "POP BC",      [0xC2] = "JP NZ, a16",  [0xC3] = "JP a16",
+    [0xC4] = "CALL NZ, a16",[0xC5] = "PUSH BC",     [0xC6] = "ADD A, d8",   [0xC7] = "RST $00",
+    [0xC8] = "RET Z",       [0xC9] = "RET",         [0xCA] = "JP Z, a16",   [0xCB] = "PREFIX CB",
+    [0xCC] = "CALL Z, a16", [0xCD] = "CALL a16",    [0xCE] = "ADC A, d8",   [0xCF] = "RST $08",
+    [0xD0] = "RET NC",      [0xD1] = "POP DE",      [0xD2] = "JP NC, a16",
+    [0xD4] = "CALL NC, a16",[0xD5] = "PUSH DE",     [0xD6] = "SUB d8",      [0xD7] = "RST $10",
+    [0xD8] = "RET C",       [0xD9] = "RETI",        [0xDA] = "JP C, a16",
+    [0xDC] = "CALL C, a16",                         [0xDE] = "SBC A, d8",   [0xDF] = "RST $18",
+    [0xE0] = "LDH [a8], A", [0xE1] = "POP HL",      [0xE2] = "LDH [C], A",
+                                                    [0xE5] = "PUSH HL",     [0xE6] = "AND d8",
+    [0xE7] = "RST $20",     [0xE8] = "ADD SP, s8",  [0xE9] = "JP HL",       [0xEA] = "LD [a16], A",
+                                                    [0xEE] = "XOR d8",      [0xEF] = "RST $28",
+    [0xF0] = "LDH A, [a8]", [0xF1] = "POP AF",      [0xF2] = "LDH A, [C]",  [0xF3] = "DI",
+                            [0xF5] = "PUSH AF",     [0xF6] = "OR d8",       [0xF7] = "RST $30",
+    [0xF8] = "LD HL, SP+s8",[0xF9] = "LD SP, HL",   [0xFA] = "LD A, [a16]", [0xFB] = "EI",
+                                                    [0xFE] = "CP d8",       [0xFF] = "RST $38",
+};
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintTraceUsage ();
+static void gbtDecodeOpcode (uint16_t opcode, char* buffer, size_t bufferSize);
+static bool gbtCompareTraceRecords (const gbTraceRecord* a,
+    const gbTraceRecord* b);
+static int gbtTraceRecordCommand (int argc, char** argv);
+static int gbtTraceDumpCommand (int argc, char** argv);
+static int gbtTraceDiffCommand (int argc, char** argv);
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintTraceUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt trace record <rom> <out.gbtrace> [--instructions N] [--capacity N] [--bus]\n"
+        "  gbt trace dump <file.gbtrace> [--limit N]\n"
+        "  gbt trace diff <a.gbtrace> <b.gbtrace> [--window N]\n"
+    );
+}
+
+void gbtDecodeOpcode (uint16_t opcode, char* buffer, size_t bufferSize)
+{
+    uint8_t low = opcode & 0xFF;
+
+    // - `CB`-prefixed opcodes are fully regular, so decode their bit pattern.
+    if ((opcode & 0xFF00) == 0xCB00)
+    {
+        const char* reg = GBT_R8_NAMES[low & 0x07];
+        uint8_t bit = (low >> 3) & 0x07;
+        switch (low >> 6)
+        {
+            case 0:  snprintf(buffer, bufferSize, "%s %s", GBT_CB_NAMES[bit], reg); break;
+            case 1:  snprintf(buffer, bufferSize, "BIT %u, %s", bit, reg); break;
+            case 2:  snprintf(buffer, bufferSize, "RES %u, %s", bit, reg); break;
+            default: snprintf(buffer, bufferSize, "SET %u, %s", bit, reg); break;
+        }
+
+        return;
+    }
+
+    // - Any other prefix is an Engine Mode extension, which has no mnemonics
+    //   of its own yet.
+    if ((opcode & 0xFF00) != 0x0000)
+    {
+        snprintf(buffer, bufferSize, "??? $%04X", opcode);
+        return;
+    }
+
+    // - The `LD r, r` and ALU blocks are regular as well; everything else comes
+    //   from the lookup table.
+    if (low >= 0x40 && low <= 0x7F && low != 0x76)
+    {
+        snprintf(buffer, bufferSize, "LD %s, %s", GBT_R8_NAMES[(low >> 3) & 0x07],
+            GBT_R8_NAMES[low & 0x07]);
+    }
+    else if (low >= 0x80 && low <= 0xBF)
+    {
+        snprintf(buffer, bufferSize, "%s %s", GBT_ALU_NAMES[(low >> 3) & 0x07],
+            GBT_R8_NAMES[low & 0x07]);
+    }
+    else if (GBT_OPCODE_NAMES[low] != nullptr)
+    {
+        snprintf(buffer, bufferSize, "%s", GBT_OPCODE_NAMES[low]);
+    }
+    else
+    {
+        snprintf(buffer, bufferSize, "??? $%02X", low);
+    }
+}
+
+bool gbtCompareTraceRecords (const gbTraceRecord* a, const gbTraceRecord* b)
+{
+    // - Compare field by field; the reserved bytes are not significant.
+    return
+        a->cycle == b->cycle &&
+        a->address == b->address &&
+        a->opcode == b->opcode &&
+        a->bank == b->bank &&
+        a->stackPointer == b->stackPointer &&
+        a->accumulator == b->accumulator &&
+        a->flags == b->flags &&
+        a->type == b->type;
+}
+
+int gbtTraceRecordCommand (int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        gbtPrintTraceUsage();
+        return 1;
+    }
+
+    // - Parse the options following the positional arguments.
+    uint64_t instructions = GBT_TRACE_DEFAULT_INSTRUCTIONS;
+    uint64_t capacity = GBT_TRACE_DEFAULT_CAPACITY;
+    uint8_t flags = GB_TF_NONE;
+    for (int i = 2; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--instructions") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &instructions) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--capacity") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &capacity) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--bus") == 0)
+        {
+            flags |= GB_TF_BUS_ACCESSES;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintTraceUsage();
+            return 1;
+        }
+    }
+
+    // - Create the context, cartridge and trace buffer.
+    int result = 1;
+    gbContext* context = gbCreateContext(false);
+    gbCartridge* cartridge = gbCreateCartridge(argv[0]);
+    gbTrace* trace = gbCreateTrace((size_t) capacity, flags);
+    if (context == nullptr || cartridge == nullptr || trace == nullptr)
+    {
+        goto cleanup;
+    }
+
+    if (
+        gbAttachCartridge(context, cartridge) == false ||
+        gbAttachTrace(context, trace) == false
+    )
+    {
+        goto cleanup;
+    }
+
+    // - Run the requested number of instructions, stopping early if the
+    //   processor reports an error.
+    uint64_t executed = 0;
+    for (; executed < instructions; ++executed)
+    {
+        if (gbTick(context) == false)
+        {
+            fprintf(stderr, "Emulation stopped after %llu instructions.\n",
+                (unsigned long long) executed);
+            break;
+        }
+    }
+
+    // - Detach the trace before saving, so that no further records are pushed.
+    gbAttachTrace(context, nullptr);
+    if (gbSaveTrace(trace, argv[1]) == false)
+    {
+        goto cleanup;
+    }
+
+    printf("Wrote %zu records (%llu dropped) to '%s'.\n",
+        gbGetTraceRecordCount(trace),
+        (unsigned long long) gbGetTraceDroppedCount(trace), argv[1]);
+    result = 0;
+
+cleanup:
+    gbDestroyContext(context);
+    gbDestroyCartridge(cartridge);
+    gbDestroyTrace(trace);
+    return result;
+}
+
+int gbtTraceDumpCommand (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintTraceUsage();
+        return 1;
+    }
+
+    uint64_t limit = UINT64_MAX;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--limit") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &limit) == false) { return 1; }
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintTraceUsage();
+            return 1;
+        }
+    }
+
+    gbTrace* trace = gbLoadTrace(argv[0]);
+    if (trace == nullptr)
+    {
+        return 1;
+    }
+
+    size_t count = gbGetTraceRecordCount(trace);
+    printf("; %zu records, %llu dropped before dump\n", count,
+        (unsigned long long) gbGetTraceDroppedCount(trace));
+    printf("%10s  %12s  %-7s  %-4s  %s\n", "index", "cycle", "bank:pc", "op",
+        "instruction");
+
+    gbTraceRecord record;
+    for (size_t i = 0; i < count && i < limit; ++i)
+    {
+        gbReadTraceRecord(trace, i, &record);
+        gbtPrintTraceRecord("", i, &record);
+    }
+
+    gbDestroyTrace(trace);
+    return 0;
+}
+
+int gbtTraceDiffCommand (int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        gbtPrintTraceUsage();
+        return 1;
+    }
+
+    uint64_t window = GBT_TRACE_DEFAULT_WINDOW;
+    for (int i = 2; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--window") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &window) == false) { return 1; }
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintTraceUsage();
+            return 1;
+        }
+    }
+
+    int result = 2;
+    gbTrace* left = gbLoadTrace(argv[0]);
+    gbTrace* right = gbLoadTrace(argv[1]);
+    if (left == nullptr || right == nullptr)
+    {
+        goto cleanup;
+    }
+
+    // - Find the first record which differs between the two traces.
+    size_t leftCount = gbGetTraceRecordCount(left);
+    size_t rightCount = gbGetTraceRecordCount(right);
+    size_t common = (leftCount < rightCount) ? leftCount : rightCount;
+    size_t divergence = common;
+    gbTraceRecord a, b;
+    for (size_t i = 0; i < common; ++i)
+    {
+        gbReadTraceRecord(left, i, &a);
+        gbReadTraceRecord(right, i, &b);
+        if (gbtCompareTraceRecords(&a, &b) == false)
+        {
+            divergence = i;
+            break;
+        }
+    }
+
+    if (divergence == common && leftCount == rightCount)
+    {
+        printf("Traces are identical (%zu records).\n", common);
+        result = 0;
+        goto cleanup;
+    }
+
+    if (divergence == common)
+    {
+        printf("Traces agree for %zu records, then '%s' ends.\n", common,
+            (leftCount < rightCount) ? argv[0] : argv[1]);
+    }
+    else
+    {
+        printf("Traces diverge at record %zu.\n", divergence);
+    }
+
+    // - Print the records leading up to (and including) the divergence from
+    //   both traces, interleaved so that differences line up.
+    size_t first = (divergence > window) ? divergence - (size_t) window : 0;
+    for (size_t i = first; i <= divergence; ++i)
+    {
+        bool hasLeft = (i < leftCount) && gbReadTraceRecord(left, i, &a);
+        bool hasRight = (i < rightCount) && gbReadTraceRecord(right, i, &b);
+        if (hasLeft == true && hasRight == true &&
+            gbtCompareTraceRecords(&a, &b) == true)
+        {
+            gbtPrintTraceRecord("  ", i, &a);
+            continue;
+        }
+
+        if (hasLeft == true)  { gbtPrintTraceRecord("< ", i, &a); }
+        if (hasRight == true) { gbtPrintTraceRecord("> ", i, &b); }
+    }
+
+    result = 1;
+
+cleanup:
+    gbDestroyTrace(left);
+    gbDestroyTrace(right);
+    return result;
+}
+
+/* Public Function Definitions - Helper Functions *****************************/
+
+void gbtPrintTraceRecord (const char* prefix, size_t index,
+    const gbTraceRecord* record)
+{
+    switch (record->type)
+    {
+        case GB_TRT_INSTRUCTION:
+        {
+            char mnemonic[32];
+            gbtDecodeOpcode(record->opcode, mnemonic, sizeof(mnemonic));
+            printf("%s%10zu  %12llu  %02X:%04X  %04X  %-16s  A=%02X F=%c%c%c%c SP=%04X\n",
+                prefix, index, (unsigned long long) record->cycle,
+                record->bank, record->address, record->opcode, mnemonic,
+                record->accumulator,
+                (record->flags & 0x80) ? 'Z' : '-',
+                (record->flags & 0x40) ? 'N' : '-',
+                (record->flags & 0x20) ? 'H' : '-',
+                (record->flags & 0x10) ? 'C' : '-',
+                record->stackPointer);
+        } break;
+
+        case GB_TRT_BUS_READ:
+        case GB_TRT_BUS_WRITE:
+            printf("%s%10zu  %12llu  %02X:%04X        %c [$%04X] = $%02X\n",
+                prefix, index, (unsigned long long) record->cycle,
+                record->bank, record->address,
+                (record->type == GB_TRT_BUS_READ) ? 'R' : 'W',
+                record->address, record->opcode & 0xFF);
+            break;
+
+        default:
+            printf("%s%10zu  %12llu  (unknown record type %u)\n",
+                prefix, index, (unsigned long long) record->cycle,
+                record->type);
+            break;
+    }
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtTraceCommand (int argc, char** argv)
+{
+    if (argc < 1)
+    {
+        gbtPrintTraceUsage();
+        return 1;
+    }
+
+    if (strcmp(argv[0], "record") == 0)
+    {
+        return gbtTraceRecordCommand(argc - 1, argv + 1);
+    }
+    else if (strcmp(argv[0], "dump") == 0)
+    {
+        return gbtTraceDumpCommand(argc - 1, argv + 1);
+    }
+    else if (strcmp(argv[0], "diff") == 0)
+    {
+        return gbtTraceDiffCommand(argc - 1, argv + 1);
+    }
+
+    fprintf(stderr, "Unknown trace command '%s'.\n", argv[0]);
+    gbtPrintTraceUsage();
+    return 1;
+}
@@ -0,0 +1,440 @@
+/**
+ * @file    GBT/WorkloadCommand.c
+ * @author  Dennis W. Griffin <dgdev1024@gmail.com>
+ * @date    2026-10-17
+ *
+ * @brief   Contains the implementation of the `gbt workload` subcommand, which
+ *          generates synthetic benchmark ROMs and reports how fast the core
+ *          runs them, in frames per second and millions of instructions per
+ *          second.
+ */
+
+/* Private Includes ***********************************************************/
+
+#include <GBT/Commands.h>
+#include <GBT/ROMBuilder.h>
+#include <math.h>
+
+/* Private Constants and Enumerations *****************************************/
+
+/**
+ * @brief   The number of T-cycles in one frame, and the number of frames per
+ *          second at which the real hardware runs.
+ */
+#define GBT_WORKLOAD_FRAME_CYCLES       70224ull
+#define GBT_WORKLOAD_HARDWARE_FPS       59.7275
+
+/**
+ * @brief   The default number of emulated frames in each timed repetition.
+ */
+#define GBT_WORKLOAD_DEFAULT_FRAMES     600ull
+
+/**
+ * @brief   The default number of timed repetitions of each workload.
+ */
+#define GBT_WORKLOAD_DEFAULT_REPETITIONS 3ull
+
+/* Private Unions and Structures **********************************************/
+
+/**
+ * @brief   Defines a pointer to a function which emits a workload's code into
+ *          a freshly initialized ROM builder.
+ */
+typedef void (*gbtWorkloadBuild) (gbtROMBuilder* builder);
+
+/**
+ * @brief   Defines a structure describing a single synthetic workload.
+ */
+typedef struct gbtWorkload
+{
+    const char*         name;
+    const char*         summary;
+    uint8_t             cartridgeType;
+    uint8_t             romSizeCode;
+    uint8_t             ramSizeCode;
+    gbtWorkloadBuild    build;
+} gbtWorkload;
+
+/**
+ * @brief   Defines a structure holding the results of a single workload.
+ */
+typedef struct gbtWorkloadResult
+{
+    const gbtWorkload*  workload;
+    double              seconds;        // Best repetition.
+    double              fps;
+    double              mips;
+    uint64_t            instructions;   // Per repetition.
+} gbtWorkloadResult;
+
+/* Private Function Declarations **********************************************/
+
+static void gbtPrintWorkloadUsage ();
+static void gbtCountInstruction (gbContext* context, uint16_t address,
+    uint16_t opcode, bool success);
+
+static void gbtBuildALU (gbtROMBuilder* builder);
+static void gbtBuildMemcpy (gbtROMBuilder* builder);
+static void gbtBuildBankSwitch (gbtROMBuilder* builder);
+static void gbtBuildHaltTimer (gbtROMBuilder* builder);
+static void gbtBuildPPUPoll (gbtROMBuilder* builder);
+
+/* Private Constants and Enumerations - Workloads *****************************/
+
+/**
+ * @brief   Defines the table of workloads run by `gbt workload`.
+ */
+static const gbtWorkload GBT_WORKLOADS[] = {
+    { "alu",            "8- and 16-bit arithmetic and logic in a tight loop",
+        0x00, 0x00, 0x00, gbtBuildALU },
+    { "memcpy",         "2 KiB copies from WRAM bank 0 to WRAM bank 1",
+        0x00, 0x00, 0x00, gbtBuildMemcpy },
+    { "bank-switch",    "MBC5 ROM and RAM bank switches, each followed by a read",
+        0x1B, 0x05, 0x03, gbtBuildBankSwitch },
+    { "halt-timer",     "HALT, woken by a timer interrupt every 256 T-cycles",
+        0x00, 0x00, 0x00, gbtBuildHaltTimer },
+    { "ppu-poll",       "Busy-waiting on LY and STAT",
+        0x00, 0x00, 0x00, gbtBuildPPUPoll },
+};
+
+/* Private Function Definitions ***********************************************/
+
+void gbtPrintWorkloadUsage ()
+{
+    fprintf(stderr,
+        "Usage:\n"
+        "  gbt workload [--filter TEXT] [--frames N] [--reps N] [--json FILE]\n"
+        "               [--save DIR] [--list]\n"
+        "\n"
+        "Each workload's ROM is generated in memory, then run for --reps\n"
+        "repetitions of --frames frames each. The best repetition is reported.\n"
+        "--save writes each generated ROM to DIR/<workload>.gb.\n"
+    );
+}
+
+void gbtCountInstruction (gbContext* context, uint16_t address,
+    uint16_t opcode, bool success)
+{
+    uint64_t* counter = gbGetUserdata(context);
+    (*counter)++;
+}
+
+/* Private Function Definitions - Workloads ***********************************/
+
+void gbtBuildALU (gbtROMBuilder* builder)
+{
+    gbtEmit(builder, 11,
+        0x3E, 0x12,                     // LD A, $12
+        0x01, 0x56, 0x34,               // LD BC, $3456
+        0x11, 0x9A, 0x78,               // LD DE, $789A
+        0x21, 0xDE, 0xBC);              // LD HL, $BCDE
+
+    uint16_t loop = gbtGetROMOrigin(builder);
+    gbtEmit(builder, 17,
+        0x80,                           // ADD A, B
+        0x89,                           // ADC A, C
+        0x92,                           // SUB A, D
+        0x9B,                           // SBC A, E
+        0xA4,                           // AND A, H
+        0xAD,                           // XOR A, L
+        0xB0,                           // OR A, B
+        0xB9,                           // CP A, C
+        0x04,                           // INC B
+        0x0D,                           // DEC C
+        0x07,                           // RLCA
+        0xCB, 0x37,                     // SWAP A
+        0x23,                           // INC HL
+        0x1B,                           // DEC DE
+        0x09,                           // ADD HL, BC
+        0x27);                          // DAA
+    gbtEmitJR(builder, 0x18, loop);     // JR loop
+}
+
+void gbtBuildMemcpy (gbtROMBuilder* builder)
+{
+    uint16_t start = gbtGetROMOrigin(builder);
+    gbtEmit(builder, 9,
+        0x21, 0x00, 0xC0,               // LD HL, $C000
+        0x11, 0x00, 0xD0,               // LD DE, $D000
+        0x01, 0x00, 0x08);              // LD BC, $0800
+
+    uint16_t copy = gbtGetROMOrigin(builder);
+    gbtEmit(builder, 6,
+        0x2A,                           // LD A, [HL+]
+        0x12,                           // LD [DE], A
+        0x13,                           // INC DE
+        0x0B,                           // DEC BC
+        0x78,                           // LD A, B
+        0xB1);                          // OR A, C
+    gbtEmitJR(builder, 0x20, copy);     // JR NZ, copy
+    gbtEmitJR(builder, 0x18, start);    // JR start
+}
+
+void gbtBuildBankSwitch (gbtROMBuilder* builder)
+{
+    // - Each ROMX bank is filled with its own bank number, so the value read
+    //   back from `$4000` selects the next bank.
+    for (uint16_t bank = 1; bank < builder->bankCount; ++bank)
+    {
+        gbtFillROMBank(builder, bank, (uint8_t) bank);
+    }
+
+    gbtEmit(builder, 7,
+        0x3E, 0x0A,                     // LD A, $0A
+        0xEA, 0x00, 0x00,               // LD [$0000], A    ; Enable RAM.
+        0x3E, 0x01);                    // LD A, $01
+
+    uint16_t loop = gbtGetROMOrigin(builder);
+    gbtEmit(builder, 15,
+        0xEA, 0x00, 0x20,               // LD [$2000], A    ; ROM bank.
+        0xEA, 0x00, 0x40,               // LD [$4000], A    ; RAM bank.
+        0xEA, 0x00, 0xA0,               // LD [$A000], A
+        0xFA, 0x00, 0x40,               // LD A, [$4000]
+        0x3C,                           // INC A
+        0xE6, 0x3F);                    // AND A, $3F
+    gbtEmitJR(builder, 0x18, loop);     // JR loop
+}
+
+void gbtBuildHaltTimer (gbtROMBuilder* builder)
+{
+    // - The timer handler counts interrupts in HRAM.
+    gbtSetROMOrigin(builder, 0, 0x0050);
+    gbtEmit(builder, 6,
+        0xF5,                           // PUSH AF
+        0xF0, 0x80,                     // LDH A, [$FF80]
+        0x3C,                           // INC A
+        0xE0, 0x80);                    // LDH [$FF80], A
+    gbtEmit(builder, 2,
+        0xF1,                           // POP AF
+        0xD9);                          // RETI
+
+    // - TIMA counts at 262144 Hz from `TMA = $F0`, so it overflows every 16
+    //   increments, or 256 T-cycles.
+    gbtSetROMOrigin(builder, 0, 0x0150);
+    gbtEmit(builder, 15,
+        0x3E, 0xF0,                     // LD A, $F0
+        0xE0, 0x06,                     // LDH [TMA], A
+        0x3E, 0x05,                     // LD A, $05
+        0xE0, 0x07,                     // LDH [TAC], A
+        0x3E, 0x04,                     // LD A, $04
+        0xE0, 0xFF,                     // LDH [IE], A
+        0xAF,                           // XOR A, A
+        0xE0, 0x0F);                    // LDH [IF], A
+    gbtEmit(builder, 1,
+        0xFB);                          // EI
+
+    uint16_t loop = gbtGetROMOrigin(builder);
+    gbtEmit(builder, 1,
+        0x76);                          // HALT
+    gbtEmitJR(builder, 0x18, loop);     // JR loop
+}
+
+void gbtBuildPPUPoll (gbtROMBuilder* builder)
+{
+    // - Wait for `LY` to reach the first VBlank line, then poll the `STAT`
+    //   mode bits, as a game's VBlank and HBlank waits would.
+    uint16_t wait = gbtGetROMOrigin(builder);
+    gbtEmit(builder, 4,
+        0xF0, 0x44,                     // LDH A, [LY]
+        0xFE, 0x90);                    // CP A, 144
+    gbtEmitJR(builder, 0x20, wait);     // JR NZ, wait
+    gbtEmit(builder, 4,
+        0xF0, 0x41,                     // LDH A, [STAT]
+        0xE6, 0x03);                    // AND A, $03
+    gbtEmitJR(builder, 0x18, wait);     // JR wait
+}
+
+/* Public Function Definitions - Subcommands **********************************/
+
+int gbtWorkloadCommand (int argc, char** argv)
+{
+    // - Parse the options.
+    uint64_t frames = GBT_WORKLOAD_DEFAULT_FRAMES;
+    uint64_t repetitions = GBT_WORKLOAD_DEFAULT_REPETITIONS;
+    const char* filter = nullptr;
+    const char* jsonPath = nullptr;
+    const char* saveDirectory = nullptr;
+    bool listOnly = false;
+
+    for (int i = 0; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &frames) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+        {
+            if (gbtParseUnsigned(argv[++i], &repetitions) == false) { return 1; }
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            jsonPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc)
+        {
+            saveDirectory = argv[++i];
+        }
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            listOnly = true;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            gbtPrintWorkloadUsage();
+            return 1;
+        }
+    }
+
+    if (frames == 0 || repetitions == 0)
+    {
+        fprintf(stderr, "--frames and --reps must not be zero.\n");
+        return 1;
+    }
+
+    const size_t workloadCount = sizeof(GBT_WORKLOADS) / sizeof(GBT_WORKLOADS[0]);
+    if (listOnly == true)
+    {
+        for (size_t i = 0; i < workloadCount; ++i)
+        {
+            printf("%-12s %s\n", GBT_WORKLOADS[i].name, GBT_WORKLOADS[i].summary);
+        }
+
+        return 0;
+    }
+
+    int result = 1;
+    uint64_t instructions = 0;
+    gbCartridge* cartridge = nullptr;
+    gbtROMBuilder builder = { 0 };
+    gbtWorkloadResult* results = gbCreateZero(workloadCount, gbtWorkloadResult);
+    gbContext* context = gbCreateContext(false);
+    if (results == nullptr || context == nullptr)
+    {
+        goto cleanup;
+    }
+
+    gbSetUserdata(context, &instructions);
+    gbSetInstructionExecuteCallback(gbGetProcessor(context), gbtCountInstruction);
+
+    printf("%-12s %10s %12s %10s %10s\n", "workload", "seconds", "fps", "speed",
+        "mips");
+
+    size_t resultCount = 0;
+    for (size_t w = 0; w < workloadCount; ++w)
+    {
+        const gbtWorkload* workload = &GBT_WORKLOADS[w];
+        if (filter != nullptr && strstr(workload->name, filter) == nullptr)
+        {
+            continue;
+        }
+
+        // - Generate the workload's ROM, saving it if requested.
+        if (
+            gbtInitROMBuilder(&builder, "GBT WORKLOAD", workload->cartridgeType,
+                workload->romSizeCode, workload->ramSizeCode) == false
+        )
+        {
+            goto cleanup;
+        }
+
+        workload->build(&builder);
+        if (saveDirectory != nullptr)
+        {
+            char path[1024];
+            snprintf(path, sizeof(path), "%s/%s.gb", saveDirectory, workload->name);
+            if (gbtSaveROMBuilder(&builder, path) == false)
+            {
+                goto cleanup;
+            }
+        }
+
+        cartridge = gbtFinishROMBuilder(&builder);
+        gbtFreeROMBuilder(&builder);
+        if (cartridge == nullptr)
+        {
+            fprintf(stderr, "Failed to generate workload '%s'.\n", workload->name);
+            goto cleanup;
+        }
+
+        // - Time each repetition from a freshly reset context. A workload which
+        //   stops short of its budget is broken, not fast.
+        gbtWorkloadResult* entry = &results[resultCount++];
+        entry->workload = workload;
+        entry->seconds = INFINITY;
+        for (uint64_t r = 0; r < repetitions; ++r)
+        {
+            gbStopReason reason = GB_SR_ERROR;
+            if (gbAttachCartridge(context, cartridge) == false)
+            {
+                goto cleanup;
+            }
+
+            instructions = 0;
+            double start = gbtGetSeconds();
+            bool ran = gbRun(context, frames * GBT_WORKLOAD_FRAME_CYCLES, &reason);
+            double elapsed = gbtGetSeconds() - start;
+            if (ran == false || reason != GB_SR_TICK_BUDGET)
+            {
+                fprintf(stderr, "Workload '%s' stopped early: %s.\n",
+                    workload->name, gbStringifyStopReason(reason));
+                goto cleanup;
+            }
+
+            if (elapsed < entry->seconds)
+            {
+                entry->seconds = elapsed;
+                entry->instructions = instructions;
+            }
+        }
+
+        gbAttachCartridge(context, nullptr);
+        gbDestroyCartridge(cartridge);
+        cartridge = nullptr;
+
+        entry->fps = (double) frames / entry->seconds;
+        entry->mips = (double) entry->instructions / entry->seconds / 1e6;
+        printf("%-12s %10.3f %12.1f %9.1fx %10.2f\n", workload->name,
+            entry->seconds, entry->fps, entry->fps / GBT_WORKLOAD_HARDWARE_FPS,
+            entry->mips);
+    }
+
+    // - Write the JSON report, if requested.
+    if (jsonPath != nullptr)
+    {
+        FILE* fp = fopen(jsonPath, "w");
+        if (fp == nullptr)
+        {
+            gbLogErrno("Failed to open report file '%s' for writing", jsonPath);
+            goto cleanup;
+        }
+
+        fprintf(fp, "{\n  \"frames\": %llu,\n  \"repetitions\": %llu,\n"
+            "  \"workloads\": [\n", (unsigned long long) frames,
+            (unsigned long long) repetitions);
+        for (size_t i = 0; i < resultCount; ++i)
+        {
+            fprintf(fp, "    { \"name\": \"%s\", \"seconds\": %.6f, "
+                "\"fps\": %.3f, \"mips\": %.3f, \"instructions\": %llu }%s\n",
+                results[i].workload->name, results[i].seconds, results[i].fps,
+                results[i].mips, (unsigned long long) results[i].instructions,
+                (i + 1 < resultCount) ? "," : "");
+        }
+
+        fprintf(fp, "  ]\n}\n");
+        fclose(fp);
+    }
+
+    result = 0;
+
+cleanup:
+    gbtFreeROMBuilder(&builder);
+    gbDestroyContext(context);
+    gbDestroyCartridge(cartridge);
+    gbDestroy(results);
+    return result;
+}